@@ -45,6 +45,12 @@ option(USE_VTUNE "Plug VTUNE to profile GS JIT.")
 option(BUILD_REPLAY_LOADERS "Build GS replayer to ease testing (developer option)")
 option(USE_OPENGL "Enable OpenGL GS renderer" ON)
 option(USE_VULKAN "Enable Vulkan GS renderer" ON)
+if(UNIX AND NOT APPLE AND USE_OPENGL)
+	# EGL gives the runner a surfaceless context, so it also runs on machines without a display.
+	option(BUILD_GSRUNNER "Build the headless GS dump runner, requires QT_BUILD (developer option)" ON)
+else()
+	option(BUILD_GSRUNNER "Build the headless GS dump runner, requires QT_BUILD (developer option)" OFF)
+endif()
 
 #-------------------------------------------------------------------------------
 # Path and lib option
@@ -21,6 +21,7 @@
 #include <mach/mach_init.h>
 #include <mach/thread_act.h>
 #include <mach/mach_port.h>
+#include <mach/mach_time.h>
 
 #include "common/PrecompiledHeader.h"
 #include "common/Threading.h"
@@ -35,6 +36,12 @@ __forceinline void Threading::Sleep(int ms)
 	usleep(1000 * ms);
 }
 
+void Threading::SleepUntil(u64 ticks)
+{
+	// GetCPUTicks() is mach_absolute_time()
+	mach_wait_until(ticks);
+}
+
 __forceinline void Threading::Timeslice()
 {
 	sched_yield();
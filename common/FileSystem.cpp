@@ -853,6 +853,18 @@ s64 FileSystem::FSize64(std::FILE* fp)
 	return -1;
 }
 
+bool FileSystem::FSync(std::FILE* fp)
+{
+	if (std::fflush(fp) != 0)
+		return false;
+
+#ifdef _WIN32
+	return (_commit(_fileno(fp)) == 0);
+#else
+	return (fsync(fileno(fp)) == 0);
+#endif
+}
+
 s64 FileSystem::GetPathFileSize(const char* Path)
 {
 	FILESYSTEM_STAT_DATA sd;
@@ -108,6 +108,9 @@ namespace FileSystem
 	s64 FTell64(std::FILE* fp);
 	s64 FSize64(std::FILE* fp);
 
+	/// Flushes the stream and waits for its data to reach the disk.
+	bool FSync(std::FILE* fp);
+
 	int OpenFDFile(const char* filename, int flags, int mode);
 
 	/// Sharing modes for OpenSharedCFile().
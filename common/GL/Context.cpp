@@ -33,6 +33,9 @@
 #elif defined(__APPLE__)
 #include "common/GL/ContextAGL.h"
 #else
+#if defined(X11_API) || defined(WAYLAND_API)
+#include "common/GL/ContextEGL.h"
+#endif
 #ifdef X11_API
 #include "common/GL/ContextEGLX11.h"
 #endif
@@ -117,6 +120,12 @@ namespace GL
 			context = ContextEGLWayland::Create(wi, versions_to_try, num_versions_to_try);
 #endif
 
+#if defined(X11_API) || defined(WAYLAND_API)
+		// Headless, e.g. the GS runner, uses the default EGL display.
+		if (wi.type == WindowInfo::Type::Surfaceless)
+			context = ContextEGL::Create(wi, versions_to_try, num_versions_to_try);
+#endif
+
 		if (!context)
 			return nullptr;
 
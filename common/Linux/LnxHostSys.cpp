@@ -19,6 +19,7 @@
 #include <signal.h>
 #include <errno.h>
 #include <unistd.h>
+#include <ucontext.h>
 
 #include "fmt/core.h"
 
@@ -35,10 +36,66 @@
 
 extern void SignalExit(int sig);
 
-static const uptr m_pagemask = getpagesize() - 1;
+// Callback requested by a page fault listener, run by the SIGTRAP handler once the
+// faulting instruction has been single-stepped.
+static thread_local SrcType_PageFault::StepCallback s_step_callback = nullptr;
+
+#if defined(__x86_64__)
+#define X86_TRAP_FLAG 0x100
+#define X86_PF_WRITE 0x2
+#if defined(__APPLE__)
+#define CTX_FLAGS(ctx) ((ucontext_t*)(ctx))->uc_mcontext->__ss.__rflags
+#define CTX_ERR(ctx) ((ucontext_t*)(ctx))->uc_mcontext->__es.__err
+#define CTX_PC(ctx) ((ucontext_t*)(ctx))->uc_mcontext->__ss.__rip
+#define CTX_SP(ctx) ((ucontext_t*)(ctx))->uc_mcontext->__ss.__rsp
+#elif defined(__FreeBSD__)
+#define CTX_FLAGS(ctx) ((ucontext_t*)(ctx))->uc_mcontext.mc_rflags
+#define CTX_ERR(ctx) ((ucontext_t*)(ctx))->uc_mcontext.mc_err
+#define CTX_PC(ctx) ((ucontext_t*)(ctx))->uc_mcontext.mc_rip
+#define CTX_SP(ctx) ((ucontext_t*)(ctx))->uc_mcontext.mc_rsp
+#else
+#define CTX_FLAGS(ctx) ((ucontext_t*)(ctx))->uc_mcontext.gregs[REG_EFL]
+#define CTX_ERR(ctx) ((ucontext_t*)(ctx))->uc_mcontext.gregs[REG_ERR]
+#define CTX_PC(ctx) ((ucontext_t*)(ctx))->uc_mcontext.gregs[REG_RIP]
+#define CTX_SP(ctx) ((ucontext_t*)(ctx))->uc_mcontext.gregs[REG_RSP]
+#endif
+#endif
+
+#ifdef CTX_SP
+// Makes the interrupted thread call `target` from its current instruction.  Pushing the return
+// address keeps the stack aligned the way the callee expects.
+static void SysRedirectContext(void* ctx, uptr target)
+{
+	CTX_SP(ctx) -= sizeof(uptr);
+	*reinterpret_cast<uptr*>(CTX_SP(ctx)) = static_cast<uptr>(CTX_PC(ctx));
+	CTX_PC(ctx) = target;
+}
+#endif
+
+static void SysSingleStepSignalFilter(int signal, siginfo_t* siginfo, void* ctx)
+{
+#ifdef CTX_FLAGS
+	if (s_step_callback)
+	{
+		CTX_FLAGS(ctx) &= ~X86_TRAP_FLAG;
+
+		SrcType_PageFault::StepCallback callback = s_step_callback;
+		s_step_callback = nullptr;
+
+		std::unique_lock lock(PageFault_Mutex);
+		if (const uptr target = callback())
+			SysRedirectContext(ctx, target);
+		return;
+	}
+#endif
+
+	// Not ours, most likely a breakpoint instruction.  Let the default action deal with it.
+	::signal(signal, SIG_DFL);
+	raise(signal);
+}
 
 // Linux implementation of SIGSEGV handler.  Bind it using sigaction().
-static void SysPageFaultSignalFilter(int signal, siginfo_t* siginfo, void*)
+static void SysPageFaultSignalFilter(int signal, siginfo_t* siginfo, void* ctx)
 {
 	// [TODO] : Add a thread ID filter to the Linux Signal handler here.
 	// Rationale: On windows, the __try/__except model allows per-thread specific behavior
@@ -62,12 +119,31 @@ static void SysPageFaultSignalFilter(int signal, siginfo_t* siginfo, void*)
 	// so for now we lock this exception code unless someone can fix this better...
 	std::unique_lock lock(PageFault_Mutex);
 
-	Source_PageFault->Dispatch(PageFaultInfo((uptr)siginfo->si_addr & ~m_pagemask));
+#ifdef CTX_ERR
+	const bool is_write = (CTX_ERR(ctx) & X86_PF_WRITE) != 0;
+	const uptr pc = (uptr)CTX_PC(ctx);
+#else
+	const bool is_write = false;
+	const uptr pc = 0;
+#endif
+
+	Source_PageFault->Dispatch(PageFaultInfo((uptr)siginfo->si_addr, is_write, pc));
 
 	// resumes execution right where we left off (re-executes instruction that
 	// caused the SIGSEGV).
 	if (Source_PageFault->WasHandled())
+	{
+#ifdef CTX_FLAGS
+		if (Source_PageFault->GetRedirect())
+			SysRedirectContext(ctx, Source_PageFault->GetRedirect());
+		else if (Source_PageFault->GetSingleStepCallback())
+		{
+			s_step_callback = Source_PageFault->GetSingleStepCallback();
+			CTX_FLAGS(ctx) |= X86_TRAP_FLAG;
+		}
+#endif
 		return;
+	}
 
 	std::fprintf(stderr, "Unhandled page fault @ 0x%08x", siginfo->si_addr);
 	pxFailRel("Unhandled page fault");
@@ -94,6 +170,9 @@ void _platform_InstallSignalHandler()
 #else
 	sigaction(SIGSEGV, &sa, NULL);
 #endif
+
+	sa.sa_sigaction = SysSingleStepSignalFilter;
+	sigaction(SIGTRAP, &sa, NULL);
 }
 
 // returns FALSE if the mprotect call fails with an ENOMEM.
@@ -20,7 +20,9 @@
 
 #include <memory>
 
+#include <cerrno>
 #include <pthread.h>
+#include <time.h>
 #include <unistd.h>
 #if defined(__linux__)
 #include <sys/prctl.h>
@@ -59,6 +61,17 @@ __forceinline void Threading::Sleep(int ms)
 	usleep(1000 * ms);
 }
 
+void Threading::SleepUntil(u64 ticks)
+{
+	// GetCPUTicks() is CLOCK_MONOTONIC in nanoseconds, so we can hand the deadline straight
+	// to the kernel rather than converting to a relative sleep and losing precision.
+	struct timespec ts;
+	ts.tv_sec = static_cast<time_t>(ticks / 1000000000ULL);
+	ts.tv_nsec = static_cast<long>(ticks % 1000000000ULL);
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+		;
+}
+
 __forceinline void Threading::Timeslice()
 {
 	sched_yield();
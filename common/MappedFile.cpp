@@ -0,0 +1,153 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+
+#include "MappedFile.h"
+#include "StringUtil.h"
+
+#ifdef _WIN32
+#include "RedtapeWindows.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <utility>
+
+MappedFile::MappedFile() = default;
+
+MappedFile::MappedFile(MappedFile&& move)
+{
+	*this = std::move(move);
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& move)
+{
+	if (this == &move)
+		return *this;
+
+	Close();
+	m_data = std::exchange(move.m_data, nullptr);
+	m_size = std::exchange(move.m_size, 0);
+	m_copy_on_write = std::exchange(move.m_copy_on_write, false);
+#ifdef _WIN32
+	m_file_mapping = std::exchange(move.m_file_mapping, nullptr);
+#endif
+	return *this;
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const char* path, bool copy_on_write)
+{
+	Close();
+
+	// Whoever uses a copy-on-write view usually writes the file through its own handle.
+	const DWORD share_mode = copy_on_write ? (FILE_SHARE_READ | FILE_SHARE_WRITE) : FILE_SHARE_READ;
+	const HANDLE file = CreateFileW(StringUtil::UTF8StringToWideString(path).c_str(), GENERIC_READ, share_mode,
+		nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	// The mapping holds its own reference to the file.
+	const HANDLE mapping = CreateFileMappingW(file, nullptr, copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping)
+		return false;
+
+	void* view = MapViewOfFile(mapping, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+	if (!view)
+	{
+		CloseHandle(mapping);
+		return false;
+	}
+
+	m_data = static_cast<const u8*>(view);
+	m_size = static_cast<size_t>(size.QuadPart);
+	m_copy_on_write = copy_on_write;
+	m_file_mapping = mapping;
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (m_data)
+		UnmapViewOfFile(m_data);
+	if (m_file_mapping)
+		CloseHandle(m_file_mapping);
+
+	m_data = nullptr;
+	m_size = 0;
+	m_copy_on_write = false;
+	m_file_mapping = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const char* path, bool copy_on_write)
+{
+	Close();
+
+	const int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return false;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size <= 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	// The mapping stays valid after the descriptor is closed.
+	void* view = copy_on_write ?
+		mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) :
+		mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (view == MAP_FAILED)
+		return false;
+
+	m_data = static_cast<const u8*>(view);
+	m_size = static_cast<size_t>(st.st_size);
+	m_copy_on_write = copy_on_write;
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (m_data)
+		munmap(const_cast<u8*>(m_data), m_size);
+
+	m_data = nullptr;
+	m_size = 0;
+	m_copy_on_write = false;
+}
+
+#endif
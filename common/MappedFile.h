@@ -0,0 +1,52 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Pcsx2Defs.h"
+
+/// Read-only view of a whole file through the host's virtual memory system.
+/// Pages are only faulted in when touched, so looking at a small part of a large
+/// file doesn't pay for reading the rest of it. Copy-on-write views can also be
+/// modified, which only changes the view and never the file.
+class MappedFile final
+{
+public:
+	MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile(MappedFile&& move);
+	~MappedFile();
+
+	MappedFile& operator=(const MappedFile&) = delete;
+	MappedFile& operator=(MappedFile&& move);
+
+	__fi bool IsOpen() const { return (m_data != nullptr); }
+	__fi const u8* GetData() const { return m_data; }
+	__fi u8* GetMutableData() const { return m_copy_on_write ? const_cast<u8*>(m_data) : nullptr; }
+	__fi size_t GetSize() const { return m_size; }
+
+	/// Maps the specified file, closing any previously-mapped file. Empty files can't be mapped.
+	bool Open(const char* path, bool copy_on_write = false);
+	void Close();
+
+private:
+	const u8* m_data = nullptr;
+	size_t m_size = 0;
+	bool m_copy_on_write = false;
+
+#ifdef _WIN32
+	void* m_file_mapping = nullptr;
+#endif
+};
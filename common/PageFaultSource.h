@@ -35,10 +35,14 @@
 struct PageFaultInfo
 {
 	uptr addr;
+	bool write; // only meaningful on hosts that report the access type (x86 Linux/macOS and Windows)
+	uptr pc;    // address of the faulting instruction, 0 if the host doesn't report it
 
-	PageFaultInfo(uptr address)
+	PageFaultInfo(uptr address, bool is_write = false, uptr fault_pc = 0)
 	{
 		addr = address;
+		write = is_write;
+		pc = fault_pc;
 	}
 };
 
@@ -110,12 +114,20 @@ class SrcType_PageFault : public EventSource<IEventListener_PageFault>
 protected:
 	typedef EventSource<IEventListener_PageFault> _parent;
 
+public:
+	// Returns an address to continue at instead of the next instruction (see RequestRedirect), or 0.
+	typedef uptr (*StepCallback)();
+
 protected:
 	bool m_handled;
+	StepCallback m_step_callback;
+	uptr m_redirect;
 
 public:
 	SrcType_PageFault()
 		: m_handled(false)
+		, m_step_callback(nullptr)
+		, m_redirect(0)
 	{
 	}
 	virtual ~SrcType_PageFault() = default;
@@ -123,6 +135,17 @@ public:
 	bool WasHandled() const { return m_handled; }
 	virtual void Dispatch(const PageFaultInfo& params);
 
+	// Asks the platform handler to resume the faulting instruction in single-step mode and to call
+	// `callback` (on the faulting thread) once it has executed, so a listener which opened up a
+	// page for one access can close it again straight after.
+	void RequestSingleStep(StepCallback callback) { m_step_callback = callback; }
+	StepCallback GetSingleStepCallback() const { return m_step_callback; }
+
+	// Asks the platform handler to continue at `target` instead of retrying the faulting instruction,
+	// as if that instruction had called it.  `target` must not return.
+	void RequestRedirect(uptr target) { m_redirect = target; }
+	uptr GetRedirect() const { return m_redirect; }
+
 protected:
 	virtual void _DispatchRaw(ListenerIterator iter, const ListenerIterator& iend, const PageFaultInfo& evt);
 };
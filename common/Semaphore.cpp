@@ -47,7 +47,7 @@ void Threading::WorkSema::WaitForWork()
 	}
 }
 
-void Threading::WorkSema::WaitForWorkWithSpin()
+bool Threading::WorkSema::WaitForWorkWithSpin(u32 spin_ns)
 {
 	s32 value = m_state.load(std::memory_order_relaxed);
 	pxAssert(!IsDead(value));
@@ -62,13 +62,15 @@ void Threading::WorkSema::WaitForWorkWithSpin()
 		}
 	}
 	u32 waited = 0;
+	bool slept = false;
 	while (value < 0)
 	{
-		if (waited > SPIN_TIME_NS)
+		if (waited >= spin_ns)
 		{
 			if (!m_state.compare_exchange_weak(value, STATE_SLEEPING, std::memory_order_relaxed))
 				continue;
 			m_sema.Wait();
+			slept = true;
 			break;
 		}
 		waited += ShortSpin();
@@ -76,6 +78,7 @@ void Threading::WorkSema::WaitForWorkWithSpin()
 	}
 	// Clear back to STATE_RUNNING_0 (but preserve waiting empty flag)
 	m_state.fetch_and(STATE_FLAG_WAITING_EMPTY, std::memory_order_acquire);
+	return slept;
 }
 
 bool Threading::WorkSema::WaitForEmpty()
@@ -94,7 +97,7 @@ bool Threading::WorkSema::WaitForEmpty()
 	return !IsDead(m_state.load(std::memory_order_relaxed));
 }
 
-bool Threading::WorkSema::WaitForEmptyWithSpin()
+bool Threading::WorkSema::WaitForEmptyWithSpin(u32 spin_ns)
 {
 	s32 value = m_state.load(std::memory_order_acquire);
 	u32 waited = 0;
@@ -102,7 +105,7 @@ bool Threading::WorkSema::WaitForEmptyWithSpin()
 	{
 		if (value < 0)
 			return !IsDead(value); // STATE_SLEEPING or STATE_SPINNING, queue is empty!
-		if (waited > SPIN_TIME_NS && m_state.compare_exchange_weak(value, value | STATE_FLAG_WAITING_EMPTY, std::memory_order_acquire))
+		if (waited >= spin_ns && m_state.compare_exchange_weak(value, value | STATE_FLAG_WAITING_EMPTY, std::memory_order_acquire))
 			break;
 		waited += ShortSpin();
 		value = m_state.load(std::memory_order_acquire);
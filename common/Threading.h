@@ -55,6 +55,10 @@ namespace Threading
 	// sleeps the current thread for the given number of milliseconds.
 	extern void Sleep(int ms);
 
+	// sleeps the current thread until GetCPUTicks() reaches the given value. How close to the
+	// deadline the thread wakes up depends on the OS timers, it's usually a little late.
+	extern void SleepUntil(u64 ticks);
+
 	// --------------------------------------------------------------------------------------
 	//  ThreadHandle
 	// --------------------------------------------------------------------------------------
@@ -213,14 +217,15 @@ namespace Threading
 
 		/// Wait for work to be added to the queue
 		void WaitForWork();
-		/// Wait for work to be added to the queue, spinning for a bit before sleeping the thread
-		void WaitForWorkWithSpin();
+		/// Wait for work to be added to the queue, spinning for up to spin_ns before sleeping the thread
+		/// Returns true if the thread had to sleep
+		bool WaitForWorkWithSpin(u32 spin_ns = SPIN_TIME_NS);
 		/// Wait for the worker thread to finish processing all entries in the queue or die
 		/// Returns false if the thread is dead
 		bool WaitForEmpty();
-		/// Wait for the worker thread to finish processing all entries in the queue or die, spinning a bit before sleeping the thread
+		/// Wait for the worker thread to finish processing all entries in the queue or die, spinning for up to spin_ns before sleeping the thread
 		/// Returns false if the thread is dead
-		bool WaitForEmptyWithSpin();
+		bool WaitForEmptyWithSpin(u32 spin_ns = SPIN_TIME_NS);
 		/// Called by the worker thread to notify others of its death
 		/// Dead threads don't process work, and WaitForEmpty will return instantly even though there may be work in the queue
 		void Kill();
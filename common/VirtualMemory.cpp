@@ -57,6 +57,8 @@ EventListener_PageFault::~EventListener_PageFault()
 void SrcType_PageFault::Dispatch(const PageFaultInfo& params)
 {
 	m_handled = false;
+	m_step_callback = nullptr;
+	m_redirect = 0;
 	_parent::Dispatch(params);
 }
 
@@ -22,8 +22,31 @@
 #include "common/StringUtil.h"
 #include "common/AlignedMalloc.h"
 
+// Callback requested by a page fault listener, run once the faulting instruction has been single-stepped.
+static thread_local SrcType_PageFault::StepCallback s_step_callback = nullptr;
+
+// Makes the interrupted thread call `target` from its current instruction.  Pushing the return
+// address keeps the stack aligned the way the callee expects.
+static void SysRedirectContext(CONTEXT* ctx, uptr target)
+{
+	ctx->Rsp -= sizeof(uptr);
+	*reinterpret_cast<uptr*>(ctx->Rsp) = ctx->Rip;
+	ctx->Rip = target;
+}
+
 static long DoSysPageFaultExceptionFilter(EXCEPTION_POINTERS* eps)
 {
+	if (eps->ExceptionRecord->ExceptionCode == EXCEPTION_SINGLE_STEP && s_step_callback)
+	{
+		SrcType_PageFault::StepCallback callback = s_step_callback;
+		s_step_callback = nullptr;
+
+		std::unique_lock lock(PageFault_Mutex);
+		if (const uptr target = callback())
+			SysRedirectContext(eps->ContextRecord, target);
+		return EXCEPTION_CONTINUE_EXECUTION;
+	}
+
 	if (eps->ExceptionRecord->ExceptionCode != EXCEPTION_ACCESS_VIOLATION)
 		return EXCEPTION_CONTINUE_SEARCH;
 
@@ -31,8 +54,23 @@ static long DoSysPageFaultExceptionFilter(EXCEPTION_POINTERS* eps)
 	// Source_PageFault is a global variable with its own state information
 	// so for now we lock this exception code unless someone can fix this better...
 	std::unique_lock lock(PageFault_Mutex);
-	Source_PageFault->Dispatch(PageFaultInfo((uptr)eps->ExceptionRecord->ExceptionInformation[1]));
-	return Source_PageFault->WasHandled() ? EXCEPTION_CONTINUE_EXECUTION : EXCEPTION_CONTINUE_SEARCH;
+	Source_PageFault->Dispatch(PageFaultInfo((uptr)eps->ExceptionRecord->ExceptionInformation[1],
+		eps->ExceptionRecord->ExceptionInformation[0] == 1, (uptr)eps->ExceptionRecord->ExceptionAddress));
+
+	if (!Source_PageFault->WasHandled())
+		return EXCEPTION_CONTINUE_SEARCH;
+
+	if (Source_PageFault->GetRedirect())
+	{
+		SysRedirectContext(eps->ContextRecord, Source_PageFault->GetRedirect());
+	}
+	else if (Source_PageFault->GetSingleStepCallback())
+	{
+		s_step_callback = Source_PageFault->GetSingleStepCallback();
+		eps->ContextRecord->EFlags |= 0x100; // trap flag
+	}
+
+	return EXCEPTION_CONTINUE_EXECUTION;
 }
 
 long __stdcall SysPageFaultExceptionFilter(EXCEPTION_POINTERS* eps)
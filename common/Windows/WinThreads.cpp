@@ -26,6 +26,45 @@ __fi void Threading::Sleep(int ms)
 	::Sleep(ms);
 }
 
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+void Threading::SleepUntil(u64 ticks)
+{
+	const u64 now = GetCPUTicks();
+	if (ticks <= now)
+		return;
+
+	// High resolution timers are only available on Windows 10 1803+, otherwise we're stuck
+	// with the scheduler granularity of Sleep().
+	struct WaitableTimer
+	{
+		HANDLE handle = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+		~WaitableTimer()
+		{
+			if (handle)
+				CloseHandle(handle);
+		}
+	};
+	static thread_local WaitableTimer timer;
+
+	const u64 diff = ticks - now;
+	if (timer.handle)
+	{
+		// negative due times are relative, in 100ns units
+		LARGE_INTEGER due;
+		due.QuadPart = -static_cast<s64>((diff * 10000000ULL) / GetTickFrequency());
+		if (SetWaitableTimer(timer.handle, &due, 0, nullptr, nullptr, FALSE))
+		{
+			WaitForSingleObject(timer.handle, INFINITE);
+			return;
+		}
+	}
+
+	::Sleep(static_cast<DWORD>((diff * 1000) / GetTickFrequency()));
+}
+
 __fi void Threading::Timeslice()
 {
 	::Sleep(0);
@@ -0,0 +1,185 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/emitter/internal.h"
+#include "common/emitter/tools.h"
+
+namespace x86Emitter
+{
+
+	const xImplAVX_ArithFloat xVADD = {
+		{0x00, 0x0F, 0x58}, // PS
+		{0x66, 0x0F, 0x58}, // PD
+		{0xF3, 0x0F, 0x58}, // SS
+		{0xF2, 0x0F, 0x58}, // SD
+	};
+	const xImplAVX_ArithFloat xVSUB = {
+		{0x00, 0x0F, 0x5C}, // PS
+		{0x66, 0x0F, 0x5C}, // PD
+		{0xF3, 0x0F, 0x5C}, // SS
+		{0xF2, 0x0F, 0x5C}, // SD
+	};
+	const xImplAVX_ArithFloat xVMUL = {
+		{0x00, 0x0F, 0x59}, // PS
+		{0x66, 0x0F, 0x59}, // PD
+		{0xF3, 0x0F, 0x59}, // SS
+		{0xF2, 0x0F, 0x59}, // SD
+	};
+	const xImplAVX_ArithFloat xVDIV = {
+		{0x00, 0x0F, 0x5E}, // PS
+		{0x66, 0x0F, 0x5E}, // PD
+		{0xF3, 0x0F, 0x5E}, // SS
+		{0xF2, 0x0F, 0x5E}, // SD
+	};
+	const xImplAVX_ArithFloat xVMIN = {
+		{0x00, 0x0F, 0x5D}, // PS
+		{0x66, 0x0F, 0x5D}, // PD
+		{0xF3, 0x0F, 0x5D}, // SS
+		{0xF2, 0x0F, 0x5D}, // SD
+	};
+	const xImplAVX_ArithFloat xVMAX = {
+		{0x00, 0x0F, 0x5F}, // PS
+		{0x66, 0x0F, 0x5F}, // PD
+		{0xF3, 0x0F, 0x5F}, // SS
+		{0xF2, 0x0F, 0x5F}, // SD
+	};
+
+	const xImplAVX_Logic xVAND = {{0x00, 0x0F, 0x54}, {0x66, 0x0F, 0x54}};
+	const xImplAVX_Logic xVANDN = {{0x00, 0x0F, 0x55}, {0x66, 0x0F, 0x55}};
+	const xImplAVX_Logic xVOR = {{0x00, 0x0F, 0x56}, {0x66, 0x0F, 0x56}};
+	const xImplAVX_Logic xVXOR = {{0x00, 0x0F, 0x57}, {0x66, 0x0F, 0x57}};
+
+	const xImplAVX_ThreeArg xVPAND = {0x66, 0x0F, 0xDB};
+	const xImplAVX_ThreeArg xVPANDN = {0x66, 0x0F, 0xDF};
+	const xImplAVX_ThreeArg xVPOR = {0x66, 0x0F, 0xEB};
+	const xImplAVX_ThreeArg xVPXOR = {0x66, 0x0F, 0xEF};
+	const xImplAVX_ThreeArg xVPADDD = {0x66, 0x0F, 0xFE};
+	const xImplAVX_ThreeArg xVPCMPEQD = {0x66, 0x0F, 0x76};
+	const xImplAVX_ThreeArg xVPCMPGTD = {0x66, 0x0F, 0x66};
+	const xImplAVX_ThreeArg xVUNPCKLPS = {0x00, 0x0F, 0x14};
+	const xImplAVX_ThreeArg xVUNPCKHPS = {0x00, 0x0F, 0x15};
+
+	const xImplAVX_ThreeArgImm xVBLENDPS = {0x66, 0x3A, 0x0C};
+	const xImplAVX_ThreeArgImm xVSHUFPS = {0x00, 0x0F, 0xC6};
+
+	const xImplAVX_Move xVMOVAPS = {0x00, 0x28, 0x29};
+	const xImplAVX_Move xVMOVUPS = {0x00, 0x10, 0x11};
+
+	const xImplAVX_PMove xVPMOVSX = {0x20};
+	const xImplAVX_PMove xVPMOVZX = {0x30};
+
+	const xImplAVX_ShiftImm xVPSRAD = {0x72, 4};
+	const xImplAVX_ShiftImm xVPSRLD = {0x72, 2};
+	const xImplAVX_ShiftImm xVPSLLD = {0x72, 6};
+
+	void xImplAVX_ThreeArg::operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xRegisterSSE& from2) const
+	{
+		EmitVex(Prefix, MbPrefix, to, from1.Id, from2);
+		xWrite8(Opcode);
+		EmitSibMagic(to, from2);
+	}
+	void xImplAVX_ThreeArg::operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xIndirectVoid& from2) const
+	{
+		EmitVex(Prefix, MbPrefix, to, from1.Id, from2);
+		xWrite8(Opcode);
+		EmitSibMagic(to, from2);
+	}
+
+	void xImplAVX_ThreeArgImm::operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xRegisterSSE& from2, u8 imm) const
+	{
+		EmitVex(Prefix, MbPrefix, to, from1.Id, from2);
+		xWrite8(Opcode);
+		EmitSibMagic(to, from2);
+		xWrite8(imm);
+	}
+	void xImplAVX_ThreeArgImm::operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xIndirectVoid& from2, u8 imm) const
+	{
+		EmitVex(Prefix, MbPrefix, to, from1.Id, from2);
+		xWrite8(Opcode);
+		EmitSibMagic(to, from2, 1);
+		xWrite8(imm);
+	}
+
+	void xImplAVX_ShiftImm::operator()(const xRegisterSSE& to, const xRegisterSSE& from, u8 imm) const
+	{
+		// ModRM.reg is the opcode extension, which never needs VEX.R
+		EmitVex(0x66, 0x0F, xRegisterSSE(Modcode), to.Id, from);
+		xWrite8(Opcode);
+		EmitSibMagic(Modcode, from);
+		xWrite8(imm);
+	}
+
+	void xImplAVX_Move::operator()(const xRegisterSSE& to, const xRegisterSSE& from) const
+	{
+		if (to == from)
+			return;
+		EmitVex(Prefix, 0x0F, to, 0, from);
+		xWrite8(LoadOpcode);
+		EmitSibMagic(to, from);
+	}
+	void xImplAVX_Move::operator()(const xRegisterSSE& to, const xIndirectVoid& from) const
+	{
+		EmitVex(Prefix, 0x0F, to, 0, from);
+		xWrite8(LoadOpcode);
+		EmitSibMagic(to, from);
+	}
+	void xImplAVX_Move::operator()(const xIndirectVoid& to, const xRegisterSSE& from) const
+	{
+		EmitVex(Prefix, 0x0F, from, 0, to);
+		xWrite8(StoreOpcode);
+		EmitSibMagic(from, to);
+	}
+
+	void xImplAVX_PMove::BD(const xRegisterSSE& to, const xIndirectVoid& from) const
+	{
+		EmitVex(0x66, 0x38, to, 0, from);
+		xWrite8(OpcodeBase + 1);
+		EmitSibMagic(to, from);
+	}
+	void xImplAVX_PMove::WD(const xRegisterSSE& to, const xIndirectVoid& from) const
+	{
+		EmitVex(0x66, 0x38, to, 0, from);
+		xWrite8(OpcodeBase + 3);
+		EmitSibMagic(to, from);
+	}
+
+	// [AVX] Selects dwords from from2 where the sign bit of mask is set, else from from1.
+	// The mask register is encoded in the upper nibble of the trailing immediate.
+	void xVBLENDVPS(const xRegisterSSE& to, const xRegisterSSE& from1, const xRegisterSSE& from2, const xRegisterSSE& mask)
+	{
+		EmitVex(0x66, 0x3A, to, from1.Id, from2);
+		xWrite8(0x4A);
+		EmitSibMagic(to, from2);
+		xWrite8(mask.Id << 4);
+	}
+
+	// [AVX] Loads a single float from memory and broadcasts it to all four elements.
+	void xVBROADCASTSS(const xRegisterSSE& to, const xIndirect32& from)
+	{
+		EmitVex(0x66, 0x38, to, 0, from);
+		xWrite8(0x18);
+		EmitSibMagic(to, from);
+	}
+
+	// [AVX] Zeroes the upper half of all ymm registers, avoiding the SSE/AVX transition
+	// penalty when returning to code using legacy SSE encodings.
+	void xVZEROUPPER()
+	{
+		xWrite8(0xC5);
+		xWrite8(0xF8);
+		xWrite8(0x77);
+	}
+
+} // namespace x86Emitter
@@ -0,0 +1,117 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Implement VEX encoded (AVX) forms of the SSE instructions.
+// All of these are non-destructive: dest = from1 <op> from2.  Callers are expected
+// to check x86caps.hasAVX before emitting any of them.
+
+namespace x86Emitter
+{
+
+	// --------------------------------------------------------------------------------------
+	//  xImplAVX_ThreeArg
+	// --------------------------------------------------------------------------------------
+	// RVM form: to = ModRM.reg, from1 = VEX.vvvv, from2 = ModRM.rm
+	//
+	struct xImplAVX_ThreeArg
+	{
+		u8 Prefix;
+		u8 MbPrefix;
+		u8 Opcode;
+
+		void operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xRegisterSSE& from2) const;
+		void operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xIndirectVoid& from2) const;
+	};
+
+	// --------------------------------------------------------------------------------------
+	//  xImplAVX_ThreeArgImm
+	// --------------------------------------------------------------------------------------
+	// RVMI form (VBLENDPS, VSHUFPS)
+	//
+	struct xImplAVX_ThreeArgImm
+	{
+		u8 Prefix;
+		u8 MbPrefix;
+		u8 Opcode;
+
+		void operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xRegisterSSE& from2, u8 imm) const;
+		void operator()(const xRegisterSSE& to, const xRegisterSSE& from1, const xIndirectVoid& from2, u8 imm) const;
+	};
+
+	// --------------------------------------------------------------------------------------
+	//  xImplAVX_ShiftImm
+	// --------------------------------------------------------------------------------------
+	// VMI form: to = VEX.vvvv, from = ModRM.rm, ModRM.reg holds the opcode extension.
+	//
+	struct xImplAVX_ShiftImm
+	{
+		u8 Opcode;
+		u8 Modcode;
+
+		void operator()(const xRegisterSSE& to, const xRegisterSSE& from, u8 imm) const;
+	};
+
+	// --------------------------------------------------------------------------------------
+	//  xImplAVX_Move
+	// --------------------------------------------------------------------------------------
+	// Loads and stores, accepts both xmm and ymm registers.
+	//
+	struct xImplAVX_Move
+	{
+		u8 Prefix;
+		u8 LoadOpcode;
+		u8 StoreOpcode;
+
+		void operator()(const xRegisterSSE& to, const xRegisterSSE& from) const;
+		void operator()(const xRegisterSSE& to, const xIndirectVoid& from) const;
+		void operator()(const xIndirectVoid& to, const xRegisterSSE& from) const;
+	};
+
+	// --------------------------------------------------------------------------------------
+	//  xImplAVX_PMove
+	// --------------------------------------------------------------------------------------
+	// Packed move with sign or zero extension.  The ymm forms require AVX2.
+	//
+	struct xImplAVX_PMove
+	{
+		u8 OpcodeBase;
+
+		// [AVX2] Extends 8 packed bytes (4 for xmm) into dwords
+		void BD(const xRegisterSSE& to, const xIndirectVoid& from) const;
+
+		// [AVX2] Extends 8 packed words (4 for xmm) into dwords
+		void WD(const xRegisterSSE& to, const xIndirectVoid& from) const;
+	};
+
+	// --------------------------------------------------------------------------------------
+	//  xImplAVX_ArithFloat / xImplAVX_Logic
+	// --------------------------------------------------------------------------------------
+	struct xImplAVX_ArithFloat
+	{
+		xImplAVX_ThreeArg PS;
+		xImplAVX_ThreeArg PD;
+		xImplAVX_ThreeArg SS;
+		xImplAVX_ThreeArg SD;
+	};
+
+	struct xImplAVX_Logic
+	{
+		xImplAVX_ThreeArg PS;
+		xImplAVX_ThreeArg PD;
+	};
+
+} // namespace x86Emitter
@@ -122,6 +122,22 @@ namespace x86Emitter
 	// BMI extra instruction requires BMI1/BMI2
 	extern const xImplBMI_RVM xMULX, xPDEP, xPEXT, xANDN_S; // Warning xANDN is already used by SSE
 
+	// ------------------------------------------------------------------------
+	// AVX three-operand (VEX encoded) forms, requires AVX
+	extern const xImplAVX_ArithFloat xVADD, xVSUB, xVMUL, xVDIV, xVMIN, xVMAX;
+	extern const xImplAVX_Logic xVAND, xVANDN, xVOR, xVXOR;
+	extern const xImplAVX_ThreeArg xVPAND, xVPANDN, xVPOR, xVPXOR, xVPADDD, xVPCMPEQD, xVPCMPGTD;
+	extern const xImplAVX_ThreeArg xVUNPCKLPS, xVUNPCKHPS;
+	extern const xImplAVX_ThreeArgImm xVBLENDPS, xVSHUFPS;
+	extern const xImplAVX_ShiftImm xVPSRAD, xVPSRLD, xVPSLLD;
+
+	extern const xImplAVX_Move xVMOVAPS, xVMOVUPS;
+	extern const xImplAVX_PMove xVPMOVSX, xVPMOVZX;
+
+	extern void xVBLENDVPS(const xRegisterSSE& to, const xRegisterSSE& from1, const xRegisterSSE& from2, const xRegisterSSE& mask);
+	extern void xVBROADCASTSS(const xRegisterSSE& to, const xIndirect32& from);
+	extern void xVZEROUPPER();
+
 	//////////////////////////////////////////////////////////////////////////////////////////
 	// Miscellaneous Instructions
 	// These are all defined inline or in ix86.cpp.
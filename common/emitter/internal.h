@@ -38,6 +38,10 @@ namespace x86Emitter
 	extern void EmitRex(const xRegisterBase& reg1, const void* src);
 	extern void EmitRex(const xRegisterBase& reg1, const xIndirectVoid& sib);
 
+	// VEX prefix for reg1 (ModRM.reg), vvvv (extra source register id) and reg2/sib (ModRM.rm)
+	extern void EmitVex(u8 prefix, u8 mb_prefix, const xRegisterBase& reg1, int vvvv, const xRegisterBase& reg2);
+	extern void EmitVex(u8 prefix, u8 mb_prefix, const xRegisterBase& reg1, int vvvv, const xIndirectVoid& sib);
+
 	extern void _xMovRtoR(const xRegisterInt& to, const xRegisterInt& from);
 
 	template <typename T>
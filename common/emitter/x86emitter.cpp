@@ -120,6 +120,16 @@ const xRegisterSSE
     xmm12(12), xmm13(13),
     xmm14(14), xmm15(15);
 
+const xRegisterYMM
+    ymm0(0), ymm1(1),
+    ymm2(2), ymm3(3),
+    ymm4(4), ymm5(5),
+    ymm6(6), ymm7(7),
+    ymm8(8), ymm9(9),
+    ymm10(10), ymm11(11),
+    ymm12(12), ymm13(13),
+    ymm14(14), ymm15(15);
+
 const xAddressReg
     rax(0), rbx(3),
     rcx(1), rdx(2),
@@ -226,6 +236,14 @@ const xRegister32
 		"xmm12", "xmm13", "xmm14", "xmm15"
 	};
 
+	const char* const x86_regnames_avx[] =
+	{
+		"ymm0", "ymm1", "ymm2", "ymm3",
+		"ymm4", "ymm5", "ymm6", "ymm7",
+		"ymm8", "ymm9", "ymm10", "ymm11",
+		"ymm12", "ymm13", "ymm14", "ymm15"
+	};
+
 	const char* xRegisterBase::GetName()
 	{
 		if (Id == xRegId_Invalid)
@@ -250,6 +268,8 @@ const xRegister32
 				return x86_regnames_gpr64[Id];
 			case 16:
 				return x86_regnames_sse[Id];
+			case 32:
+				return x86_regnames_avx[Id];
 		}
 
 		return "oops?";
@@ -499,6 +519,58 @@ const xRegister32
 		EmitRex(w, r, x, b);
 	}
 
+	//////////////////////////////////////////////////////////////////////////////////////////
+	// VEX prefix, replacing both the legacy SIMD prefix and REX.  Uses the 2 byte form
+	// when the instruction lives in the 0F map and needs neither REX.X nor REX.B.
+	//
+	__emitinline static void EmitVex(u8 prefix, u8 mb_prefix, bool r, bool x, bool b, int vvvv, bool wide)
+	{
+		pxAssert(prefix == 0 || prefix == 0x66 || prefix == 0xF3 || prefix == 0xF2);
+		pxAssert(mb_prefix == 0x0F || mb_prefix == 0x38 || mb_prefix == 0x3A);
+
+		const u8 nv = (~vvvv & 0xF) << 3;
+		const u8 L = wide ? 4 : 0;
+		const u8 p =
+			prefix == 0xF2 ? 3 :
+			prefix == 0xF3 ? 2 :
+			prefix == 0x66 ? 1 :
+                             0;
+
+		if (mb_prefix == 0x0F && !x && !b)
+		{
+			xWrite8(0xC5);
+			xWrite8((r ? 0 : 0x80) | nv | L | p);
+		}
+		else
+		{
+			const u8 m =
+				mb_prefix == 0x3A ? 3 :
+				mb_prefix == 0x38 ? 2 :
+                                    1;
+
+			xWrite8(0xC4);
+			xWrite8((r ? 0 : 0x80) | (x ? 0 : 0x40) | (b ? 0 : 0x20) | m);
+			xWrite8(nv | L | p);
+		}
+	}
+
+	void EmitVex(u8 prefix, u8 mb_prefix, const xRegisterBase& reg1, int vvvv, const xRegisterBase& reg2)
+	{
+		EmitVex(prefix, mb_prefix, reg1.IsExtended(), false, reg2.IsExtended(), vvvv, reg1.IsWideSIMD());
+	}
+
+	void EmitVex(u8 prefix, u8 mb_prefix, const xRegisterBase& reg1, int vvvv, const xIndirectVoid& sib)
+	{
+		bool x = sib.Index.IsExtended();
+		bool b = sib.Base.IsExtended();
+		if (!NeedsSibMagic(sib))
+		{
+			b = x;
+			x = false;
+		}
+		EmitVex(prefix, mb_prefix, reg1.IsExtended(), x, b, vvvv, reg1.IsWideSIMD());
+	}
+
 	// For use by instructions that are implicitly wide
 	void EmitRexImplicitlyWide(const xRegisterBase& reg)
 	{
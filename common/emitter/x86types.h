@@ -435,6 +435,28 @@ namespace x86Emitter
 		bool operator!=(const xRegisterSSE& src) const { return this->Id != src.Id; }
 
 		static const inline xRegisterSSE& GetInstance(uint id);
+
+	protected:
+		xRegisterSSE(uint operandSize, int regId)
+			: _parent(operandSize, regId)
+		{
+		}
+	};
+
+	// --------------------------------------------------------------------------------------
+	//  xRegisterYMM  -  Represents a 256 bit AVX register
+	// --------------------------------------------------------------------------------------
+	// Only valid for the VEX encoded (xV*) instructions, which select the 256 bit form
+	// from the operand size.
+
+	class xRegisterYMM : public xRegisterSSE
+	{
+	public:
+		xRegisterYMM() = default;
+		explicit xRegisterYMM(int regId)
+			: xRegisterSSE(32, regId)
+		{
+		}
 	};
 
 	class xRegisterCL : public xRegister8
@@ -577,6 +599,12 @@ extern const xRegisterSSE
     xmm8, xmm9, xmm10, xmm11,
     xmm12, xmm13, xmm14, xmm15;
 
+extern const xRegisterYMM
+    ymm0, ymm1, ymm2, ymm3,
+    ymm4, ymm5, ymm6, ymm7,
+    ymm8, ymm9, ymm10, ymm11,
+    ymm12, ymm13, ymm14, ymm15;
+
 extern const xAddressReg
     rax, rbx, rcx, rdx,
     rsi, rdi, rbp, rsp,
@@ -949,3 +977,4 @@ extern const xRegister32
 #include "implement/jmpcall.h"
 
 #include "implement/bmi.h"
+#include "implement/avx.h"
@@ -0,0 +1,764 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pcsx2/PrecompiledHeader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/Assertions.h"
+#include "common/Console.h"
+#include "common/CrashHandler.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include "common/SettingsWrapper.h"
+#include "common/StringUtil.h"
+#include "common/Threading.h"
+#include "common/Timer.h"
+#include "common/WindowInfo.h"
+
+#include "fmt/core.h"
+
+#include "pcsx2/Frontend/ImGuiManager.h"
+#include "pcsx2/Frontend/INISettingsInterface.h"
+#include "pcsx2/Frontend/InputManager.h"
+#include "pcsx2/Frontend/LogSink.h"
+#include "pcsx2/GS.h"
+#include "pcsx2/GSDumpReplayer.h"
+#include "pcsx2/Host.h"
+#include "pcsx2/HostDisplay.h"
+#include "pcsx2/HostSettings.h"
+#include "pcsx2/PAD/Host/PAD.h"
+#include "pcsx2/PerformanceMetrics.h"
+#include "pcsx2/VMManager.h"
+
+// Nothing is ever shown, so this is only the size the display reports to the GS.
+static constexpr u32 WINDOW_WIDTH = 640;
+static constexpr u32 WINDOW_HEIGHT = 480;
+
+//////////////////////////////////////////////////////////////////////////
+// Local function declarations
+//////////////////////////////////////////////////////////////////////////
+namespace GSRunner
+{
+static void PrintCommandLineHelp(const char* progname);
+static bool ParseCommandLineOptions(int argc, char* argv[], std::vector<std::string>& dumps);
+static bool InitializeConfig();
+static void HookSignals();
+static void ExecutePendingCPUThreadFunctions();
+static bool RunDump(const std::string& path);
+static void ReportFrameStats(const std::string& path, const std::vector<GSDumpReplayer::FrameStats>& stats, double elapsed);
+static bool WriteFrameStatsCSV(const std::string& path, const std::vector<GSDumpReplayer::FrameStats>& stats);
+} // namespace GSRunner
+
+//////////////////////////////////////////////////////////////////////////
+// Local variable declarations
+//////////////////////////////////////////////////////////////////////////
+const IConsoleWriter* PatchesCon = &Console;
+static std::unique_ptr<INISettingsInterface> s_settings_interface;
+static std::unique_ptr<HostDisplay> s_host_display;
+static std::optional<GSRendererType> s_renderer;
+static std::string s_adapter;
+static std::string s_report_directory;
+static s32 s_loop_count = 1;
+static std::atomic_bool s_exit_requested{false};
+
+static std::thread::id s_cpu_thread_id;
+static std::mutex s_cpu_thread_functions_mutex;
+static std::condition_variable s_cpu_thread_functions_cv;
+static std::vector<std::function<void()>> s_cpu_thread_functions;
+static u64 s_cpu_thread_functions_queued = 0;
+static u64 s_cpu_thread_functions_completed = 0;
+
+static constexpr const struct
+{
+	const char* name;
+	GSRendererType type;
+} s_renderer_names[] = {
+	{"auto", GSRendererType::Auto},
+	{"sw", GSRendererType::SW},
+	{"null", GSRendererType::Null},
+	{"ogl", GSRendererType::OGL},
+	{"vk", GSRendererType::VK},
+#ifdef _WIN32
+	{"dx11", GSRendererType::DX11},
+	{"dx12", GSRendererType::DX12},
+#endif
+#ifdef __APPLE__
+	{"metal", GSRendererType::Metal},
+#endif
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Initialization/Shutdown
+//////////////////////////////////////////////////////////////////////////
+
+void GSRunner::PrintCommandLineHelp(const char* progname)
+{
+	std::fprintf(stderr, "PCSX2 GS Dump Runner\n");
+	std::fprintf(stderr, "https://pcsx2.net/\n");
+	std::fprintf(stderr, "\n");
+	std::fprintf(stderr, "Usage: %s [parameters] [--] <dump.gs> [dump.gs...]\n", progname);
+	std::fprintf(stderr, "\n");
+	std::fprintf(stderr, "  -help: Displays this information and exits.\n");
+	std::fprintf(stderr, "  -renderer <name>: Renderer to replay with. One of:");
+	for (const auto& it : s_renderer_names)
+		std::fprintf(stderr, " %s", it.name);
+	std::fprintf(stderr, ".\n");
+	std::fprintf(stderr, "  -adapter <name>: Uses the named GPU adapter, e.g. a software Vulkan device.\n");
+	std::fprintf(stderr, "  -loops <count>: Plays each dump this many times (default 1).\n");
+	std::fprintf(stderr, "  -report <directory>: Writes per-frame statistics for each dump to a CSV file.\n");
+	std::fprintf(stderr, "  --: Signals that no more arguments will follow and the remaining\n"
+						 "    parameters are dump filenames. Use when a filename starts with a dash.\n");
+	std::fprintf(stderr, "\n");
+}
+
+bool GSRunner::ParseCommandLineOptions(int argc, char* argv[], std::vector<std::string>& dumps)
+{
+	bool no_more_args = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!no_more_args)
+		{
+#define CHECK_ARG(str) !std::strcmp(argv[i], str)
+#define CHECK_ARG_PARAM(str) (!std::strcmp(argv[i], str) && ((i + 1) < argc))
+
+			if (CHECK_ARG("-help"))
+			{
+				PrintCommandLineHelp(argv[0]);
+				return false;
+			}
+			else if (CHECK_ARG_PARAM("-renderer"))
+			{
+				const char* name = argv[++i];
+				for (const auto& it : s_renderer_names)
+				{
+					if (StringUtil::Strcasecmp(it.name, name) == 0)
+						s_renderer = it.type;
+				}
+				if (!s_renderer.has_value())
+				{
+					std::fprintf(stderr, "Unknown renderer: '%s'\n", name);
+					return false;
+				}
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-adapter"))
+			{
+				s_adapter = argv[++i];
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-loops"))
+			{
+				s_loop_count = std::atoi(argv[++i]);
+				if (s_loop_count <= 0)
+				{
+					std::fprintf(stderr, "Loop count must be at least 1.\n");
+					return false;
+				}
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-report"))
+			{
+				s_report_directory = Path::Canonicalize(argv[++i]);
+				continue;
+			}
+			else if (CHECK_ARG("--"))
+			{
+				no_more_args = true;
+				continue;
+			}
+			else if (argv[i][0] == '-')
+			{
+				std::fprintf(stderr, "Unknown parameter: '%s'\n", argv[i]);
+				return false;
+			}
+
+#undef CHECK_ARG
+#undef CHECK_ARG_PARAM
+		}
+
+		dumps.emplace_back(argv[i]);
+	}
+
+	if (dumps.empty())
+	{
+		PrintCommandLineHelp(argv[0]);
+		return false;
+	}
+
+	return true;
+}
+
+bool GSRunner::InitializeConfig()
+{
+	EmuFolders::AppRoot = Path::Canonicalize(Path::GetDirectory(FileSystem::GetProgramPath()));
+#ifndef __APPLE__
+	EmuFolders::Resources = Path::Combine(EmuFolders::AppRoot, "resources");
+#else
+	EmuFolders::Resources = Path::Canonicalize(Path::Combine(EmuFolders::AppRoot, "../Resources"));
+#endif
+
+	// Keep everything next to the binary, we don't want to touch the user's configuration.
+	EmuFolders::DataRoot = EmuFolders::AppRoot;
+	EmuFolders::Settings = Path::Combine(EmuFolders::DataRoot, "inis");
+
+	if (!FileSystem::DirectoryExists(EmuFolders::Resources.c_str()))
+	{
+		Console.Error("Resources directory '%s' is missing, your installation is incomplete.", EmuFolders::Resources.c_str());
+		return false;
+	}
+
+	// Settings only live in memory, they're never saved.
+	s_settings_interface = std::make_unique<INISettingsInterface>(std::string());
+	Host::Internal::SetBaseSettingsLayer(s_settings_interface.get());
+
+	EmuConfig = Pcsx2Config();
+	EmuFolders::SetDefaults();
+	VMManager::SetHardwareDependentDefaultSettings(EmuConfig);
+
+	SettingsInterface& si = *s_settings_interface.get();
+	{
+		SettingsSaveWrapper wrapper(si);
+		EmuConfig.LoadSave(wrapper);
+	}
+
+	EmuFolders::Save(si);
+	PAD::SetDefaultConfig(si);
+
+	// Run as fast as the GS allows, with no audio and no input.
+	si.SetBoolValue("EmuCore/GS", "FrameLimitEnable", false);
+	si.SetIntValue("EmuCore/GS", "VsyncEnable", static_cast<int>(VsyncMode::Off));
+	si.SetBoolValue("EmuCore/GS", "SkipDuplicateFrames", false);
+	si.SetStringValue("SPU2/Output", "OutputModule", "nullout");
+	si.SetBoolValue("InputSources", "SDL", false);
+	si.SetBoolValue("InputSources", "XInput", false);
+	si.SetBoolValue("Logging", "EnableSystemConsole", true);
+	if (s_renderer.has_value())
+		si.SetIntValue("EmuCore/GS", "Renderer", static_cast<int>(s_renderer.value()));
+	if (!s_adapter.empty())
+		si.SetStringValue("EmuCore/GS", "Adapter", s_adapter.c_str());
+
+	EmuFolders::LoadConfig(si);
+
+	// Only the shader cache is written to.
+	if (!FileSystem::DirectoryExists(EmuFolders::Cache.c_str()))
+		FileSystem::CreateDirectoryPath(EmuFolders::Cache.c_str(), false);
+
+	if (!s_report_directory.empty() && !FileSystem::DirectoryExists(s_report_directory.c_str()) &&
+		!FileSystem::CreateDirectoryPath(s_report_directory.c_str(), true))
+	{
+		Console.Error("Failed to create report directory '%s'.", s_report_directory.c_str());
+		return false;
+	}
+
+	Host::UpdateLogging(false);
+	return true;
+}
+
+static void SignalHandler(int signal)
+{
+	// First try to stop after the current dump, then force it.
+	if (!s_exit_requested.load())
+	{
+		std::fprintf(stderr, "Received CTRL+C, stopping. Press CTRL+C again to force.\n");
+		s_exit_requested.store(true);
+
+		// This could be a bit risky invoking from a signal handler... hopefully it's okay.
+		if (VMManager::HasValidVM())
+			VMManager::SetState(VMState::Stopping);
+		return;
+	}
+
+	std::signal(signal, SIG_DFL);
+
+	// MacOS is missing std::quick_exit() despite it being C++11...
+#ifndef __APPLE__
+	std::quick_exit(1);
+#else
+	_Exit(1);
+#endif
+}
+
+void GSRunner::HookSignals()
+{
+	std::signal(SIGINT, SignalHandler);
+	std::signal(SIGTERM, SignalHandler);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Dump Playback
+//////////////////////////////////////////////////////////////////////////
+
+void GSRunner::ExecutePendingCPUThreadFunctions()
+{
+	std::unique_lock lock(s_cpu_thread_functions_mutex);
+	while (!s_cpu_thread_functions.empty())
+	{
+		std::vector<std::function<void()>> functions(std::move(s_cpu_thread_functions));
+		s_cpu_thread_functions.clear();
+		lock.unlock();
+
+		for (const std::function<void()>& func : functions)
+			func();
+
+		lock.lock();
+		s_cpu_thread_functions_completed += functions.size();
+		s_cpu_thread_functions_cv.notify_all();
+	}
+}
+
+bool GSRunner::RunDump(const std::string& path)
+{
+	Console.WriteLn(Color_StrongGreen, "Running GS dump '%s'...", path.c_str());
+
+	VMBootParameters params;
+	params.filename = path;
+
+	Common::Timer timer;
+	if (!VMManager::Initialize(params))
+	{
+		Console.Error("Failed to start '%s'.", path.c_str());
+		return false;
+	}
+
+	VMManager::SetState(VMState::Running);
+
+	for (;;)
+	{
+		ExecutePendingCPUThreadFunctions();
+
+		const VMState state = VMManager::GetState();
+		if (state == VMState::Running)
+			VMManager::Execute();
+		else if (state == VMState::Paused)
+			VMManager::SetState(VMState::Running);
+		else
+			break;
+	}
+
+	VMManager::Shutdown(false);
+	ExecutePendingCPUThreadFunctions();
+
+	const double elapsed = timer.GetTimeSeconds();
+	const std::vector<GSDumpReplayer::FrameStats> stats(GSDumpReplayer::GetFrameStats());
+	ReportFrameStats(path, stats, elapsed);
+
+	if (!s_report_directory.empty())
+	{
+		const std::string report_path(Path::Combine(s_report_directory, fmt::format("{}.csv", Path::GetFileTitle(path))));
+		if (!WriteFrameStatsCSV(report_path, stats))
+			return false;
+	}
+
+	return !stats.empty();
+}
+
+void GSRunner::ReportFrameStats(const std::string& path, const std::vector<GSDumpReplayer::FrameStats>& stats, double elapsed)
+{
+	if (stats.empty())
+	{
+		Console.Error("No frames were presented for '%s'.", path.c_str());
+		return;
+	}
+
+	std::vector<double> wall_times, cpu_times;
+	wall_times.reserve(stats.size());
+	cpu_times.reserve(stats.size());
+
+	double wall_total = 0.0, cpu_total = 0.0;
+	u64 draw_calls_total = 0;
+	u32 loops = 0;
+	for (const GSDumpReplayer::FrameStats& fs : stats)
+	{
+		wall_times.push_back(fs.gs_wall_ms);
+		cpu_times.push_back(fs.gs_cpu_ms);
+		wall_total += fs.gs_wall_ms;
+		cpu_total += fs.gs_cpu_ms;
+		draw_calls_total += fs.draw_calls;
+		loops = std::max(loops, fs.loop + 1);
+	}
+
+	std::sort(wall_times.begin(), wall_times.end());
+	std::sort(cpu_times.begin(), cpu_times.end());
+	const size_t p99_index = std::min(stats.size() - 1, (stats.size() * 99) / 100);
+
+	// Every loop should draw the same thing, if it doesn't the renderer isn't deterministic.
+	u32 hash_mismatches = 0;
+	for (const GSDumpReplayer::FrameStats& fs : stats)
+	{
+		if (fs.loop == 0 || !fs.has_hash)
+			continue;
+
+		const auto first = std::find_if(stats.begin(), stats.end(),
+			[&fs](const GSDumpReplayer::FrameStats& it) { return it.loop == 0 && it.frame == fs.frame; });
+		if (first != stats.end() && first->has_hash && first->hash != fs.hash)
+			hash_mismatches++;
+	}
+
+	const double frames = static_cast<double>(stats.size());
+	Console.WriteLn(Color_StrongGreen, "Finished '%s': %zu frames over %u loop(s) in %.2f seconds (%.2f FPS).",
+		path.c_str(), stats.size(), loops, elapsed, frames / elapsed);
+	Console.WriteLn("  GS wall time: avg %.3f ms, min %.3f ms, max %.3f ms, 99th %.3f ms",
+		wall_total / frames, wall_times.front(), wall_times.back(), wall_times[p99_index]);
+	Console.WriteLn("  GS CPU time:  avg %.3f ms, min %.3f ms, max %.3f ms, 99th %.3f ms",
+		cpu_total / frames, cpu_times.front(), cpu_times.back(), cpu_times[p99_index]);
+	Console.WriteLn("  Draw calls:   avg %.1f per frame", static_cast<double>(draw_calls_total) / frames);
+	if (hash_mismatches > 0)
+		Console.Warning("  %u frame(s) did not match the first loop.", hash_mismatches);
+}
+
+bool GSRunner::WriteFrameStatsCSV(const std::string& path, const std::vector<GSDumpReplayer::FrameStats>& stats)
+{
+	auto fp = FileSystem::OpenManagedCFile(path.c_str(), "wb");
+	if (!fp)
+	{
+		Console.Error("Failed to open '%s' for writing.", path.c_str());
+		return false;
+	}
+
+	std::fprintf(fp.get(), "loop,frame,gs_wall_ms,gs_cpu_ms,draws,draw_calls,prims,readbacks,barriers,hash\n");
+	for (const GSDumpReplayer::FrameStats& fs : stats)
+	{
+		std::fprintf(fp.get(), "%u,%u,%.4f,%.4f,%u,%u,%u,%u,%u,", fs.loop, fs.frame, fs.gs_wall_ms, fs.gs_cpu_ms,
+			fs.draws, fs.draw_calls, fs.prims, fs.readbacks, fs.barriers);
+		if (fs.has_hash)
+			std::fprintf(fp.get(), "%016llx\n", static_cast<unsigned long long>(fs.hash));
+		else
+			std::fprintf(fp.get(), "\n");
+	}
+
+	if (std::ferror(fp.get()))
+	{
+		Console.Error("Failed to write '%s'.", path.c_str());
+		return false;
+	}
+
+	Console.WriteLn("Wrote frame report to '%s'.", path.c_str());
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	CrashHandler::Install();
+	Host::InitializeEarlyConsole();
+
+	const char* error;
+	if (!VMManager::PerformEarlyHardwareChecks(&error))
+	{
+		std::fprintf(stderr, "%s\n", error);
+		return EXIT_FAILURE;
+	}
+
+	std::vector<std::string> dumps;
+	if (!GSRunner::ParseCommandLineOptions(argc, argv, dumps))
+		return EXIT_FAILURE;
+
+	if (!GSRunner::InitializeConfig())
+		return EXIT_FAILURE;
+
+	GSRunner::HookSignals();
+
+	s_cpu_thread_id = std::this_thread::get_id();
+	PerformanceMetrics::SetCPUThread(Threading::ThreadHandle::GetForCallingThread());
+	if (!VMManager::Internal::InitializeGlobals() || !VMManager::Internal::InitializeMemory())
+	{
+		Console.Error("Failed to allocate memory map.");
+		return EXIT_FAILURE;
+	}
+
+	GSDumpReplayer::SetIsDumpRunner(true);
+	GSDumpReplayer::SetLoopCount(s_loop_count);
+
+	u32 failures = 0;
+	for (const std::string& dump : dumps)
+	{
+		if (s_exit_requested.load())
+			break;
+
+		if (!GSRunner::RunDump(dump))
+			failures++;
+	}
+
+	VMManager::Internal::ReleaseMemory();
+	VMManager::Internal::ReleaseGlobals();
+	PerformanceMetrics::SetCPUThread(Threading::ThreadHandle());
+
+	if (failures > 0)
+		Console.Error("%u of %zu dump(s) failed.", failures, dumps.size());
+
+	return (failures == 0 && !s_exit_requested.load()) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Host Interface
+//////////////////////////////////////////////////////////////////////////
+
+std::optional<std::vector<u8>> Host::ReadResourceFile(const char* filename)
+{
+	const std::string path(Path::Combine(EmuFolders::Resources, filename));
+	std::optional<std::vector<u8>> ret(FileSystem::ReadBinaryFile(path.c_str()));
+	if (!ret.has_value())
+		Console.Error("Failed to read resource file '%s'", filename);
+	return ret;
+}
+
+std::optional<std::string> Host::ReadResourceFileToString(const char* filename)
+{
+	const std::string path(Path::Combine(EmuFolders::Resources, filename));
+	std::optional<std::string> ret(FileSystem::ReadFileToString(path.c_str()));
+	if (!ret.has_value())
+		Console.Error("Failed to read resource file to string '%s'", filename);
+	return ret;
+}
+
+std::optional<std::time_t> Host::GetResourceFileTimestamp(const char* filename)
+{
+	const std::string path(Path::Combine(EmuFolders::Resources, filename));
+	FILESYSTEM_STAT_DATA sd;
+	if (!FileSystem::StatFile(path.c_str(), &sd))
+	{
+		Console.Error("Failed to stat resource file '%s'", filename);
+		return std::nullopt;
+	}
+
+	return sd.ModificationTime;
+}
+
+void Host::ReportErrorAsync(const std::string_view& title, const std::string_view& message)
+{
+	if (!title.empty() && !message.empty())
+	{
+		Console.Error("ReportErrorAsync: %.*s: %.*s",
+			static_cast<int>(title.size()), title.data(),
+			static_cast<int>(message.size()), message.data());
+	}
+	else if (!message.empty())
+	{
+		Console.Error("ReportErrorAsync: %.*s",
+			static_cast<int>(message.size()), message.data());
+	}
+}
+
+void Host::OnInputDeviceConnected(const std::string_view& identifier, const std::string_view& device_name)
+{
+}
+
+void Host::OnInputDeviceDisconnected(const std::string_view& identifier)
+{
+}
+
+std::optional<u32> InputManager::ConvertHostKeyboardStringToCode(const std::string_view& str)
+{
+	return std::nullopt;
+}
+
+std::optional<std::string> InputManager::ConvertHostKeyboardCodeToString(u32 code)
+{
+	return std::nullopt;
+}
+
+HostDisplay* Host::GetHostDisplay()
+{
+	return s_host_display.get();
+}
+
+HostDisplay* Host::AcquireHostDisplay(HostDisplay::RenderAPI api)
+{
+	s_host_display = HostDisplay::CreateDisplayForAPI(api);
+	if (!s_host_display)
+		return nullptr;
+
+	WindowInfo wi;
+	wi.type = WindowInfo::Type::Surfaceless;
+	wi.surface_width = WINDOW_WIDTH;
+	wi.surface_height = WINDOW_HEIGHT;
+
+	const bool debug_device = Host::GetBoolSettingValue("EmuCore/GS", "UseDebugDevice", false);
+	if (!s_host_display->CreateRenderDevice(wi, Host::GetStringSettingValue("EmuCore/GS", "Adapter", ""),
+			VsyncMode::Off, false, debug_device) ||
+		!s_host_display->MakeRenderContextCurrent() ||
+		!s_host_display->InitializeRenderDevice(EmuFolders::Cache, debug_device) ||
+		!ImGuiManager::Initialize())
+	{
+		Console.Error("Failed to create headless %s device.", HostDisplay::RenderAPIToString(api));
+		ReleaseHostDisplay();
+		return nullptr;
+	}
+
+	Console.WriteLn(Color_StrongGreen, "%s Graphics Driver Info:", HostDisplay::RenderAPIToString(s_host_display->GetRenderAPI()));
+	Console.Indent().WriteLn(s_host_display->GetDriverInfo());
+
+	return s_host_display.get();
+}
+
+void Host::ReleaseHostDisplay()
+{
+	ImGuiManager::Shutdown();
+	s_host_display.reset();
+}
+
+bool Host::BeginPresentFrame(bool frame_skip)
+{
+	if (!s_host_display->BeginPresent(frame_skip))
+	{
+		// if we're skipping a frame, we need to reset imgui's state, since
+		// we won't be calling EndPresentFrame().
+		ImGuiManager::NewFrame();
+		return false;
+	}
+
+	return true;
+}
+
+void Host::EndPresentFrame()
+{
+	ImGuiManager::RenderOSD();
+	s_host_display->EndPresent();
+	ImGuiManager::NewFrame();
+}
+
+void Host::ResizeHostDisplay(u32 new_window_width, u32 new_window_height, float new_window_scale)
+{
+	s_host_display->ResizeRenderWindow(new_window_width, new_window_height, new_window_scale);
+	ImGuiManager::WindowResized();
+}
+
+void Host::RequestResizeHostDisplay(s32 width, s32 height)
+{
+}
+
+void Host::UpdateHostDisplay()
+{
+}
+
+void Host::OnVMStarting()
+{
+}
+
+void Host::OnVMStarted()
+{
+}
+
+void Host::OnVMDestroyed()
+{
+}
+
+void Host::OnVMPaused()
+{
+}
+
+void Host::OnVMResumed()
+{
+}
+
+void Host::OnGameChanged(const std::string& disc_path, const std::string& game_serial, const std::string& game_name,
+	u32 game_crc)
+{
+	Console.WriteLn("Dump serial: '%s', CRC: %08X", game_serial.c_str(), game_crc);
+}
+
+void Host::OnPerformanceMetricsUpdated()
+{
+}
+
+void Host::OnSaveStateLoading(const std::string_view& filename)
+{
+}
+
+void Host::OnSaveStateLoaded(const std::string_view& filename, bool was_successful)
+{
+}
+
+void Host::OnSaveStateSaved(const std::string_view& filename)
+{
+}
+
+void Host::InvalidateSaveStateCache()
+{
+}
+
+void Host::PumpMessagesOnCPUThread()
+{
+	GSRunner::ExecutePendingCPUThreadFunctions();
+}
+
+void Host::RunOnCPUThread(std::function<void()> function, bool block /* = false */)
+{
+	if (std::this_thread::get_id() == s_cpu_thread_id)
+	{
+		function();
+		return;
+	}
+
+	std::unique_lock lock(s_cpu_thread_functions_mutex);
+	s_cpu_thread_functions.push_back(std::move(function));
+	const u64 ticket = ++s_cpu_thread_functions_queued;
+	if (block)
+		s_cpu_thread_functions_cv.wait(lock, [ticket]() { return s_cpu_thread_functions_completed >= ticket; });
+}
+
+void Host::RefreshGameListAsync(bool invalidate_cache)
+{
+}
+
+void Host::CancelGameListRefresh()
+{
+}
+
+void Host::RequestExit(bool save_state_if_running)
+{
+	s_exit_requested.store(true);
+	if (VMManager::HasValidVM())
+		VMManager::SetState(VMState::Stopping);
+}
+
+void Host::RequestVMShutdown(bool allow_confirm, bool allow_save_state)
+{
+	if (VMManager::HasValidVM())
+		VMManager::SetState(VMState::Stopping);
+}
+
+bool Host::IsFullscreen()
+{
+	return false;
+}
+
+void Host::SetFullscreen(bool enabled)
+{
+}
+
+alignas(16) static SysMtgsThread s_mtgs_thread;
+
+SysMtgsThread& GetMTGS()
+{
+	return s_mtgs_thread;
+}
+
+// ------------------------------------------------------------------------
+// Hotkeys
+// ------------------------------------------------------------------------
+
+BEGIN_HOTKEY_LIST(g_host_hotkeys)
+END_HOTKEY_LIST()
@@ -55,7 +55,7 @@ AdvancedSystemSettingsWidget::AdvancedSystemSettingsWidget(SettingsDialog* dialo
 		tr("Moderate speedup for some games, with no known side effects."));
 
 	dialog->registerWidgetHelp(m_ui.eeCache, tr("Enable Cache (Slow)"), tr("Unchecked"),
-		tr("Interpreter only, provided for diagnostic."));
+		tr("Emulates the EE data cache, which a few games depend on. Works with both the interpreter and the recompiler."));
 
 	dialog->registerWidgetHelp(m_ui.eeINTCSpinDetection, tr("INTC Spin Detection"), tr("Checked"),
 		tr("Huge speedup for some games, with almost no compatibility side effects."));
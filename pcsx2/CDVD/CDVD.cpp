@@ -374,8 +374,8 @@ s32 cdvdWriteConfig(const u8* config)
 	return 0;
 }
 
-// Sets ElfCRC to the CRC of the game bound to the CDVD source.
-static __fi ElfObject* loadElf(std::string filename, bool isPSXElf)
+// Loads an ELF from the given disc filesystem (or the host, for host: paths).
+static __fi ElfObject* loadElf(SectorSource& source, std::string filename, bool isPSXElf)
 {
 	if (StringUtil::StartsWith(filename, "host:"))
 	{
@@ -406,8 +406,7 @@ static __fi ElfObject* loadElf(std::string filename, bool isPSXElf)
 		filename += ";1";
 	}
 
-	IsoFSCDVD isofs;
-	IsoFile file(isofs, filename);
+	IsoFile file(source, filename);
 	return new ElfObject(std::move(filename), file, isPSXElf);
 }
 
@@ -417,7 +416,8 @@ static __fi void _reloadElfInfo(std::string elfpath)
 	if (elfpath == LastELF)
 		return;
 
-	std::unique_ptr<ElfObject> elfptr(loadElf(elfpath, false));
+	IsoFSCDVD isofs;
+	std::unique_ptr<ElfObject> elfptr(loadElf(isofs, elfpath, false));
 	elfptr->loadHeaders();
 	ElfCRC = elfptr->getCRC();
 	ElfEntry = elfptr->header.e_entry;
@@ -532,6 +532,35 @@ void cdvdReloadElfInfo(std::string elfoverride)
 	}
 }
 
+s32 cdvdGetDiscInfo(SectorSource& source, std::string* serial, u32* crc)
+{
+	serial->clear();
+	*crc = 0;
+
+	// Single track images only, so the size is all that tells CDs and DVDs apart.
+	const s32 type = CheckDiskTypeFS(source, (source.getNumSectors() > 452849) ? CDVD_TYPE_DETCTDVDS : CDVD_TYPE_DETCTCD);
+	if (type == CDVD_TYPE_ILLEGAL || type == CDVD_TYPE_DVDV)
+		return type;
+
+	std::string elfpath;
+	const int discType = GetPS2ElfName(source, elfpath);
+	*serial = ExecutablePathToSerial(elfpath);
+	if (discType != 2)
+		return type;
+
+	try
+	{
+		std::unique_ptr<ElfObject> elfptr(loadElf(source, std::move(elfpath), false));
+		*crc = elfptr->getCRC();
+	}
+	catch (BaseException& ex)
+	{
+		Console.Error(ex.FormatDiagnosticMessage());
+	}
+
+	return type;
+}
+
 void cdvdReadKey(u8, u16, u32 arg2, u8* key)
 {
 	s32 numbers = 0, letters = 0;
@@ -176,6 +176,11 @@ extern u8 cdvdRead(u8 key);
 extern void cdvdWrite(u8 key, u8 rt);
 
 extern void cdvdReloadElfInfo(std::string elfoverride = std::string());
+
+// Reads the type (CDVD_TYPE_*), serial and ELF CRC of the disc behind source.  Unlike
+// cdvdReloadElfInfo(), this leaves the global CDVD/ELF state alone, and is thread safe as
+// long as the source is.
+extern s32 cdvdGetDiscInfo(SectorSource& source, std::string* serial, u32* crc);
 extern s32 cdvdCtrlTrayOpen();
 extern s32 cdvdCtrlTrayClose();
 
@@ -69,12 +69,11 @@ static void CheckNullCDVD()
 //////////////////////////////////////////////////////////////////////////////////////////
 // Disk Type detection stuff (from cdvdGigaherz)
 //
-static int CheckDiskTypeFS(int baseType)
+int CheckDiskTypeFS(SectorSource& source, int baseType)
 {
-	IsoFSCDVD isofs;
 	try
 	{
-		IsoDirectory rootdir(isofs);
+		IsoDirectory rootdir(source);
 
 		try
 		{
@@ -138,6 +137,12 @@ static int CheckDiskTypeFS(int baseType)
 	return CDVD_TYPE_ILLEGAL; // << Only for discs which aren't ps2 at all.
 }
 
+static int CheckDiskTypeFS(int baseType)
+{
+	IsoFSCDVD isofs;
+	return CheckDiskTypeFS(isofs, baseType);
+}
+
 static int FindDiskType(int mType)
 {
 	int dataTracks = 0;
@@ -154,6 +154,9 @@ extern CDVD_API CDVDapi_Iso;
 extern CDVD_API CDVDapi_Disc;
 extern CDVD_API CDVDapi_NoDisc;
 
+class SectorSource;
+extern int CheckDiskTypeFS(SectorSource& source, int baseType);
+
 extern void CDVDsys_ChangeSource(CDVD_SourceType type);
 extern void CDVDsys_SetFile(CDVD_SourceType srctype, std::string newfile);
 extern const std::string& CDVDsys_GetFile(CDVD_SourceType srctype);
@@ -371,3 +371,22 @@ bool InputIsoFile::Detect(bool readType)
 	//BUG: This also detects a memory-card-file as a valid Audio-CD ISO... -avih
 	return true;
 }
+
+bool InputIsoFileSource::readSector(unsigned char* buffer, int lba)
+{
+	if (lba < 0 || static_cast<uint>(lba) >= m_iso.GetBlockCount())
+		return false;
+
+	u8 frame[CD_FRAMESIZE_RAW];
+	if (m_iso.ReadSync(frame, lba) < 0)
+		return false;
+
+	// Same as ISOreadSector() in CDVD_MODE_2048.
+	std::memcpy(buffer, frame + 24, 2048);
+	return true;
+}
+
+int InputIsoFileSource::getNumSectors()
+{
+	return static_cast<int>(m_iso.GetBlockCount());
+}
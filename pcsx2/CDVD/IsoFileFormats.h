@@ -18,6 +18,7 @@
 #include "CDVD.h"
 #include "AsyncFileReader.h"
 #include "CompressedFileReader.h"
+#include "IsoFS/SectorSource.h"
 #include <memory>
 #include <string>
 
@@ -97,6 +98,26 @@ protected:
 	void FindParts();
 };
 
+// --------------------------------------------------------------------------------------
+//  InputIsoFileSource
+// --------------------------------------------------------------------------------------
+// Gives IsoFS access to the data sectors of an opened InputIsoFile, without going through
+// the active CDVD source.  Used to inspect images other than the one being emulated.
+class InputIsoFileSource : public SectorSource
+{
+protected:
+	InputIsoFile& m_iso;
+
+public:
+	InputIsoFileSource(InputIsoFile& iso)
+		: m_iso(iso)
+	{
+	}
+
+	bool readSector(unsigned char* buffer, int lba) override;
+	int getNumSectors() override;
+};
+
 class OutputIsoFile
 {
 	DeclareNoncopyableObject(OutputIsoFile);
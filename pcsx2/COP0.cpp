@@ -261,6 +261,7 @@ void MapTLB(int i)
 		for (addr=saddr; addr<eaddr; addr++) {
 			if ((addr & mask) == ((tlb[i].VPN2 >> 12) & mask)) { //match
 				memSetPageAddr(addr << 12, tlb[i].PFN0 + ((addr - saddr) << 12));
+				vtlb_VMapCacheable(addr << 12, 0x1000, ((tlb[i].EntryLo0 & 0x38) >> 3) == 0x3);
 				Cpu->Clear(addr << 12, 0x400);
 			}
 		}
@@ -274,6 +275,7 @@ void MapTLB(int i)
 		for (addr=saddr; addr<eaddr; addr++) {
 			if ((addr & mask) == ((tlb[i].VPN2 >> 12) & mask)) { //match
 				memSetPageAddr(addr << 12, tlb[i].PFN1 + ((addr - saddr) << 12));
+				vtlb_VMapCacheable(addr << 12, 0x1000, ((tlb[i].EntryLo1 & 0x38) >> 3) == 0x3);
 				Cpu->Clear(addr << 12, 0x400);
 			}
 		}
@@ -959,6 +959,8 @@ struct Pcsx2Config
 		PatchBios : 1,
 		BackupSavestate : 1,
 		SavestateZstdCompression : 1,
+		// keeps a ring of recent states in memory which can be rewound through
+		EnableRewind : 1,
 		// enables simulated ejection of memory cards when loading savestates
 		McdEnableEjection : 1,
 		McdFolderAutoManage : 1,
@@ -996,6 +998,10 @@ struct Pcsx2Config
 	McdOptions Mcd[8];
 	std::string GzipIsoIndexTemplate; // for quick-access index with gzipped ISO
 
+	u32 RewindFrequency; // frames between rewind captures
+	u32 RewindBufferSize; // memory budget for rewind states, in megabytes
+	u32 RunAheadFrames; // frames emulated ahead of the one shown to hide input latency, 0 disables
+
 	// Set at runtime, not loaded from config.
 	std::string CurrentBlockdump;
 	std::string CurrentIRX;
@@ -17,6 +17,7 @@
 #include "PrecompiledHeader.h"
 
 #include <time.h>
+#include <algorithm>
 #include <cmath>
 
 #include "Common.h"
@@ -38,11 +39,14 @@
 #include "gui/App.h"
 #else
 #include "PAD/Host/PAD.h"
+#include "RunAhead.h"
 #include "VMManager.h"
 #endif
 
 #include "Recording/InputRecordingControls.h"
 
+#include "fmt/core.h"
+
 using namespace Threading;
 
 extern u8 psxhblankgate;
@@ -477,9 +481,111 @@ u32 UpdateVSyncRate()
 	return static_cast<u32>(m_iTicks);
 }
 
+// --------------------------------------------------------------------------------------
+//  Frame Pacer
+// --------------------------------------------------------------------------------------
+// Sleeps until shortly before the end of the frame, then spins the rest of the way. How early
+// to wake up is learned from how late previous sleeps woke, so the spin only has to cover the
+// scheduler's jitter rather than whole milliseconds.
+
+static constexpr u32 FRAME_PACER_BUCKETS = 8;
+
+// Upper bounds of the frame time error buckets, in microseconds. The last bucket takes the rest.
+static constexpr s32 s_pacer_bucket_limits[FRAME_PACER_BUCKETS - 1] = {-1000, -250, -50, 50, 250, 1000, 4000};
+
+struct FramePacerStats
+{
+	u64 frames;
+	u64 late_frames;    // the emulation couldn't keep up
+	u64 missed_wakeups; // slept past the deadline
+	u64 sleep_ticks;
+	u64 spin_ticks;
+	u64 last_frame_end;
+	u32 histogram[FRAME_PACER_BUCKETS];
+};
+
+static u64 s_pacer_slack = 0;            // ticks to wake up ahead of the deadline
+static double s_pacer_latency_avg = 0.0; // smoothed wake-up latency, in ticks
+static double s_pacer_latency_dev = 0.0; // smoothed deviation of the above
+static FramePacerStats s_pacer_stats = {};
+
+static void frameLimitResetSlack()
+{
+	// start out conservative, it'll come down within a few frames
+	const double freq = static_cast<double>(GetTickFrequency());
+	s_pacer_latency_avg = freq / 2000.0;
+	s_pacer_latency_dev = freq / 8000.0;
+	s_pacer_slack = GetTickFrequency() / 1000;
+}
+
+static void frameLimitUpdateSlack(s64 latency)
+{
+	// Same estimator as TCP's retransmit timer: wake up early by the average latency plus
+	// a few deviations, which covers nearly every wake-up without sleeping too little.
+	const double sample = static_cast<double>(std::max<s64>(latency, 0));
+	const double err = sample - s_pacer_latency_avg;
+	s_pacer_latency_avg += err / 8.0;
+	s_pacer_latency_dev += (std::abs(err) - s_pacer_latency_dev) / 4.0;
+
+	const double freq = static_cast<double>(GetTickFrequency());
+	const double slack = std::clamp(s_pacer_latency_avg + 4.0 * s_pacer_latency_dev, freq / 20000.0, freq / 250.0);
+	s_pacer_slack = static_cast<u64>(slack);
+}
+
+static void frameLimitRecordFrame(u64 frame_end, bool late)
+{
+	FramePacerStats& stats = s_pacer_stats;
+	if (stats.last_frame_end != 0)
+	{
+		const s64 error = static_cast<s64>(frame_end - stats.last_frame_end) - m_iTicks;
+		const s64 error_us = (error * 1000000) / static_cast<s64>(GetTickFrequency());
+
+		u32 bucket = 0;
+		while (bucket < std::size(s_pacer_bucket_limits) && error_us >= s_pacer_bucket_limits[bucket])
+			bucket++;
+
+		stats.histogram[bucket]++;
+		stats.frames++;
+		stats.late_frames += late;
+	}
+
+	stats.last_frame_end = frame_end;
+}
+
+void frameLimitLogStatistics()
+{
+	FramePacerStats& stats = s_pacer_stats;
+	if (stats.frames > 0)
+	{
+		const double freq = static_cast<double>(GetTickFrequency());
+		const u64 wait_ticks = stats.sleep_ticks + stats.spin_ticks;
+		Console.WriteLn(fmt::format("(FramePacer) {} frames, {} late, {} missed wake-ups, {:.1f}% of waiting spent spinning, wake-up slack {:.3f} ms",
+			stats.frames, stats.late_frames, stats.missed_wakeups,
+			wait_ticks ? (static_cast<double>(stats.spin_ticks) * 100.0 / static_cast<double>(wait_ticks)) : 0.0,
+			static_cast<double>(s_pacer_slack) * 1000.0 / freq));
+
+		std::string line("(FramePacer) Frame time error (ms):");
+		for (u32 i = 0; i < FRAME_PACER_BUCKETS; i++)
+		{
+			if (i == 0)
+				line += fmt::format(" <{:.2f}: {}", s_pacer_bucket_limits[i] / 1000.0, stats.histogram[i]);
+			else if (i == (FRAME_PACER_BUCKETS - 1))
+				line += fmt::format(", >={:.2f}: {}", s_pacer_bucket_limits[i - 1] / 1000.0, stats.histogram[i]);
+			else
+				line += fmt::format(", {:.2f}..{:.2f}: {}", s_pacer_bucket_limits[i - 1] / 1000.0, s_pacer_bucket_limits[i] / 1000.0, stats.histogram[i]);
+		}
+		Console.WriteLn(line);
+	}
+
+	stats = {};
+}
+
 void frameLimitReset()
 {
 	m_iStart = GetCPUTicks();
+	s_pacer_stats.last_frame_end = 0;
+	if (s_pacer_slack == 0)
+		frameLimitResetSlack();
 }
 
 // FMV switch stuff
@@ -559,12 +665,22 @@ static __fi void frameLimitUpdateCore()
 #endif
 }
 
+static __fi bool IsRunningAhead()
+{
+#ifdef PCSX2_CORE
+	return RunAhead::IsRunningAhead();
+#else
+	return false;
+#endif
+}
+
 // Framelimiter - Measures the delta time between calls and stalls until a
 // certain amount of time passes if such time hasn't passed yet.
 static __fi void frameLimit()
 {
 	// Framelimiter off in settings? Framelimiter go brrr.
-	if (EmuConfig.GS.LimitScalar == 0.0 || s_use_vsync_for_timing)
+	// Frames emulated ahead are never shown at their own time, so they aren't paced either.
+	if (EmuConfig.GS.LimitScalar == 0.0 || s_use_vsync_for_timing || IsRunningAhead())
 	{
 		frameLimitUpdateCore();
 		return;
@@ -579,26 +695,42 @@ static __fi void frameLimit()
 	{
 		// ... Fudge the next frame start over a bit. Prevents fast forward zoomies.
 		m_iStart += (sDeltaTime / m_iTicks) * m_iTicks;
+		frameLimitRecordFrame(iEnd, true);
 		frameLimitUpdateCore();
 		return;
 	}
 
-	// Conversion of delta from CPU ticks (microseconds) to milliseconds
-	s32 msec = (int) ((sDeltaTime * -1000) / (s64) GetTickFrequency());
-	
-	// If any integer value of milliseconds exists, sleep it off.
-	// Prior comments suggested that 1-2 ms sleeps were inaccurate on some OSes;
-	// further testing suggests instead that this was utter bullshit. 
-	if (msec > 1)
+	if (s_pacer_slack == 0)
+		frameLimitResetSlack();
+
+	if (iEnd < uExpectedEnd)
 	{
-		Threading::Sleep(msec - 1);
+		// Sleep off as much as we can trust the OS to wake us up in time for...
+		if ((uExpectedEnd - iEnd) > s_pacer_slack)
+		{
+			const u64 wake_target = uExpectedEnd - s_pacer_slack;
+			Threading::SleepUntil(wake_target);
+
+			const u64 woke = GetCPUTicks();
+			frameLimitUpdateSlack(static_cast<s64>(woke - wake_target));
+			s_pacer_stats.sleep_ticks += woke - iEnd;
+			s_pacer_stats.missed_wakeups += (woke > uExpectedEnd);
+		}
+
+		// ... and spin the rest, which is usually well under a millisecond.
+		const u64 spin_start = GetCPUTicks();
+		u64 now = spin_start;
+		while (now < uExpectedEnd)
+		{
+			Threading::SpinWait();
+			now = GetCPUTicks();
+		}
+		s_pacer_stats.spin_ticks += now - spin_start;
+		frameLimitRecordFrame(now, false);
 	}
-	
-	// Conversion to milliseconds loses some precision; after sleeping off whole milliseconds,
-	// spin the thread without sleeping until we finally reach our expected end time.
-	while (GetCPUTicks() < uExpectedEnd)
+	else
 	{
-		// SKREEEEEEEE
+		frameLimitRecordFrame(iEnd, false);
 	}
 
 	// Finally, set our next frame start to when this one ends
@@ -621,7 +753,17 @@ static __fi void VSyncStart(u32 sCycle)
 #endif
 
 	frameLimit(); // limit FPS
-	gsPostVsyncStart(); // MUST be after framelimit; doing so before causes funk with frame times!
+#ifdef PCSX2_CORE
+	gsPostVsyncStart(RunAhead::IsPresentSuppressed(), RunAhead::IsRunningAhead()); // MUST be after framelimit; doing so before causes funk with frame times!
+
+	// Run-ahead captures and restores here, once this frame has been queued to the GS.  This may
+	// roll the whole machine back to the same point of an earlier frame, so from here on only
+	// the counter state is used, not sCycle.
+	RunAhead::OnVSync();
+	sCycle = vsyncCounter.sCycle;
+#else
+	gsPostVsyncStart(false, false); // MUST be after framelimit; doing so before causes funk with frame times!
+#endif
 
 	if(EmuConfig.Trace.Enabled && EmuConfig.Trace.EE.m_EnableAll)
 		SysTrace.EE.Counters.Write( "    ================  EE COUNTER VSYNC START (frame: %d)  ================", g_FrameCount );
@@ -31,7 +31,7 @@ namespace PacketReader
 		VlanDoubleQTag = 0x9100
 	};
 
-	class EthernetFrame
+	class EthernetFrame : public PacketObject
 	{
 	public:
 		u8 destinationMAC[6] = {0};
@@ -229,7 +229,8 @@ namespace PacketReader::IP
 	{
 		//if (!(i == 5)) //checksum field is 10-11th byte (5th short), which is skipped
 		ReComputeHeaderLen();
-		u8* headerSegment = new u8[headerLength];
+		u8 headerSegment[60]; //IHL is 4 bits, so at most 15 words
+		pxAssert(headerLength <= (int)sizeof(headerSegment));
 		int counter = 0;
 		NetLib::WriteByte08(headerSegment, &counter, (_verHi + (headerLength >> 2)));
 		NetLib::WriteByte08(headerSegment, &counter, dscp); //DSCP/ECN
@@ -257,12 +258,12 @@ namespace PacketReader::IP
 		counter = headerLength;
 
 		checksum = InternetChecksum(headerSegment, headerLength);
-		delete[] headerSegment;
 	}
 	bool IP_Packet::VerifyChecksum()
 	{
 		ReComputeHeaderLen();
-		u8* headerSegment = new u8[headerLength];
+		u8 headerSegment[60]; //IHL is 4 bits, so at most 15 words
+		pxAssert(headerLength <= (int)sizeof(headerSegment));
 		int counter = 0;
 		NetLib::WriteByte08(headerSegment, &counter, (_verHi + (headerLength >> 2)));
 		NetLib::WriteByte08(headerSegment, &counter, dscp); //DSCP/ECN
@@ -290,7 +291,6 @@ namespace PacketReader::IP
 		counter = headerLength;
 
 		u16 csumCal = InternetChecksum(headerSegment, headerLength);
-		delete[] headerSegment;
 
 		return (csumCal == 0);
 	}
@@ -303,35 +303,23 @@ namespace PacketReader::IP
 
 	u16 IP_Packet::InternetChecksum(u8* buffer, int length)
 	{
-		//source http://stackoverflow.com/a/2201090
-
+		//One's complement sum, carries are folded back in once at the end
+		//(a u64 can't overflow with any IP packet length)
 		int i = 0;
-		u32 sum = 0;
+		u64 sum = 0;
 		while (length > 1)
 		{
-			sum += ((u32)(buffer[i]) << 8) | ((u32)(buffer[i + 1]) & 0xFF);
-			if ((sum & 0xFFFF0000) > 0)
-			{
-				sum &= 0xFFFF;
-				sum += 1;
-			}
-
+			sum += ((u32)(buffer[i]) << 8) | (u32)(buffer[i + 1]);
 			i += 2;
 			length -= 2;
 		}
 
 		if (length > 0)
-		{
 			sum += (u32)(buffer[i] << 8);
 
-			if ((sum & 0xFFFF0000) > 0)
-			{
-				sum = sum & 0xFFFF;
-				sum += 1;
-			}
-		}
-		sum = ~sum;
-		sum = sum & 0xFFFF;
-		return (u16)sum;
+		while ((sum >> 16) != 0)
+			sum = (sum & 0xFFFF) + (sum >> 16);
+
+		return (u16)~sum;
 	}
 } // namespace PacketReader::IP
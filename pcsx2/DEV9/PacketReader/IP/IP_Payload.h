@@ -15,9 +15,11 @@
 
 #pragma once
 
+#include "DEV9/PacketReader/PacketPool.h"
+
 namespace PacketReader::IP
 {
-	class IP_Payload
+	class IP_Payload : public PacketObject
 	{
 	public: //Nedd GetProtocol
 		virtual int GetLength() = 0;
@@ -32,7 +34,7 @@ namespace PacketReader::IP
 	class IP_PayloadData : public IP_Payload
 	{
 	public:
-		std::unique_ptr<u8[]> data;
+		PacketBuffer data;
 
 	private:
 		int length;
@@ -45,7 +47,7 @@ namespace PacketReader::IP
 			length = len;
 
 			if (len != 0)
-				data = std::make_unique<u8[]>(len);
+				data = MakePacketBuffer(len);
 		}
 		IP_PayloadData(const IP_PayloadData& original)
 		{
@@ -54,7 +56,7 @@ namespace PacketReader::IP
 
 			if (length != 0)
 			{
-				data = std::make_unique<u8[]>(length);
+				data = MakePacketBuffer(length);
 				memcpy(data.get(), original.data.get(), length);
 			}
 		}
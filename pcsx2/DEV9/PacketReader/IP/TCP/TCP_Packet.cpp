@@ -260,7 +260,8 @@ namespace PacketReader::IP::TCP
 		if ((pHeaderLen & 1) != 0)
 			pHeaderLen += 1;
 
-		u8* headerSegment = new u8[pHeaderLen];
+		PacketBuffer headerBuffer = MakePacketBuffer(pHeaderLen);
+		u8* headerSegment = headerBuffer.get();
 		int counter = 0;
 
 		NetLib::WriteByteArray(headerSegment, &counter, 4, (u8*)&srcIP);
@@ -279,7 +280,6 @@ namespace PacketReader::IP::TCP
 			NetLib::WriteByte08(headerSegment, &counter, 0);
 
 		checksum = IP_Packet::InternetChecksum(headerSegment, pHeaderLen);
-		delete[] headerSegment;
 	}
 	bool TCP_Packet::VerifyChecksum(IP_Address srcIP, IP_Address dstIP)
 	{
@@ -288,7 +288,8 @@ namespace PacketReader::IP::TCP
 		if ((pHeaderLen & 1) != 0)
 			pHeaderLen += 1;
 
-		u8* headerSegment = new u8[pHeaderLen];
+		PacketBuffer headerBuffer = MakePacketBuffer(pHeaderLen);
+		u8* headerSegment = headerBuffer.get();
 		int counter = 0;
 
 		NetLib::WriteByteArray(headerSegment, &counter, 4, (u8*)&srcIP);
@@ -306,7 +307,6 @@ namespace PacketReader::IP::TCP
 			NetLib::WriteByte08(headerSegment, &counter, 0);
 
 		u16 csumCal = IP_Packet::InternetChecksum(headerSegment, pHeaderLen);
-		delete[] headerSegment;
 
 		return (csumCal == 0);
 	}
@@ -0,0 +1,115 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "DEV9/SimpleQueue.h"
+
+namespace PacketReader
+{
+	//Fixed set of preallocated blocks, passed between threads through a lock-free ring
+	//Packets are created on one thread (socket/server threads, or the EE) and freed on another
+	//Requests bigger than a block, or made while every block is in use, fall back to the heap
+	template <size_t BlockSize, size_t BlockCount>
+	class PacketPool
+	{
+	private:
+		alignas(16) u8 storage[BlockSize * BlockCount];
+		SimpleQueue<u8*, BlockCount> freeBlocks;
+
+	public:
+		PacketPool()
+		{
+			for (size_t i = 0; i < BlockCount; i++)
+				freeBlocks.Enqueue(&storage[i * BlockSize]);
+		}
+		PacketPool(const PacketPool&) = delete;
+
+		void* Allocate(size_t size)
+		{
+			u8* block;
+			if (size <= BlockSize && freeBlocks.Dequeue(&block))
+				return block;
+			return ::operator new(size);
+		}
+
+		void Free(void* ptr)
+		{
+			if (Owns(ptr))
+				freeBlocks.Enqueue(static_cast<u8*>(ptr));
+			else
+				::operator delete(ptr);
+		}
+
+		bool Owns(const void* ptr) const
+		{
+			const u8* block = static_cast<const u8*>(ptr);
+			return block >= storage && block < storage + sizeof(storage);
+		}
+	};
+
+	//Packet classes (~100 bytes each), several per frame
+	using PacketObjectPool = PacketPool<256, 1024>;
+	//Payload bytes, a frame never holds more than a NetPacket buffer
+	using PacketBufferPool = PacketPool<2048, 256>;
+
+	//Never freed, as packets may still be queued when DEV9 shuts down
+	inline PacketObjectPool& GetPacketObjectPool()
+	{
+		static PacketObjectPool* pool = new PacketObjectPool();
+		return *pool;
+	}
+	inline PacketBufferPool& GetPacketBufferPool()
+	{
+		static PacketBufferPool* pool = new PacketBufferPool();
+		return *pool;
+	}
+
+	//Base for classes allocated per frame, keeps them off the heap
+	class PacketObject
+	{
+	public:
+		static void* operator new(size_t size)
+		{
+			return GetPacketObjectPool().Allocate(size);
+		}
+		static void operator delete(void* ptr)
+		{
+			GetPacketObjectPool().Free(ptr);
+		}
+	};
+
+	struct PacketBufferDeleter
+	{
+		void operator()(u8* ptr) const
+		{
+			GetPacketBufferPool().Free(ptr);
+		}
+	};
+	using PacketBuffer = std::unique_ptr<u8[], PacketBufferDeleter>;
+
+	//Zeroed, like std::make_unique<u8[]>
+	inline PacketBuffer MakePacketBuffer(int len)
+	{
+		u8* buffer = static_cast<u8*>(GetPacketBufferPool().Allocate(len));
+		std::memset(buffer, 0, len);
+		return PacketBuffer(buffer);
+	}
+} // namespace PacketReader
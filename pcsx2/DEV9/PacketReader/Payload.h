@@ -17,9 +17,11 @@
 
 #include <memory>
 
+#include "PacketPool.h"
+
 namespace PacketReader
 {
-	class Payload
+	class Payload : public PacketObject
 	{
 	public:
 		virtual int GetLength() = 0;
@@ -32,7 +34,7 @@ namespace PacketReader
 	class PayloadData : public Payload
 	{
 	public:
-		std::unique_ptr<u8[]> data;
+		PacketBuffer data;
 
 	private:
 		int length;
@@ -43,7 +45,7 @@ namespace PacketReader
 			length = len;
 
 			if (len != 0)
-				data = std::make_unique<u8[]>(len);
+				data = MakePacketBuffer(len);
 		}
 		PayloadData(const PayloadData& original)
 		{
@@ -51,7 +53,7 @@ namespace PacketReader
 
 			if (length != 0)
 			{
-				data = std::make_unique<u8[]>(length);
+				data = MakePacketBuffer(length);
 				memcpy(data.get(), original.data.get(), length);
 			}
 		}
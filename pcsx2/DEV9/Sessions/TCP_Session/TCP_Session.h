@@ -55,6 +55,8 @@ namespace Sessions
 		};
 
 		SimpleQueue<PacketReader::IP::TCP::TCP_Packet*> _recvBuff;
+		//Reused by each Recv(), the data is copied into a pooled payload
+		std::vector<u8> recvBuffer; //Accesed By In Thread Only
 
 #ifdef _WIN32
 		SOCKET client = INVALID_SOCKET;
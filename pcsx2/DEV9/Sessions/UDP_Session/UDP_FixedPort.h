@@ -16,6 +16,7 @@
 #pragma once
 #include <atomic>
 #include <mutex>
+#include <vector>
 #ifdef _WIN32
 #include <winsock2.h>
 #elif defined(__POSIX__)
@@ -47,6 +48,9 @@ namespace Sessions
 		std::mutex connectionSentry;
 		std::vector<UDP_BaseSession*> connections;
 
+		//Reused by each Recv(), the data is copied into a pooled payload
+		std::vector<u8> recvBuffer;
+
 	public:
 		UDP_FixedPort(ConnectionKey parKey, PacketReader::IP::IP_Address parAdapterIP, u16 parPort);
 
@@ -134,7 +134,6 @@ namespace Sessions
 		{
 			u_long available = 0;
 			PayloadData* recived = nullptr;
-			std::unique_ptr<u8[]> buffer;
 			sockaddr endpoint{0};
 
 			//FIONREAD returns total size of all available messages
@@ -146,14 +145,15 @@ namespace Sessions
 #endif
 			if (ret != SOCKET_ERROR)
 			{
-				buffer = std::make_unique<u8[]>(available);
+				if (recvBuffer.size() < available)
+					recvBuffer.resize(available);
 
 #ifdef _WIN32
 				int fromlen = sizeof(endpoint);
 #elif defined(__POSIX__)
 				socklen_t fromlen = sizeof(endpoint);
 #endif
-				ret = recvfrom(client, (char*)buffer.get(), available, 0, &endpoint, &fromlen);
+				ret = recvfrom(client, (char*)recvBuffer.data(), available, 0, &endpoint, &fromlen);
 			}
 
 			if (ret == SOCKET_ERROR)
@@ -169,7 +169,7 @@ namespace Sessions
 			}
 
 			recived = new PayloadData(ret);
-			memcpy(recived->data.get(), buffer.get(), ret);
+			memcpy(recived->data.get(), recvBuffer.data(), ret);
 
 			UDP_Packet* iRet = new UDP_Packet(recived);
 			iRet->destinationPort = srcPort;
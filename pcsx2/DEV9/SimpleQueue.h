@@ -16,30 +16,48 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
 
 #include "common/Assertions.h"
+#include "common/Console.h"
 
-//Designed to allow one thread to queue data to another thread
-template <class T>
+//Designed to allow threads to queue data to other threads without locking or allocating
+//Entries are stored in a fixed ring of preallocated cells (bounded MPMC queue, sequence number per cell)
+//If the ring is full, entries spill into a mutex guarded overflow list
+//Once spilled, Enqueue keeps using the overflow until it has been drained, to preserve ordering
+template <class T, size_t Capacity = 128>
 class SimpleQueue
 {
+	static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SimpleQueue capacity must be a power of two");
+
 private:
-	struct SimpleQueueEntry
+	struct SimpleQueueCell
 	{
-		std::atomic_bool ready{false};
-		SimpleQueueEntry* next;
+		std::atomic<size_t> sequence;
 		T value;
 	};
 
-	std::atomic<SimpleQueueEntry*> head{nullptr};
-	SimpleQueueEntry* tail = nullptr;
+	SimpleQueueCell cells[Capacity];
+
+	//Keep the producer and consumer indices on separate cache lines
+	alignas(64) std::atomic<size_t> enqueuePos{0};
+	alignas(64) std::atomic<size_t> dequeuePos{0};
+
+	alignas(64) std::atomic<size_t> overflowCount{0};
+	std::mutex overflowMutex;
+	std::deque<T> overflow;
+
+	bool TryPush(const T& entry);
+	bool TryPop(T* entry);
 
 public:
 	SimpleQueue();
 
-	//Used by single queue thread (i.e. EE)
+	//Used by queue thread(s) (i.e. EE)
 	void Enqueue(T entry);
-	//Used by single worker thread (i.e. IO)
+	//Used by worker thread(s) (i.e. IO)
 	bool Dequeue(T* entry);
 	//May return false negative when another thread is mid Queue()
 	//Intended to only be used from queue thread
@@ -48,67 +66,120 @@ public:
 	~SimpleQueue();
 };
 
-template <class T>
-SimpleQueue<T>::SimpleQueue()
+template <class T, size_t Capacity>
+SimpleQueue<T, Capacity>::SimpleQueue()
+{
+	for (size_t i = 0; i < Capacity; i++)
+		cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template <class T, size_t Capacity>
+bool SimpleQueue<T, Capacity>::TryPush(const T& entry)
 {
-	tail = new SimpleQueueEntry();
-	head.store(tail);
+	size_t pos = enqueuePos.load(std::memory_order_relaxed);
+	while (true)
+	{
+		SimpleQueueCell* cell = &cells[pos & (Capacity - 1)];
+		const size_t seq = cell->sequence.load(std::memory_order_acquire);
+		const ptrdiff_t diff = static_cast<ptrdiff_t>(seq) - static_cast<ptrdiff_t>(pos);
+
+		if (diff == 0)
+		{
+			//Cell is free, try to claim it
+			if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+			{
+				cell->value = entry;
+				//Set ready (can be dequeued)
+				cell->sequence.store(pos + 1, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (diff < 0)
+			return false; //Full
+		else
+			pos = enqueuePos.load(std::memory_order_relaxed);
+	}
 }
 
-template <class T>
-void SimpleQueue<T>::Enqueue(T entry)
+template <class T, size_t Capacity>
+bool SimpleQueue<T, Capacity>::TryPop(T* entry)
 {
-	//Allocate Next entry, and assign to head
-	SimpleQueueEntry* newHead = new SimpleQueueEntry();
-	SimpleQueueEntry* newEntry = head.exchange(newHead);
+	size_t pos = dequeuePos.load(std::memory_order_relaxed);
+	while (true)
+	{
+		SimpleQueueCell* cell = &cells[pos & (Capacity - 1)];
+		const size_t seq = cell->sequence.load(std::memory_order_acquire);
+		const ptrdiff_t diff = static_cast<ptrdiff_t>(seq) - static_cast<ptrdiff_t>(pos + 1);
+
+		if (diff == 0)
+		{
+			if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+			{
+				*entry = cell->value;
+				//Hand the cell back to the producers for the next lap
+				cell->sequence.store(pos + Capacity, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (diff < 0)
+			return false; //Empty, or next entry not ready yet
+		else
+			pos = dequeuePos.load(std::memory_order_relaxed);
+	}
+}
 
-	//Fill in
-	newEntry->value = entry;
-	newEntry->next = newHead;
+template <class T, size_t Capacity>
+void SimpleQueue<T, Capacity>::Enqueue(T entry)
+{
+	if (overflowCount.load(std::memory_order_acquire) == 0 && TryPush(entry))
+		return;
 
-	//Set ready (can be dequeued)
-	newEntry->ready.store(true);
+	std::lock_guard lock(overflowMutex);
+	overflow.push_back(entry);
+	overflowCount.fetch_add(1, std::memory_order_release);
 }
 
-template <class T>
-bool SimpleQueue<T>::Dequeue(T* entry)
+template <class T, size_t Capacity>
+bool SimpleQueue<T, Capacity>::Dequeue(T* entry)
 {
-	if (!tail->ready.load())
+	//Anything in the ring was queued before the current overflow
+	if (TryPop(entry))
+		return true;
+
+	//A producer may still be filling a ring cell, which must be dequeued before the overflow
+	if (overflowCount.load(std::memory_order_acquire) == 0 ||
+		enqueuePos.load(std::memory_order_acquire) != dequeuePos.load(std::memory_order_acquire))
 		return false;
 
-	SimpleQueueEntry* retEntry = tail;
-	tail = retEntry->next;
+	std::lock_guard lock(overflowMutex);
+	if (overflow.empty())
+		return false;
 
-	*entry = retEntry->value;
-	delete retEntry;
+	*entry = overflow.front();
+	overflow.pop_front();
+	overflowCount.fetch_sub(1, std::memory_order_release);
 	return true;
 }
 
 //Note, next entry may not be ready to dequeue
-template <class T>
-bool SimpleQueue<T>::IsQueueEmpty()
+template <class T, size_t Capacity>
+bool SimpleQueue<T, Capacity>::IsQueueEmpty()
 {
-	return head.load() == tail;
+	return enqueuePos.load(std::memory_order_acquire) == dequeuePos.load(std::memory_order_acquire) &&
+		   overflowCount.load(std::memory_order_acquire) == 0;
 }
 
-template <class T>
-SimpleQueue<T>::~SimpleQueue()
+template <class T, size_t Capacity>
+SimpleQueue<T, Capacity>::~SimpleQueue()
 {
-	if (head != nullptr)
+	if (!IsQueueEmpty())
 	{
-		if (!IsQueueEmpty())
-		{
-			Console.Error("DEV9: Queue not empty");
-			pxAssert(false);
-
-			//Empty Queue
-			T entry;
-			while (!IsQueueEmpty())
-				Dequeue(&entry);
-		}
+		Console.Error("DEV9: Queue not empty");
+		pxAssert(false);
 
-		delete head;
-		head = nullptr;
-		tail = nullptr;
+		//Empty Queue
+		T entry;
+		while (!IsQueueEmpty())
+			Dequeue(&entry);
 	}
 }
@@ -89,7 +89,7 @@ public:
 		auto search = map.find(key);
 		if (search != map.end())
 		{
-			*value = map[key];
+			*value = search->second;
 			return true;
 		}
 		else
@@ -206,13 +206,7 @@ NetAdapter::~NetAdapter()
 	if (internalRxThreadRunning.load())
 	{
 		internalRxThreadRunning.store(false);
-
-		{
-			std::lock_guard srvlock(internalRxMutex);
-			internalRxHasData = true;
-		}
-
-		internalRxCV.notify_all();
+		internalRxSema.NotifyOfWork();
 		internalRxThread.join();
 	}
 }
@@ -418,14 +412,7 @@ void NetAdapter::InternalSignalReceived()
 {
 	//Signal internal server thread to read
 	if (internalRxThreadRunning.load())
-	{
-		{
-			std::lock_guard srvlock(internalRxMutex);
-			internalRxHasData = true;
-		}
-
-		internalRxCV.notify_all();
-	}
+		internalRxSema.NotifyOfWork();
 }
 
 void NetAdapter::InternalServerThread()
@@ -433,15 +420,10 @@ void NetAdapter::InternalServerThread()
 	NetPacket tmp;
 	while (internalRxThreadRunning.load())
 	{
-		std::unique_lock srvLock(internalRxMutex);
-		internalRxCV.wait(srvLock, [&] { return internalRxHasData; });
-
-		{
-			std::lock_guard rx_lock(rx_mutex);
-			while (rx_fifo_can_rx() && InternalServerRecv(&tmp))
-				rx_process(&tmp);
-		}
+		internalRxSema.WaitForWork();
 
-		internalRxHasData = false;
+		std::lock_guard rx_lock(rx_mutex);
+		while (rx_fifo_can_rx() && InternalServerRecv(&tmp))
+			rx_process(&tmp);
 	}
 }
@@ -21,7 +21,6 @@
 #include <thread>
 #include <atomic>
 #include <mutex>
-#include <condition_variable>
 
 #ifdef _WIN32
 #include <winsock2.h>
@@ -31,6 +30,8 @@
 #include <ifaddrs.h>
 #endif
 
+#include "common/Threading.h"
+
 #include "Config.h"
 
 #include "PacketReader/IP/IP_Address.h"
@@ -102,9 +103,8 @@ private:
 	std::thread internalRxThread;
 	std::atomic<bool> internalRxThreadRunning{false};
 
-	std::mutex internalRxMutex;
-	std::condition_variable internalRxCV;
-	bool internalRxHasData = false;
+	//Woken by the internal servers whenever they queue a reply
+	Threading::WorkSema internalRxSema;
 
 	bool dhcpOn = false;
 
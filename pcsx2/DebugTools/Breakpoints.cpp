@@ -20,6 +20,7 @@
 #include <cstdio>
 #include "R5900.h"
 #include "System.h"
+#include "Memory.h"
 
 std::vector<BreakPoint> CBreakPoints::breakPoints_;
 u32 CBreakPoints::breakSkipFirstAtEE_ = 0;
@@ -392,6 +393,31 @@ const std::vector<MemCheck> CBreakPoints::GetMemChecks()
 	return memChecks_;
 }
 
+bool CBreakPoints::IsPageGuarded(const MemCheck& check)
+{
+	if (check.cpu != BREAKPOINT_EE || check.result == 0 || check.end <= check.start)
+		return false;
+
+	// Only the recompiler's direct ram accesses are matched against the guards.
+	if (!CHECK_EEREC || CHECK_CACHE)
+		return false;
+
+	const u32 start = standardizeBreakpointAddress(check.start);
+	const u32 end = standardizeBreakpointAddress(check.end - 1) + 1;
+	return start < end && end <= Ps2MemSize::MainRam;
+}
+
+size_t CBreakPoints::GetNumInlineMemchecks()
+{
+	size_t count = 0;
+	for (const MemCheck& check : memChecks_)
+	{
+		if (!IsPageGuarded(check))
+			count++;
+	}
+	return count;
+}
+
 const std::vector<BreakPoint> CBreakPoints::GetBreakpoints()
 {
 	return breakPoints_;
@@ -417,6 +443,8 @@ void CBreakPoints::Update(BreakPointCpu cpu, u32 addr)
 //	else
 		SysClearExecutionCache();
 
+	mmap_UpdateMemcheckProtection();
+
 	if (resume)
 		r5900Debug.resumeCpu();
 
@@ -109,7 +109,8 @@ struct MemCheck
 
 // BreakPoints cannot overlap, only one is allowed per address.
 // MemChecks can overlap, as long as their ends are different.
-// WARNING: MemChecks are not used in the interpreter or HLE currently.
+// WARNING: MemChecks are not used in the interpreter or HLE currently, except for EE
+// MemChecks on main ram, which are guarded by host page protection.
 class CBreakPoints
 {
 public:
@@ -145,6 +146,12 @@ public:
 	static const std::vector<BreakPoint> GetBreakpoints();
 	static size_t GetNumMemchecks() { return memChecks_.size(); }
 
+	// EE MemChecks entirely within main ram are handled by page protection (see
+	// mmap_UpdateMemcheckProtection) and don't need to be checked inline, as long as the
+	// recompiler accesses ram directly (EE recompiler on, EE cache emulation off).
+	static bool IsPageGuarded(const MemCheck& check);
+	static size_t GetNumInlineMemchecks();
+
 	static void Update(BreakPointCpu cpu = BREAKPOINT_IOP_AND_EE, u32 addr = 0);
 
 	static void SetBreakpointTriggered(bool b) { breakpointTriggered_ = b; };
@@ -28,9 +28,76 @@ SymbolMap R3000SymbolMap;
 
 #define ARRAY_SIZE(x) (sizeof((x))/sizeof(*(x)))
 
+static const u32 NO_ENTRY = (u32)-1;
+
+template <typename List>
+static u32 FindAtAddress(const List& list, u32 address) {
+	auto it = std::lower_bound(list.addresses.begin(), list.addresses.end(), address);
+	if (it == list.addresses.end() || *it != address)
+		return NO_ENTRY;
+	return (u32)(it - list.addresses.begin());
+}
+
+template <typename List>
+static u64 RangeEnd(const List& list, u32 index) {
+	return (u64)list.addresses[index] + list.entries[index].size;
+}
+
+// Finds the closest range starting at or below address which contains it.  Ranges may
+// overlap (or nest), so when the nearest one ends before address the search follows the
+// enclosing links, each of which leads to the closest earlier range ending further out.
+template <typename List>
+static u32 FindContaining(const List& list, u32 address) {
+	auto it = std::upper_bound(list.addresses.begin(), list.addresses.end(), address);
+	if (it == list.addresses.begin())
+		return NO_ENTRY;
+
+	for (u32 i = (u32)(it - list.addresses.begin()) - 1; i != NO_ENTRY; i = list.enclosing[i]) {
+		if (RangeEnd(list, i) > address)
+			return i;
+	}
+	return NO_ENTRY;
+}
+
+template <typename List, typename T>
+static void BuildActiveList(List& list, std::vector<std::pair<u32, T>>& symbols) {
+	// Stable, so that the first symbol at an address wins, like the std::map inserts did.
+	std::stable_sort(symbols.begin(), symbols.end(), [](const std::pair<u32, T>& a, const std::pair<u32, T>& b) {
+		return a.first < b.first;
+	});
+	symbols.erase(std::unique(symbols.begin(), symbols.end(), [](const std::pair<u32, T>& a, const std::pair<u32, T>& b) {
+		return a.first == b.first;
+	}), symbols.end());
+
+	list.addresses.reserve(symbols.size());
+	list.entries.reserve(symbols.size());
+	for (const auto& symbol : symbols) {
+		list.addresses.push_back(symbol.first);
+		list.entries.push_back(symbol.second);
+	}
+}
+
+template <typename List>
+static void BuildEnclosing(List& list) {
+	list.enclosing.resize(list.entries.size());
+	std::vector<u32> stack;
+	for (u32 i = 0; i < (u32)list.entries.size(); i++) {
+		while (!stack.empty() && RangeEnd(list, stack.back()) <= RangeEnd(list, i))
+			stack.pop_back();
+		list.enclosing[i] = stack.empty() ? NO_ENTRY : stack.back();
+		stack.push_back(i);
+	}
+}
+
+SymbolMap::SymbolMap()
+	: activeSymbols(std::make_shared<const ActiveSymbols>())
+	, activeSymbolsStale(false) {
+}
+
 void SymbolMap::SortSymbols() {
 	std::lock_guard<std::recursive_mutex> guard(m_lock);
 	AssignFunctionIndices();
+	InvalidateActiveSymbols();
 }
 
 void SymbolMap::Clear() {
@@ -38,11 +105,9 @@ void SymbolMap::Clear() {
 	functions.clear();
 	labels.clear();
 	data.clear();
-	activeFunctions.clear();
-	activeLabels.clear();
-	activeData.clear();
 	activeModuleEnds.clear();
 	modules.clear();
+	InvalidateActiveSymbols();
 }
 
 
@@ -105,30 +170,31 @@ bool SymbolMap::LoadNocashSym(const char *filename) {
 }
 
 SymbolType SymbolMap::GetSymbolType(u32 address) const {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	if (activeFunctions.find(address) != activeFunctions.end())
+	const auto active = GetActiveSymbols();
+	if (FindAtAddress(active->functions, address) != NO_ENTRY)
 		return ST_FUNCTION;
-	if (activeData.find(address) != activeData.end())
+	if (FindAtAddress(active->data, address) != NO_ENTRY)
 		return ST_DATA;
 	return ST_NONE;
 }
 
 bool SymbolMap::GetSymbolInfo(SymbolInfo *info, u32 address, SymbolType symmask) const {
+	const auto active = GetActiveSymbols();
 	u32 functionAddress = INVALID_ADDRESS;
 	u32 dataAddress = INVALID_ADDRESS;
 
 	if (symmask & ST_FUNCTION)
-		functionAddress = GetFunctionStart(address);
+		functionAddress = GetFunctionStart(*active, address);
 
 	if (symmask & ST_DATA)
-		dataAddress = GetDataStart(address);
+		dataAddress = GetDataStart(*active, address);
 
 	if (functionAddress == INVALID_ADDRESS || dataAddress == INVALID_ADDRESS) {
 		if (functionAddress != INVALID_ADDRESS) {
 			if (info != NULL) {
 				info->type = ST_FUNCTION;
 				info->address = functionAddress;
-				info->size = GetFunctionSize(functionAddress);
+				info->size = GetFunctionSize(*active, functionAddress);
 			}
 
 			return true;
@@ -138,7 +204,7 @@ bool SymbolMap::GetSymbolInfo(SymbolInfo *info, u32 address, SymbolType symmask)
 			if (info != NULL) {
 				info->type = ST_DATA;
 				info->address = dataAddress;
-				info->size = GetDataSize(dataAddress);
+				info->size = GetDataSize(*active, dataAddress);
 			}
 
 			return true;
@@ -151,22 +217,24 @@ bool SymbolMap::GetSymbolInfo(SymbolInfo *info, u32 address, SymbolType symmask)
 	if (info != NULL) {
 		info->type = ST_FUNCTION;
 		info->address = functionAddress;
-		info->size = GetFunctionSize(functionAddress);
+		info->size = GetFunctionSize(*active, functionAddress);
 	}
 
 	return true;
 }
 
-u32 SymbolMap::GetNextSymbolAddress(u32 address, SymbolType symmask) {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	const auto functionEntry = symmask & ST_FUNCTION ? activeFunctions.upper_bound(address) : activeFunctions.end();
-	const auto dataEntry = symmask & ST_DATA ? activeData.upper_bound(address) : activeData.end();
+u32 SymbolMap::GetNextSymbolAddress(u32 address, SymbolType symmask) const {
+	const auto active = GetActiveSymbols();
+	const auto& functions = active->functions.addresses;
+	const auto& data = active->data.addresses;
+	const auto functionEntry = symmask & ST_FUNCTION ? std::upper_bound(functions.begin(), functions.end(), address) : functions.end();
+	const auto dataEntry = symmask & ST_DATA ? std::upper_bound(data.begin(), data.end(), address) : data.end();
 
-	if (functionEntry == activeFunctions.end() && dataEntry == activeData.end())
+	if (functionEntry == functions.end() && dataEntry == data.end())
 		return INVALID_ADDRESS;
 
-	u32 funcAddress = (functionEntry != activeFunctions.end()) ? functionEntry->first : 0xFFFFFFFF;
-	u32 dataAddress = (dataEntry != activeData.end()) ? dataEntry->first : 0xFFFFFFFF;
+	u32 funcAddress = (functionEntry != functions.end()) ? *functionEntry : 0xFFFFFFFF;
+	u32 dataAddress = (dataEntry != data.end()) ? *dataEntry : 0xFFFFFFFF;
 
 	if (funcAddress <= dataAddress)
 		return funcAddress;
@@ -175,16 +243,16 @@ u32 SymbolMap::GetNextSymbolAddress(u32 address, SymbolType symmask) {
 }
 
 std::string SymbolMap::GetDescription(unsigned int address) const {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
+	const auto active = GetActiveSymbols();
 	const char* labelName = NULL;
 
-	u32 funcStart = GetFunctionStart(address);
+	u32 funcStart = GetFunctionStart(*active, address);
 	if (funcStart != INVALID_ADDRESS) {
-		labelName = GetLabelName(funcStart);
+		labelName = GetLabelName(*active, funcStart);
 	} else {
-		u32 dataStart = GetDataStart(address);
+		u32 dataStart = GetDataStart(*active, address);
 		if (dataStart != INVALID_ADDRESS)
-			labelName = GetLabelName(dataStart);
+			labelName = GetLabelName(*active, dataStart);
 	}
 
 	if (labelName != NULL)
@@ -195,16 +263,16 @@ std::string SymbolMap::GetDescription(unsigned int address) const {
 	return descriptionTemp;
 }
 
-std::vector<SymbolEntry> SymbolMap::GetAllSymbols(SymbolType symmask) {
+std::vector<SymbolEntry> SymbolMap::GetAllSymbols(SymbolType symmask) const {
+	const auto active = GetActiveSymbols();
 	std::vector<SymbolEntry> result;
 
 	if (symmask & ST_FUNCTION) {
-		std::lock_guard<std::recursive_mutex> guard(m_lock);
-		for (auto it = activeFunctions.begin(); it != activeFunctions.end(); it++) {
+		for (size_t i = 0; i < active->functions.entries.size(); i++) {
 			SymbolEntry entry;
-			entry.address = it->first;
-			entry.size = GetFunctionSize(entry.address);
-			const char* name = GetLabelName(entry.address);
+			entry.address = active->functions.addresses[i];
+			entry.size = active->functions.entries[i].size;
+			const char* name = GetLabelName(*active, entry.address);
 			if (name != NULL)
 				entry.name = name;
 			result.push_back(entry);
@@ -212,12 +280,11 @@ std::vector<SymbolEntry> SymbolMap::GetAllSymbols(SymbolType symmask) {
 	}
 
 	if (symmask & ST_DATA) {
-		std::lock_guard<std::recursive_mutex> guard(m_lock);
-		for (auto it = activeData.begin(); it != activeData.end(); it++) {
+		for (size_t i = 0; i < active->data.entries.size(); i++) {
 			SymbolEntry entry;
-			entry.address = it->first;
-			entry.size = GetDataSize(entry.address);
-			const char* name = GetLabelName(entry.address);
+			entry.address = active->data.addresses[i];
+			entry.size = active->data.entries[i].size;
+			const char* name = GetLabelName(*active, entry.address);
 			if (name != NULL)
 				entry.name = name;
 			result.push_back(entry);
@@ -346,13 +413,6 @@ void SymbolMap::AddFunction(const char* name, u32 address, u32 size, int moduleI
 			existing->second.start = relAddress;
 			existing->second.module = moduleIndex;
 		}
-
-		// Refresh the active item if it exists.
-		auto active = activeFunctions.find(address);
-		if (active != activeFunctions.end() && active->second.module == moduleIndex) {
-			activeFunctions.erase(active);
-			activeFunctions.insert(std::make_pair(address, existing->second));
-		}
 	} else {
 		FunctionEntry func;
 		func.start = relAddress;
@@ -360,62 +420,43 @@ void SymbolMap::AddFunction(const char* name, u32 address, u32 size, int moduleI
 		func.index = (int)functions.size();
 		func.module = moduleIndex;
 		functions[symbolKey] = func;
-
-		if (IsModuleActive(moduleIndex)) {
-			activeFunctions.insert(std::make_pair(address, func));
-		}
 	}
 
+	InvalidateActiveSymbols();
 	AddLabel(name, address, moduleIndex);
 }
 
-u32 SymbolMap::GetFunctionStart(u32 address) const {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	auto it = activeFunctions.upper_bound(address);
-	if (it == activeFunctions.end()) {
-		// check last element
-		auto rit = activeFunctions.rbegin();
-		if (rit != activeFunctions.rend()) {
-			u32 start = rit->first;
-			u32 size = rit->second.size;
-			if (start <= address && start+size > address)
-				return start;
-		}
-		// otherwise there's no function that contains this address
+u32 SymbolMap::GetFunctionStart(const ActiveSymbols& active, u32 address) {
+	const u32 func = FindContaining(active.functions, address);
+	if (func == NO_ENTRY)
 		return INVALID_ADDRESS;
-	}
 
-	if (it != activeFunctions.begin()) {
-		it--;
-		u32 start = it->first;
-		u32 size = it->second.size;
-		if (start <= address && start+size > address)
-			return start;
-	}
+	return active.functions.addresses[func];
+}
 
-	return INVALID_ADDRESS;
+u32 SymbolMap::GetFunctionStart(u32 address) const {
+	return GetFunctionStart(*GetActiveSymbols(), address);
 }
 
-u32 SymbolMap::GetFunctionSize(u32 startAddress) const {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	auto it = activeFunctions.find(startAddress);
-	if (it == activeFunctions.end())
+u32 SymbolMap::GetFunctionSize(const ActiveSymbols& active, u32 startAddress) {
+	const u32 func = FindAtAddress(active.functions, startAddress);
+	if (func == NO_ENTRY)
 		return INVALID_ADDRESS;
 
-	return it->second.size;
+	return active.functions.entries[func].size;
 }
 
-int SymbolMap::GetFunctionNum(u32 address) const {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	u32 start = GetFunctionStart(address);
-	if (start == INVALID_ADDRESS)
-		return INVALID_ADDRESS;
+u32 SymbolMap::GetFunctionSize(u32 startAddress) const {
+	return GetFunctionSize(*GetActiveSymbols(), startAddress);
+}
 
-	auto it = activeFunctions.find(start);
-	if (it == activeFunctions.end())
+int SymbolMap::GetFunctionNum(u32 address) const {
+	const auto active = GetActiveSymbols();
+	const u32 func = FindContaining(active->functions, address);
+	if (func == NO_ENTRY)
 		return INVALID_ADDRESS;
 
-	return it->second.index;
+	return active->functions.entries[func].index;
 }
 
 void SymbolMap::AssignFunctionIndices() {
@@ -432,53 +473,90 @@ void SymbolMap::AssignFunctionIndices() {
 }
 
 void SymbolMap::UpdateActiveSymbols() {
-	// return;   (slow in debug mode)
 	std::lock_guard<std::recursive_mutex> guard(m_lock);
+	AssignFunctionIndices();
+	InvalidateActiveSymbols();
+}
+
+void SymbolMap::InvalidateActiveSymbols() {
+	activeSymbolsStale.store(true, std::memory_order_release);
+}
+
+std::shared_ptr<const SymbolMap::ActiveSymbols> SymbolMap::GetActiveSymbols() const {
+	if (activeSymbolsStale.load(std::memory_order_acquire)) {
+		std::lock_guard<std::recursive_mutex> guard(m_lock);
+		if (activeSymbolsStale.load(std::memory_order_relaxed))
+			BuildActiveSymbols();
+	}
+
+	return std::atomic_load_explicit(&activeSymbols, std::memory_order_acquire);
+}
+
+// Must be called with m_lock held.
+void SymbolMap::BuildActiveSymbols() const {
 	std::map<int, u32> activeModuleIndexes;
 	for (auto it = activeModuleEnds.begin(), end = activeModuleEnds.end(); it != end; ++it) {
 		activeModuleIndexes[it->second.index] = it->second.start;
 	}
 
-	activeFunctions.clear();
-	activeLabels.clear();
-	activeData.clear();
+	std::vector<std::pair<u32, FunctionEntry>> activeFunctions;
+	std::vector<std::pair<u32, LabelEntry>> activeLabels;
+	std::vector<std::pair<u32, DataEntry>> activeData;
+	activeFunctions.reserve(functions.size());
+	activeLabels.reserve(labels.size());
+	activeData.reserve(data.size());
 
 	for (auto it = functions.begin(), end = functions.end(); it != end; ++it) {
 		const auto mod = activeModuleIndexes.find(it->second.module);
 		if (it->second.module <= 0) {
-			activeFunctions.insert(std::make_pair(it->second.start, it->second));
+			activeFunctions.emplace_back(it->second.start, it->second);
 		} else if (mod != activeModuleIndexes.end()) {
-			activeFunctions.insert(std::make_pair(mod->second + it->second.start, it->second));
+			activeFunctions.emplace_back(mod->second + it->second.start, it->second);
 		}
 	}
 
 	for (auto it = labels.begin(), end = labels.end(); it != end; ++it) {
 		const auto mod = activeModuleIndexes.find(it->second.module);
 		if (it->second.module <= 0) {
-			activeLabels.insert(std::make_pair(it->second.addr, it->second));
+			activeLabels.emplace_back(it->second.addr, it->second);
 		} else if (mod != activeModuleIndexes.end()) {
-			activeLabels.insert(std::make_pair(mod->second + it->second.addr, it->second));
+			activeLabels.emplace_back(mod->second + it->second.addr, it->second);
 		}
 	}
 
 	for (auto it = data.begin(), end = data.end(); it != end; ++it) {
 		const auto mod = activeModuleIndexes.find(it->second.module);
 		if (it->second.module <= 0) {
-			activeData.insert(std::make_pair(it->second.start, it->second));
+			activeData.emplace_back(it->second.start, it->second);
 		} else if (mod != activeModuleIndexes.end()) {
-			activeData.insert(std::make_pair(mod->second + it->second.start, it->second));
+			activeData.emplace_back(mod->second + it->second.start, it->second);
 		}
 	}
 
-	AssignFunctionIndices();
+	auto active = std::make_shared<ActiveSymbols>();
+	BuildActiveList(active->functions, activeFunctions);
+	BuildActiveList(active->labels, activeLabels);
+	BuildActiveList(active->data, activeData);
+	BuildEnclosing(active->functions);
+	BuildEnclosing(active->data);
+
+	std::atomic_store_explicit(&activeSymbols, std::shared_ptr<const ActiveSymbols>(std::move(active)), std::memory_order_release);
+	activeSymbolsStale.store(false, std::memory_order_release);
+}
+
+bool SymbolMap::IsEmpty() const {
+	const auto active = GetActiveSymbols();
+	return active->functions.entries.empty() && active->labels.entries.empty() && active->data.entries.empty();
 }
 
 bool SymbolMap::SetFunctionSize(u32 startAddress, u32 newSize) {
 	std::lock_guard<std::recursive_mutex> guard(m_lock);
 
-	auto funcInfo = activeFunctions.find(startAddress);
-	if (funcInfo != activeFunctions.end()) {
-		auto symbolKey = std::make_pair(funcInfo->second.module, funcInfo->second.start);
+	const auto active = GetActiveSymbols();
+	const u32 funcInfo = FindAtAddress(active->functions, startAddress);
+	if (funcInfo != NO_ENTRY) {
+		const FunctionEntry& entry = active->functions.entries[funcInfo];
+		auto symbolKey = std::make_pair(entry.module, entry.start);
 		auto func = functions.find(symbolKey);
 		if (func != functions.end()) {
 			func->second.size = newSize;
@@ -493,29 +571,29 @@ bool SymbolMap::SetFunctionSize(u32 startAddress, u32 newSize) {
 bool SymbolMap::RemoveFunction(u32 startAddress, bool removeName) {
 	std::lock_guard<std::recursive_mutex> guard(m_lock);
 
-	auto it = activeFunctions.find(startAddress);
-	if (it == activeFunctions.end())
+	const auto active = GetActiveSymbols();
+	const u32 func = FindAtAddress(active->functions, startAddress);
+	if (func == NO_ENTRY)
 		return false;
 
-	auto symbolKey = std::make_pair(it->second.module, it->second.start);
+	auto symbolKey = std::make_pair(active->functions.entries[func].module, active->functions.entries[func].start);
 	auto it2 = functions.find(symbolKey);
 	if (it2 != functions.end()) {
 		functions.erase(it2);
 	}
-	activeFunctions.erase(it);
 
 	if (removeName) {
-		auto labelIt = activeLabels.find(startAddress);
-		if (labelIt != activeLabels.end()) {
-			symbolKey = std::make_pair(labelIt->second.module, labelIt->second.addr);
+		const u32 label = FindAtAddress(active->labels, startAddress);
+		if (label != NO_ENTRY) {
+			symbolKey = std::make_pair(active->labels.entries[label].module, active->labels.entries[label].addr);
 			auto labelIt2 = labels.find(symbolKey);
 			if (labelIt2 != labels.end()) {
 				labels.erase(labelIt2);
 			}
-			activeLabels.erase(labelIt);
 		}
 	}
 
+	InvalidateActiveSymbols();
 	return true;
 }
 
@@ -541,13 +619,7 @@ void SymbolMap::AddLabel(const char* name, u32 address, int moduleIndex) {
 		if (existing->second.module != moduleIndex) {
 			existing->second.addr = relAddress;
 			existing->second.module = moduleIndex;
-
-			// Refresh the active item if it exists.
-			auto active = activeLabels.find(address);
-			if (active != activeLabels.end() && active->second.module == moduleIndex) {
-				activeLabels.erase(active);
-				activeLabels.insert(std::make_pair(address, existing->second));
-			}
+			InvalidateActiveSymbols();
 		}
 	} else {
 		LabelEntry label;
@@ -557,64 +629,55 @@ void SymbolMap::AddLabel(const char* name, u32 address, int moduleIndex) {
 		label.name[127] = 0;
 
 		labels[symbolKey] = label;
-		if (IsModuleActive(moduleIndex)) {
-			activeLabels.insert(std::make_pair(address, label));
-		}
+		InvalidateActiveSymbols();
 	}
 }
 
 void SymbolMap::SetLabelName(const char* name, u32 address, bool updateImmediately) {
 	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	auto labelInfo = activeLabels.find(address);
-	if (labelInfo == activeLabels.end()) {
+	const auto active = GetActiveSymbols();
+	const u32 labelInfo = FindAtAddress(active->labels, address);
+	if (labelInfo == NO_ENTRY) {
 		AddLabel(name, address);
 	} else {
-		auto symbolKey = std::make_pair(labelInfo->second.module, labelInfo->second.addr);
+		auto symbolKey = std::make_pair(active->labels.entries[labelInfo].module, active->labels.entries[labelInfo].addr);
 		auto label = labels.find(symbolKey);
 		if (label != labels.end()) {
 			strncpy(label->second.name, name, ARRAY_SIZE(label->second.name));
 			label->second.name[ARRAY_SIZE(label->second.name) - 1] = 0;
 
-			// Allow the caller to skip this as it causes extreme startup slowdown
-			// when this gets called for every function identified by the function replacement code.
+			// Allow the caller to skip reassigning function indices, as it causes extreme startup
+			// slowdown when this gets called for every function identified by the function replacement code.
 			if (updateImmediately) {
 				UpdateActiveSymbols();
+			} else {
+				InvalidateActiveSymbols();
 			}
 		}
 	}
 }
 
-const char *SymbolMap::GetLabelName(u32 address) const {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	auto it = activeLabels.find(address);
-	if (it == activeLabels.end())
-		return NULL;
-
-	return it->second.name;
-}
-
-const char *SymbolMap::GetLabelNameRel(u32 relAddress, int moduleIndex) const {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	auto it = labels.find(std::make_pair(moduleIndex, relAddress));
-	if (it == labels.end())
+const char *SymbolMap::GetLabelName(const ActiveSymbols& active, u32 address) {
+	const u32 label = FindAtAddress(active.labels, address);
+	if (label == NO_ENTRY)
 		return NULL;
 
-	return it->second.name;
+	return active.labels.entries[label].name;
 }
 
 std::string SymbolMap::GetLabelString(u32 address) const {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	const char *label = GetLabelName(address);
+	const auto active = GetActiveSymbols();
+	const char *label = GetLabelName(*active, address);
 	if (label == NULL)
 		return "";
 	return label;
 }
 
-bool SymbolMap::GetLabelValue(const char* name, u32& dest) {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	for (auto it = activeLabels.begin(); it != activeLabels.end(); it++) {
-		if (strcasecmp(name, it->second.name) == 0) {
-			dest = it->first;
+bool SymbolMap::GetLabelValue(const char* name, u32& dest) const {
+	const auto active = GetActiveSymbols();
+	for (size_t i = 0; i < active->labels.entries.size(); i++) {
+		if (strcasecmp(name, active->labels.entries[i].name) == 0) {
+			dest = active->labels.addresses[i];
 			return true;
 		}
 	}
@@ -645,13 +708,6 @@ void SymbolMap::AddData(u32 address, u32 size, DataType type, int moduleIndex) {
 			existing->second.module = moduleIndex;
 			existing->second.start = relAddress;
 		}
-
-		// Refresh the active item if it exists.
-		auto active = activeData.find(address);
-		if (active != activeData.end() && active->second.module == moduleIndex) {
-			activeData.erase(active);
-			activeData.insert(std::make_pair(address, existing->second));
-		}
 	} else {
 		DataEntry entry;
 		entry.start = relAddress;
@@ -660,54 +716,38 @@ void SymbolMap::AddData(u32 address, u32 size, DataType type, int moduleIndex) {
 		entry.module = moduleIndex;
 
 		data[symbolKey] = entry;
-		if (IsModuleActive(moduleIndex)) {
-			activeData.insert(std::make_pair(address, entry));
-		}
 	}
+
+	InvalidateActiveSymbols();
 }
 
-u32 SymbolMap::GetDataStart(u32 address) const {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	auto it = activeData.upper_bound(address);
-	if (it == activeData.end())
-	{
-		// check last element
-		auto rit = activeData.rbegin();
-
-		if (rit != activeData.rend())
-		{
-			u32 start = rit->first;
-			u32 size = rit->second.size;
-			if (start <= address && start+size > address)
-				return start;
-		}
-		// otherwise there's no data that contains this address
+u32 SymbolMap::GetDataStart(const ActiveSymbols& active, u32 address) {
+	const u32 entry = FindContaining(active.data, address);
+	if (entry == NO_ENTRY)
 		return INVALID_ADDRESS;
-	}
 
-	if (it != activeData.begin()) {
-		it--;
-		u32 start = it->first;
-		u32 size = it->second.size;
-		if (start <= address && start+size > address)
-			return start;
-	}
+	return active.data.addresses[entry];
+}
 
-	return INVALID_ADDRESS;
+u32 SymbolMap::GetDataStart(u32 address) const {
+	return GetDataStart(*GetActiveSymbols(), address);
 }
 
-u32 SymbolMap::GetDataSize(u32 startAddress) const {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	auto it = activeData.find(startAddress);
-	if (it == activeData.end())
+u32 SymbolMap::GetDataSize(const ActiveSymbols& active, u32 startAddress) {
+	const u32 entry = FindAtAddress(active.data, startAddress);
+	if (entry == NO_ENTRY)
 		return INVALID_ADDRESS;
-	return it->second.size;
+	return active.data.entries[entry].size;
+}
+
+u32 SymbolMap::GetDataSize(u32 startAddress) const {
+	return GetDataSize(*GetActiveSymbols(), startAddress);
 }
 
 DataType SymbolMap::GetDataType(u32 startAddress) const {
-	std::lock_guard<std::recursive_mutex> guard(m_lock);
-	auto it = activeData.find(startAddress);
-	if (it == activeData.end())
+	const auto active = GetActiveSymbols();
+	const u32 entry = FindAtAddress(active->data, startAddress);
+	if (entry == NO_ENTRY)
 		return DATATYPE_NONE;
-	return it->second.type;
+	return active->data.entries[entry].type;
 }
@@ -20,6 +20,8 @@
 #include <map>
 #include <string>
 #include <mutex>
+#include <memory>
+#include <atomic>
 
 #include "common/Pcsx2Types.h"
 
@@ -55,7 +57,7 @@ enum DataType {
 
 class SymbolMap {
 public:
-	SymbolMap() {}
+	SymbolMap();
 	void Clear();
 	void SortSymbols();
 
@@ -63,9 +65,9 @@ public:
 
 	SymbolType GetSymbolType(u32 address) const;
 	bool GetSymbolInfo(SymbolInfo *info, u32 address, SymbolType symmask = ST_FUNCTION) const;
-	u32 GetNextSymbolAddress(u32 address, SymbolType symmask);
+	u32 GetNextSymbolAddress(u32 address, SymbolType symmask) const;
 	std::string GetDescription(unsigned int address) const;
-	std::vector<SymbolEntry> GetAllSymbols(SymbolType symmask);
+	std::vector<SymbolEntry> GetAllSymbols(SymbolType symmask) const;
 
 	void AddModule(const char *name, u32 address, u32 size);
 	void UnloadModule(u32 address, u32 size);
@@ -85,7 +87,7 @@ public:
 	void AddLabel(const char* name, u32 address, int moduleIndex = -1);
 	std::string GetLabelString(u32 address) const;
 	void SetLabelName(const char* name, u32 address, bool updateImmediately = true);
-	bool GetLabelValue(const char* name, u32& dest);
+	bool GetLabelValue(const char* name, u32& dest) const;
 
 	void AddData(u32 address, u32 size, DataType type, int moduleIndex = -1);
 	u32 GetDataStart(u32 address) const;
@@ -95,11 +97,20 @@ public:
 	static const u32 INVALID_ADDRESS = (u32)-1;
 
 	void UpdateActiveSymbols();
-	bool IsEmpty() const { return activeFunctions.empty() && activeLabels.empty() && activeData.empty(); };
+	bool IsEmpty() const;
 private:
+	struct ActiveSymbols;
+
 	void AssignFunctionIndices();
-	const char *GetLabelName(u32 address) const;
-	const char *GetLabelNameRel(u32 relAddress, int moduleIndex) const;
+	void InvalidateActiveSymbols();
+	std::shared_ptr<const ActiveSymbols> GetActiveSymbols() const;
+	void BuildActiveSymbols() const;
+
+	static u32 GetFunctionStart(const ActiveSymbols& active, u32 address);
+	static u32 GetFunctionSize(const ActiveSymbols& active, u32 startAddress);
+	static u32 GetDataStart(const ActiveSymbols& active, u32 address);
+	static u32 GetDataSize(const ActiveSymbols& active, u32 startAddress);
+	static const char *GetLabelName(const ActiveSymbols& active, u32 address);
 
 	struct FunctionEntry {
 		u32 start;
@@ -129,10 +140,29 @@ private:
 		char name[128];
 	};
 
-	// These are flattened, read-only copies of the actual data in active modules only.
-	std::map<u32, const FunctionEntry> activeFunctions;
-	std::map<u32, const LabelEntry> activeLabels;
-	std::map<u32, const DataEntry> activeData;
+	// Flattened, read-only copies of the actual data in active modules only, sorted by
+	// absolute address.  A snapshot is never modified once published: readers grab the
+	// current one without taking m_lock, and writers only mark it stale.  The next reader
+	// rebuilds it (under m_lock) and swaps it in, so bulk imports pay for a single rebuild.
+	template <typename T>
+	struct ActiveList {
+		// Kept apart from the entries, so that searches only touch the addresses.
+		std::vector<u32> addresses;
+		std::vector<T> entries;
+
+		// Functions and data only: index of the closest earlier range ending after each
+		// range, so looking up the range containing an address skips those that can't.
+		std::vector<u32> enclosing;
+	};
+
+	struct ActiveSymbols {
+		ActiveList<FunctionEntry> functions;
+		ActiveList<LabelEntry> labels;
+		ActiveList<DataEntry> data;
+	};
+
+	mutable std::shared_ptr<const ActiveSymbols> activeSymbols;
+	mutable std::atomic<bool> activeSymbolsStale;
 
 	// This is indexed by the end address of the module.
 	std::map<u32, const ModuleEntry> activeModuleEnds;
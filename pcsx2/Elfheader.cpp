@@ -321,12 +321,17 @@ void ElfObject::loadHeaders()
 //   1 - PS1 CD
 //   2 - PS2 CD
 int GetPS2ElfName( std::string& name )
+{
+	IsoFSCDVD isofs;
+	return GetPS2ElfName( isofs, name );
+}
+
+int GetPS2ElfName( SectorSource& source, std::string& name )
 {
 	int retype = 0;
 
 	try {
-		IsoFSCDVD isofs;
-		IsoFile file( isofs, "SYSTEM.CNF;1");
+		IsoFile file( source, "SYSTEM.CNF;1");
 
 		int size = file.getLength();
 		if( size == 0 ) return 0;
@@ -156,6 +156,7 @@ class ElfObject
 //-------------------
 extern void loadElfFile(const std::string& filename);
 extern int  GetPS2ElfName( std::string& dest );
+extern int  GetPS2ElfName( SectorSource& source, std::string& dest );
 
 
 extern u32 ElfCRC;
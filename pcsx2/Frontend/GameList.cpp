@@ -23,16 +23,21 @@
 #include "common/Path.h"
 #include "common/ProgressCallback.h"
 #include "common/StringUtil.h"
+#include "common/Timer.h"
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
 #include <cstdio>
 #include <ctime>
 #include <fstream>
+#include <mutex>
 #include <string_view>
+#include <thread>
 #include <utility>
 
 #include "CDVD/CDVD.h"
+#include "CDVD/IsoFileFormats.h"
 #include "Elfheader.h"
 #include "VMManager.h"
 
@@ -56,6 +61,7 @@ namespace GameList
 		const char* path, bool recursive, bool only_cache, const std::vector<std::string>& excluded_paths, ProgressCallback* progress);
 	static bool AddFileFromCache(const std::string& path, std::time_t timestamp);
 	static bool ScanFile(std::string path, std::time_t timestamp);
+	static void ScanFiles(const std::vector<FILESYSTEM_FIND_DATA*>& files, u32 progress_base, ProgressCallback* progress);
 
 	static void LoadCache();
 	static bool LoadEntriesFromCache(std::FILE* stream);
@@ -71,6 +77,7 @@ static std::vector<GameList::Entry> m_entries;
 static std::recursive_mutex s_mutex;
 static GameList::CacheMap m_cache_map;
 static std::FILE* m_cache_write_stream = nullptr;
+static std::mutex s_cache_write_mutex;
 
 static bool m_game_list_loaded = false;
 
@@ -186,12 +193,23 @@ bool GameList::GetIsoListEntry(const std::string& path, GameList::Entry* entry)
 	if (!FileSystem::StatFile(path.c_str(), &sd))
 		return false;
 
-	// This isn't great, we really want to make it all thread-local...
-	CDVD = &CDVDapi_Iso;
-	if (CDVD->open(path.c_str()) != 0)
+	// Use our own reader rather than the CDVD source, so that entries can be scanned in parallel.
+	std::unique_ptr<InputIsoFile> iso(std::make_unique<InputIsoFile>());
+	try
+	{
+		if (!iso->Open(path) || iso->GetType() == ISOTYPE_AUDIO)
+			return false;
+	}
+	catch (BaseException& ex)
+	{
+		Console.Error(ex.FormatDiagnosticMessage());
 		return false;
+	}
 
-	const s32 type = DoCDVDdetectDiskType();
+	InputIsoFileSource source(*iso);
+	std::string serial;
+	u32 crc;
+	const s32 type = cdvdGetDiscInfo(source, &serial, &crc);
 	switch (type)
 	{
 		case CDVD_TYPE_PSCD:
@@ -207,26 +225,15 @@ bool GameList::GetIsoListEntry(const std::string& path, GameList::Entry* entry)
 
 		case CDVD_TYPE_ILLEGAL:
 		default:
-			DoCDVDclose();
 			return false;
 	}
 
-	cdvdReloadElfInfo();
-
 	entry->path = path;
-	entry->serial = DiscSerial;
-	entry->crc = ElfCRC;
+	entry->serial = std::move(serial);
+	entry->crc = crc;
 	entry->total_size = sd.Size;
 	entry->compatibility_rating = CompatibilityRating::Unknown;
 
-	DoCDVDclose();
-
-	// TODO(Stenzek): These globals are **awful**. Clean it up.
-	DiscSerial.clear();
-	ElfCRC = 0;
-	ElfEntry = -1;
-	LastELF.clear();
-
 	if (const GameDatabaseSchema::GameEntry* db_entry = GameDatabase::findGame(entry->serial))
 	{
 		entry->title = std::move(db_entry->name);
@@ -551,13 +558,14 @@ void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache,
 	progress->SetProgressRange(static_cast<u32>(files.size()));
 	progress->SetProgressValue(0);
 
+	// Pick up everything we can from the cache first, leaving only the files which have to be opened.
+	std::vector<FILESYSTEM_FIND_DATA*> scan_files;
 	for (FILESYSTEM_FIND_DATA& ffd : files)
 	{
-		files_scanned++;
-
 		if (progress->IsCancelled() || !GameList::IsScannableFilename(ffd.FileName) ||
 			IsPathExcluded(excluded_paths, ffd.FileName))
 		{
+			files_scanned++;
 			continue;
 		}
 
@@ -567,20 +575,76 @@ void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache,
 				AddFileFromCache(ffd.FileName, ffd.ModificationTime) ||
 				only_cache)
 			{
+				files_scanned++;
 				continue;
 			}
 		}
 
-		// ownership of fp is transferred
-		progress->SetFormattedStatusText("Scanning '%s'...", FileSystem::GetDisplayNameFromPath(ffd.FileName).c_str());
-		ScanFile(std::move(ffd.FileName), ffd.ModificationTime);
-		progress->SetProgressValue(files_scanned);
+		scan_files.push_back(&ffd);
 	}
 
 	progress->SetProgressValue(files_scanned);
+	if (!scan_files.empty())
+		ScanFiles(scan_files, files_scanned, progress);
+
+	progress->SetProgressValue(static_cast<u32>(files.size()));
 	progress->PopState();
 }
 
+void GameList::ScanFiles(const std::vector<FILESYSTEM_FIND_DATA*>& files, u32 progress_base, ProgressCallback* progress)
+{
+	// 0 uses every hardware thread, 1 scans on the calling thread only.
+	u32 num_threads = static_cast<u32>(std::max(Host::GetIntSettingValue("GameList", "ScanThreads", 0), 0));
+	if (num_threads == 0)
+		num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+	num_threads = std::min(num_threads, static_cast<u32>(files.size()));
+
+	Common::Timer timer;
+	std::atomic<size_t> next_file{0};
+	std::atomic<u32> files_done{0};
+	std::atomic_bool cancelled{false};
+
+	// Only the calling thread touches the progress callback, the others just scan.
+	const auto scan_worker = [&](bool report) {
+		for (;;)
+		{
+			const size_t index = next_file.fetch_add(1, std::memory_order_relaxed);
+			if (index >= files.size() || cancelled.load(std::memory_order_relaxed))
+				break;
+
+			FILESYSTEM_FIND_DATA* ffd = files[index];
+			if (report)
+				progress->SetFormattedStatusText("Scanning '%s'...", FileSystem::GetDisplayNameFromPath(ffd->FileName).c_str());
+
+			// ownership of the filename is transferred
+			ScanFile(std::move(ffd->FileName), ffd->ModificationTime);
+			files_done.fetch_add(1, std::memory_order_relaxed);
+
+			if (report)
+			{
+				progress->SetProgressValue(progress_base + files_done.load(std::memory_order_relaxed));
+				if (progress->IsCancelled())
+					cancelled.store(true, std::memory_order_relaxed);
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(num_threads - 1);
+	for (u32 i = 1; i < num_threads; i++)
+		threads.emplace_back(scan_worker, false);
+
+	scan_worker(true);
+
+	for (std::thread& thread : threads)
+		thread.join();
+
+	const double seconds = timer.GetTimeSeconds();
+	const u32 count = files_done.load(std::memory_order_relaxed);
+	Console.WriteLn("Scanned %u files in %.2f seconds (%.1f files/sec, %u threads)", count, seconds,
+		(seconds > 0.0) ? (count / seconds) : 0.0, num_threads);
+}
+
 bool GameList::AddFileFromCache(const std::string& path, std::time_t timestamp)
 {
 	if (std::any_of(m_entries.begin(), m_entries.end(), [&path](const Entry& other) { return other.path == path; }))
@@ -608,10 +672,13 @@ bool GameList::ScanFile(std::string path, std::time_t timestamp)
 	entry.path = std::move(path);
 	entry.last_modified_time = timestamp;
 
-	if (m_cache_write_stream || OpenCacheForWriting())
 	{
-		if (!WriteEntryToCache(&entry))
-			Console.Warning("Failed to write entry '%s' to cache", entry.path.c_str());
+		std::unique_lock cache_lock(s_cache_write_mutex);
+		if (m_cache_write_stream || OpenCacheForWriting())
+		{
+			if (!WriteEntryToCache(&entry))
+				Console.Warning("Failed to write entry '%s' to cache", entry.path.c_str());
+		}
 	}
 
 	std::unique_lock lock(s_mutex);
@@ -722,6 +722,25 @@ void ImGuiManager::DrawPerformanceOverlay()
 				FormatProcessorStat(text, PerformanceMetrics::GetVUThreadUsage(), PerformanceMetrics::GetVUThreadAverageTime());
 				DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 			}
+
+			if (EmuConfig.EnableRewind)
+			{
+				text.clear();
+				fmt::format_to(std::back_inserter(text), "Rewind: {} states, {:.1f}MB ({:.2f}ms capture, {:.2f}ms compress)",
+					PerformanceMetrics::GetRewindStateCount(),
+					static_cast<double>(PerformanceMetrics::GetRewindMemoryUsage()) / 1048576.0,
+					PerformanceMetrics::GetRewindCaptureTime(), PerformanceMetrics::GetRewindCompressTime());
+				DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
+			}
+
+			if (EmuConfig.RunAheadFrames > 0)
+			{
+				text.clear();
+				fmt::format_to(std::back_inserter(text), "Run-Ahead: {} frames ({:.2f}ms capture, {:.2f}ms restore)",
+					EmuConfig.RunAheadFrames, PerformanceMetrics::GetRunAheadCaptureTime(),
+					PerformanceMetrics::GetRunAheadRestoreTime());
+				DRAW_LINE(s_fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
+			}
 		}
 
 		if (GSConfig.OsdShowGPU)
@@ -361,13 +361,13 @@ void gsIrq() {
 //These are done at VSync Start.  Drawing is done when VSync is off, then output the screen when Vsync is on
 //The GS needs to be told at the start of a vsync else it loses half of its picture (could be responsible for some halfscreen issues)
 //We got away with it before i think due to our awful GS timing, but now we have it right (ish)
-void gsPostVsyncStart()
+void gsPostVsyncStart(bool skip_present, bool rolled_back)
 {
 	//gifUnit.FlushToMTGS();  // Needed for some (broken?) homebrew game loaders
 	
 	const bool registers_written = s_GSRegistersWritten;
 	s_GSRegistersWritten = false;
-	GetMTGS().PostVsyncStart(registers_written);
+	GetMTGS().PostVsyncStart(registers_written, skip_present, rolled_back);
 }
 
 void SaveStateBase::gsFreeze()
@@ -29,6 +29,10 @@
 #include "Renderers/HW/GSTextureReplacements.h"
 #include "GSLzma.h"
 
+#define XXH_STATIC_LINKING_ONLY 1
+#define XXH_INLINE_ALL 1
+#include "xxhash.h"
+
 #include "common/Console.h"
 #include "common/FileSystem.h"
 #include "common/Path.h"
@@ -502,11 +506,11 @@ void GSgifTransfer3(u8* mem, u32 size)
 	}
 }
 
-void GSvsync(u32 field, bool registers_written)
+void GSvsync(u32 field, bool registers_written, bool skip_present, bool rolled_back)
 {
 	try
 	{
-		g_gs_renderer->VSync(field, registers_written);
+		g_gs_renderer->VSync(field, registers_written, skip_present, rolled_back);
 	}
 	catch (GSRecoverableError)
 	{
@@ -557,6 +561,11 @@ void GSStopGSDump()
 		g_gs_renderer->StopGSDump();
 }
 
+bool GSIsDumping()
+{
+	return GSRenderer::IsDumpActive();
+}
+
 void GSPresentCurrentFrame()
 {
 	g_gs_renderer->PresentCurrentFrame();
@@ -913,6 +922,33 @@ bool GSSaveSnapshotToMemory(u32 width, u32 height, std::vector<u32>* pixels)
 	return g_gs_renderer->SaveSnapshotToMemory(width, height, pixels);
 }
 
+bool GSGetCurrentFrameHash(u64* hash)
+{
+	GSTexture* const current = g_gs_device ? g_gs_device->GetCurrent() : nullptr;
+	if (!current)
+		return false;
+
+	// Read back the whole frame at internal resolution without filtering, so the hash
+	// only depends on what the renderer drew, not on the window or crop settings.
+	const GSVector2i size(current->GetSize());
+	GSTexture::GSMap map;
+	if (!g_gs_device->DownloadTextureConvert(current, GSVector4(0.0f, 0.0f, 1.0f, 1.0f), size,
+			GSTexture::Format::Color, ShaderConvert::COPY, map, false))
+	{
+		return false;
+	}
+
+	XXH3_state_t state;
+	XXH3_64bits_reset(&state);
+	XXH3_64bits_update(&state, &size, sizeof(size));
+	for (int y = 0; y < size.y; y++)
+		XXH3_64bits_update(&state, map.bits + static_cast<size_t>(y) * map.pitch, size.x * sizeof(u32));
+	*hash = XXH3_64bits_digest(&state);
+
+	g_gs_device->DownloadTextureComplete();
+	return true;
+}
+
 std::string format(const char* fmt, ...)
 {
 	va_list args;
@@ -1407,6 +1443,9 @@ void GSApp::Init()
 	m_gs_dump_compression.push_back(GSSetting(static_cast<u32>(GSDumpCompressionMethod::LZMA), "LZMA (xz)", ""));
 	m_gs_dump_compression.push_back(GSSetting(static_cast<u32>(GSDumpCompressionMethod::Zstandard), "Zstandard (zst)", ""));
 
+	m_gs_capture_format.push_back(GSSetting(0, "PNG Sequence", ""));
+	m_gs_capture_format.push_back(GSSetting(1, "Y4M Stream", "Uncompressed, audio as WAV"));
+
 	// clang-format off
 	// Avoid to clutter the ini file with useless options
 #if defined(ENABLE_VULKAN) || defined(_WIN32)
@@ -1424,6 +1463,7 @@ void GSApp::Init()
 	m_default_configuration["AspectRatio"]                                = "1";
 	m_default_configuration["autoflush_sw"]                               = "1";
 	m_default_configuration["capture_enabled"]                            = "0";
+	m_default_configuration["capture_format"]                             = "0";
 	m_default_configuration["capture_out_dir"]                            = "/tmp/GS_Capture";
 	m_default_configuration["capture_threads"]                            = "4";
 	m_default_configuration["CaptureHeight"]                              = "480";
@@ -67,10 +67,11 @@ void GSgifTransfer(const u8* mem, u32 size);
 void GSgifTransfer1(u8* mem, u32 addr);
 void GSgifTransfer2(u8* mem, u32 size);
 void GSgifTransfer3(u8* mem, u32 size);
-void GSvsync(u32 field, bool registers_written);
+void GSvsync(u32 field, bool registers_written, bool skip_present, bool rolled_back);
 int GSfreeze(FreezeAction mode, freezeData* data);
 void GSQueueSnapshot(const std::string& path, u32 gsdump_frames = 0);
 void GSStopGSDump();
+bool GSIsDumping();
 void GSPresentCurrentFrame();
 #ifndef PCSX2_CORE
 void GSkeyEvent(const HostKeyEvent& e);
@@ -91,6 +92,7 @@ void GSSwitchRenderer(GSRendererType new_renderer);
 void GSResetAPIState();
 void GSRestoreAPIState();
 bool GSSaveSnapshotToMemory(u32 width, u32 height, std::vector<u32>* pixels);
+bool GSGetCurrentFrameHash(u64* hash);
 
 class GSApp
 {
@@ -143,6 +145,7 @@ public:
 	std::vector<GSSetting> m_gs_acc_blend_level;
 	std::vector<GSSetting> m_gs_tv_shaders;
 	std::vector<GSSetting> m_gs_dump_compression;
+	std::vector<GSSetting> m_gs_capture_format;
 };
 
 struct GSError
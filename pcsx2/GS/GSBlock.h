@@ -39,6 +39,8 @@ class GSBlock
 	static const GSVector4i m_uw8hmask2;
 	static const GSVector4i m_uw8hmask3;
 
+	static const GSVector4i m_rp24mask;
+
 #if _M_SSE >= 0x501
 	// Equvialent of `a = *s0; b = *s1; sw128(a, b);`
 	// Loads in two halves instead to reduce shuffle instructions
@@ -917,6 +919,93 @@ public:
 		ReadBlockHP<28, 0xffffffff>(src, dst, dstpitch);
 	}
 
+	// Inverse of UnpackAndWriteBlock24, drops the alpha byte of each pixel (8x8 pixels, 24 bytes per row)
+	__forceinline static void ReadAndPackBlock24(const u8* RESTRICT src, u8* RESTRICT dst, int dstpitch)
+	{
+		const GSVector4i* s = (const GSVector4i*)src;
+
+		GSVector4i v0, v1, v2, v3;
+
+		GSVector4i mask = m_rp24mask;
+
+		for (int i = 0; i < 4; i++)
+		{
+			v0 = s[i * 4 + 0];
+			v1 = s[i * 4 + 1];
+			v2 = s[i * 4 + 2];
+			v3 = s[i * 4 + 3];
+
+			GSVector4i::sw64(v0, v1, v2, v3);
+
+			v0 = v0.shuffle8(mask);
+			v1 = v1.shuffle8(mask);
+			v2 = v2.shuffle8(mask);
+			v3 = v3.shuffle8(mask);
+
+			GSVector4i::store<false>(&dst[0], v0 | v1.sll<12>());
+			GSVector4i::storel(&dst[16], v1.srl<4>());
+
+			dst += dstpitch;
+
+			GSVector4i::store<false>(&dst[0], v2 | v3.sll<12>());
+			GSVector4i::storel(&dst[16], v3.srl<4>());
+
+			dst += dstpitch;
+		}
+	}
+
+	// Inverse of UnpackAndWriteBlockH for 4 bit formats, two pixels per byte with the even one in the low nibble (8x8 pixels, 4 bytes per row)
+	template <u32 shift, u32 mask>
+	__forceinline static void ReadAndPackBlockH4(const u8* RESTRICT src, u8* RESTRICT dst, int dstpitch)
+	{
+		const GSVector4i* s = (const GSVector4i*)src;
+
+		GSVector4i v0, v1, v2, v3;
+
+		GSVector4i maskvec(mask);
+
+		for (int i = 0; i < 4; i++)
+		{
+			v0 = s[i * 4 + 0];
+			v1 = s[i * 4 + 1];
+			v2 = s[i * 4 + 2];
+			v3 = s[i * 4 + 3];
+
+			GSVector4i::sw64(v0, v1, v2, v3);
+
+			v0 = ((v0 >> shift).ps32(v1 >> shift)).pu16((v2 >> shift).ps32(v3 >> shift));
+
+			if (mask != 0xffffffff)
+				v0 = v0 & maskvec;
+
+			v0 = (v0 | v0.srl16(4)) & GSVector4i::x00ff();
+			v0 = v0.pu16(v0);
+
+			*(u32*)&dst[0] = v0.extract32<0>();
+
+			dst += dstpitch;
+
+			*(u32*)&dst[0] = v0.extract32<1>();
+
+			dst += dstpitch;
+		}
+	}
+
+	__forceinline static void ReadAndPackBlock8H(const u8* RESTRICT src, u8* RESTRICT dst, int dstpitch)
+	{
+		ReadBlock8HP(src, dst, dstpitch);
+	}
+
+	__forceinline static void ReadAndPackBlock4HL(const u8* RESTRICT src, u8* RESTRICT dst, int dstpitch)
+	{
+		ReadAndPackBlockH4<24, 0x0f0f0f0f>(src, dst, dstpitch);
+	}
+
+	__forceinline static void ReadAndPackBlock4HH(const u8* RESTRICT src, u8* RESTRICT dst, int dstpitch)
+	{
+		ReadAndPackBlockH4<28, 0xffffffff>(src, dst, dstpitch);
+	}
+
 	template <bool AEM, class V>
 	__forceinline static V Expand24to32(const V& c, const V& TA0)
 	{
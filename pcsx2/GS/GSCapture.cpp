@@ -18,7 +18,10 @@
 #include "GSPng.h"
 #include "GSUtil.h"
 #include "GSExtra.h"
+#include "common/FileSystem.h"
 #include "common/StringUtil.h"
+#include <cinttypes>
+#include <numeric>
 
 #ifdef _WIN32
 
@@ -388,6 +391,132 @@ static wil::com_ptr_nothrow<IPin> GetFirstPin(IBaseFilter* pBF, PIN_DIRECTION di
 	return result;
 }
 
+#elif defined(__unix__)
+
+//
+// GSCapture::Y4MWriter
+//
+
+struct GSCapture::Y4MFrame
+{
+	std::unique_ptr<u8[]> bits;
+	int pitch;
+	bool rgba;
+};
+
+class GSCapture::Y4MWriter
+{
+	FILE* m_fp;
+	int m_width;
+	int m_height;
+	std::unique_ptr<u8[]> m_yuv;
+
+	// Declared last, the writer thread may start as soon as it is constructed.
+	GSJobQueue<std::shared_ptr<Y4MFrame>, 16> m_queue;
+
+	static constexpr int Coef(int lo, int hi)
+	{
+		return static_cast<int>((static_cast<u32>(hi & 0xffff) << 16) | static_cast<u32>(lo & 0xffff));
+	}
+
+	/// BT.601 limited range, chroma is the average of each 2x2 block. Width must be a multiple of 4, height of 2.
+	static void ConvertToYUV420(const u8* src, int pitch, int w, int h, bool rgba, u8* y_plane, u8* u_plane, u8* v_plane)
+	{
+		// Channel 0/2 coefficients apply to the low/high half of each 32-bit lane of (pixel & 0x00ff00ff),
+		// channel 1/3 to ((pixel >> 8) & 0x00ff00ff). Swap R and B for BGRA input.
+		const GSVector4i y_02(rgba ? Coef(66, 25) : Coef(25, 66));
+		const GSVector4i y_13(Coef(129, 0));
+		const GSVector4i u_02(rgba ? Coef(-38, 112) : Coef(112, -38));
+		const GSVector4i u_13(Coef(-74, 0));
+		const GSVector4i v_02(rgba ? Coef(112, -18) : Coef(-18, 112));
+		const GSVector4i v_13(Coef(-94, 0));
+		const GSVector4i mask(0x00ff00ff);
+
+		for (int row = 0; row < h; row += 2)
+		{
+			const u8* s0 = src + row * pitch;
+			const u8* s1 = s0 + pitch;
+			u8* y0 = y_plane + row * w;
+			u8* y1 = y0 + w;
+			u8* up = u_plane + (row / 2) * (w / 2);
+			u8* vp = v_plane + (row / 2) * (w / 2);
+
+			for (int x = 0; x < w; x += 4)
+			{
+				const GSVector4i p0 = GSVector4i::load<false>(s0 + x * 4);
+				const GSVector4i p1 = GSVector4i::load<false>(s1 + x * 4);
+				const GSVector4i p0_02 = p0 & mask;
+				const GSVector4i p0_13 = p0.srl32(8) & mask;
+				const GSVector4i p1_02 = p1 & mask;
+				const GSVector4i p1_13 = p1.srl32(8) & mask;
+
+				const GSVector4i luma0 = p0_02.madd(y_02).add32(p0_13.madd(y_13)).add32(GSVector4i(128)).sra32(8).add32(GSVector4i(16));
+				const GSVector4i luma1 = p1_02.madd(y_02).add32(p1_13.madd(y_13)).add32(GSVector4i(128)).sra32(8).add32(GSVector4i(16));
+				const GSVector4i luma = luma0.ps32(luma1).pu16();
+				const int luma0_bits = luma.extract32<0>();
+				const int luma1_bits = luma.extract32<1>();
+				std::memcpy(y0 + x, &luma0_bits, sizeof(luma0_bits));
+				std::memcpy(y1 + x, &luma1_bits, sizeof(luma1_bits));
+
+				// Sum the two rows, then neighbouring pixels, leaving 2x2 sums in lanes 0 and 2.
+				GSVector4i sum_02 = p0_02.add16(p1_02);
+				GSVector4i sum_13 = p0_13.add16(p1_13);
+				sum_02 = sum_02.add16(sum_02.srl<4>());
+				sum_13 = sum_13.add16(sum_13.srl<4>());
+
+				const GSVector4i cb = sum_02.madd(u_02).add32(sum_13.madd(u_13)).add32(GSVector4i(512)).sra32(10).add32(GSVector4i(128));
+				const GSVector4i cr = sum_02.madd(v_02).add32(sum_13.madd(v_13)).add32(GSVector4i(512)).sra32(10).add32(GSVector4i(128));
+				up[x / 2] = static_cast<u8>(cb.extract32<0>());
+				up[x / 2 + 1] = static_cast<u8>(cb.extract32<2>());
+				vp[x / 2] = static_cast<u8>(cr.extract32<0>());
+				vp[x / 2 + 1] = static_cast<u8>(cr.extract32<2>());
+			}
+		}
+	}
+
+	void WriteFrame(std::shared_ptr<Y4MFrame>& frame)
+	{
+		u8* y_plane = m_yuv.get();
+		u8* u_plane = y_plane + m_width * m_height;
+		u8* v_plane = u_plane + (m_width / 2) * (m_height / 2);
+		ConvertToYUV420(frame->bits.get(), frame->pitch, m_width, m_height, frame->rgba, y_plane, u_plane, v_plane);
+
+		static constexpr char frame_header[] = "FRAME\n";
+		const size_t size = m_width * m_height * 3 / 2;
+		if (std::fwrite(frame_header, sizeof(frame_header) - 1, 1, m_fp) != 1 || std::fwrite(m_yuv.get(), size, 1, m_fp) != 1)
+			fprintf(stderr, "GSCapture: Failed to write Y4M frame\n");
+	}
+
+public:
+	Y4MWriter(FILE* fp, int width, int height)
+		: m_fp(fp)
+		, m_width(width)
+		, m_height(height)
+		, m_yuv(std::make_unique<u8[]>(width * height * 3 / 2))
+		// Disk bound, parks straight away like the PNG workers.
+		, m_queue([]() { Threading::SetNameOfCurrentThread("GS Capture Writer"); },
+			  [this](std::shared_ptr<Y4MFrame>& frame) { WriteFrame(frame); }, {}, 0)
+	{
+	}
+
+	~Y4MWriter()
+	{
+		m_queue.Wait();
+		std::fclose(m_fp);
+	}
+
+	/// Copies the frame and queues it, blocks when the writer is 16 frames behind.
+	void Push(const void* bits, int pitch, bool rgba)
+	{
+		std::shared_ptr<Y4MFrame> frame = std::make_shared<Y4MFrame>();
+		frame->bits = std::make_unique<u8[]>(pitch * m_height);
+		frame->pitch = pitch;
+		frame->rgba = rgba;
+		std::memcpy(frame->bits.get(), bits, pitch * m_height);
+		m_queue.Push(frame);
+	}
+};
+
 #endif
 
 //
@@ -422,6 +551,7 @@ bool GSCapture::BeginCapture(float fps, GSVector2i recommendedResolution, float
 	m_threads = theApp.GetConfigI("capture_threads");
 #if defined(__unix__)
 	m_compression_level = theApp.GetConfigI("png_compression_level");
+	const bool y4m = (theApp.GetConfigI("capture_format") == 1);
 #endif
 
 #ifdef _WIN32
@@ -540,9 +670,41 @@ bool GSCapture::BeginCapture(float fps, GSVector2i recommendedResolution, float
 	m_size.x = theApp.GetConfigI("CaptureWidth");
 	m_size.y = theApp.GetConfigI("CaptureHeight");
 
+	if (y4m)
+	{
+		// A single uncompressed stream, 4:2:0 needs even dimensions and the converter works on 4 pixels at a time.
+		m_size.x &= ~3;
+		m_size.y &= ~1;
+
+		const std::string base = m_out_dir + "/" + StringUtil::StdStringFromFormat("capture_%" PRIu64, static_cast<u64>(time(nullptr)));
+		FILE* fp = FileSystem::OpenCFile((base + ".y4m").c_str(), "wb");
+		if (!fp)
+		{
+			fprintf(stderr, "GSCapture: Failed to open %s.y4m\n", base.c_str());
+			return false;
+		}
+
+		// Frame rate and pixel aspect ratio as reduced fractions.
+		const u32 fps_num = static_cast<u32>(std::lround(fps * 1000.0f));
+		const u32 fps_gcd = std::gcd(fps_num, 1000u);
+		const u32 par_num = static_cast<u32>(std::lround(aspect * m_size.y * 1000.0f));
+		const u32 par_den = static_cast<u32>(m_size.x * 1000);
+		const u32 par_gcd = std::max(std::gcd(par_num, par_den), 1u);
+		std::fprintf(fp, "YUV4MPEG2 W%d H%d F%u:%u Ip A%u:%u C420jpeg\n", m_size.x, m_size.y,
+			fps_num / fps_gcd, 1000u / fps_gcd, par_num / par_gcd, par_den / par_gcd);
+
+		m_y4m = std::make_unique<Y4MWriter>(fp, m_size.x, m_size.y);
+
+		m_capturing = true;
+		filename = base + ".wav";
+		return true;
+	}
+
+	// Capture workers get one frame at a time and are never latency critical, so they park
+	// straight away rather than spin on cores the emulator threads need.
 	for (int i = 0; i < m_threads; i++)
 	{
-		m_workers.push_back(std::unique_ptr<GSPng::Worker>(new GSPng::Worker({}, &GSPng::Process, {})));
+		m_workers.push_back(std::unique_ptr<GSPng::Worker>(new GSPng::Worker({}, &GSPng::Process, {}, 0)));
 	}
 
 	m_capturing = true;
@@ -576,6 +738,13 @@ bool GSCapture::DeliverFrame(const void* bits, int pitch, bool rgba)
 
 #elif defined(__unix__)
 
+	if (m_y4m)
+	{
+		m_y4m->Push(bits, pitch, rgba);
+		m_frame++;
+		return true;
+	}
+
 	std::string out_file = m_out_dir + StringUtil::StdStringFromFormat("/frame.%010d.png", m_frame);
 	//GSPng::Save(GSPng::RGB_PNG, out_file, (u8*)bits, m_size.x, m_size.y, pitch, m_compression_level);
 	m_workers[m_frame % m_threads]->Push(std::make_shared<GSPng::Transaction>(GSPng::RGB_PNG, out_file, static_cast<const u8*>(bits), m_size.x, m_size.y, pitch, m_compression_level));
@@ -610,6 +779,7 @@ bool GSCapture::EndCapture()
 
 #elif defined(__unix__)
 	m_workers.clear();
+	m_y4m.reset();
 
 	m_frame = 0;
 
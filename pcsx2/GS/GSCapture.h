@@ -38,8 +38,12 @@ class GSCapture
 
 #elif defined(__unix__)
 
+	struct Y4MFrame;
+	class Y4MWriter;
+
 	u64 m_frame;
 	std::vector<std::unique_ptr<GSPng::Worker>> m_workers;
+	std::unique_ptr<Y4MWriter> m_y4m;
 	int m_compression_level;
 
 #endif
@@ -110,6 +110,25 @@ bool GSDumpBase::VSync(int field, bool last, const GSPrivRegSet* regs)
 	return (++m_frames & 1) == 0 && last && (m_extra_frames < 0);
 }
 
+bool GSDumpBase::UpdateStats(Stats* stats)
+{
+	const double elapsed = m_stats_timer.GetTimeSeconds();
+	if (elapsed < 1.0)
+		return false;
+
+	const u64 output_size = m_output_size.load(std::memory_order_relaxed);
+	stats->input_rate = static_cast<double>(m_input_size - m_stats_last_input) / elapsed;
+	stats->output_rate = static_cast<double>(output_size - m_stats_last_output) / elapsed;
+	stats->output_size = output_size;
+	stats->queue_depth = GetQueueDepth();
+	stats->queue_capacity = GetQueueCapacity();
+
+	m_stats_last_input = m_input_size;
+	m_stats_last_output = output_size;
+	m_stats_timer.Reset();
+	return true;
+}
+
 void GSDumpBase::Write(const void* data, size_t size)
 {
 	if (!m_gs || size == 0)
@@ -118,6 +137,8 @@ void GSDumpBase::Write(const void* data, size_t size)
 	size_t written = fwrite(data, 1, size, m_gs);
 	if (written != size)
 		fprintf(stderr, "GSDump: Error failed to write data\n");
+
+	m_output_size.fetch_add(written, std::memory_order_relaxed);
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -134,14 +155,139 @@ GSDumpUncompressed::GSDumpUncompressed(const std::string& fn, const std::string&
 
 void GSDumpUncompressed::AppendRawData(const void* data, size_t size)
 {
+	m_input_size += size;
 	Write(data, size);
 }
 
 void GSDumpUncompressed::AppendRawData(u8 c)
 {
+	m_input_size++;
 	Write(&c, 1);
 }
 
+//////////////////////////////////////////////////////////////////////
+// GSDumpCompressed implementation
+//////////////////////////////////////////////////////////////////////
+
+GSDumpCompressed::GSDumpCompressed(std::string fn)
+	: GSDumpBase(std::move(fn))
+{
+}
+
+GSDumpCompressed::~GSDumpCompressed()
+{
+	pxAssertMsg(!m_thread.joinable(), "Compression thread was stopped by the derived class");
+}
+
+void GSDumpCompressed::StartCompressionThread(const char* name)
+{
+	m_thread = std::thread([this, name]() {
+		Threading::SetNameOfCurrentThread(name);
+		ThreadEntryPoint();
+	});
+}
+
+void GSDumpCompressed::StopCompressionThread()
+{
+	if (!m_thread.joinable())
+		return;
+
+	if (m_current_chunk.size > 0)
+		SubmitCurrentChunk();
+
+	m_thread_exit.store(true, std::memory_order_release);
+	m_sema.NotifyOfWork();
+	m_thread.join();
+}
+
+void GSDumpCompressed::ThreadEntryPoint()
+{
+	for (;;)
+	{
+		m_sema.WaitForWork();
+
+		// Everything queued before the exit request is visible once we've seen it, so drain once more.
+		const bool exit = m_thread_exit.load(std::memory_order_acquire);
+
+		Chunk chunk;
+		while (m_full_chunks.pop(chunk))
+		{
+			CompressChunk(chunk.data, chunk.size);
+			m_free_chunks.push(chunk.data);
+		}
+
+		if (exit)
+			break;
+	}
+}
+
+void GSDumpCompressed::SubmitCurrentChunk()
+{
+	// Can't fail, there are never more chunks than queue slots.
+	m_full_chunks.push(m_current_chunk);
+	m_sema.NotifyOfWork();
+	m_current_chunk = {};
+}
+
+void GSDumpCompressed::AppendRawData(const void* data, size_t size)
+{
+	// Nothing will drain the queue if the compressor failed to initialize.
+	if (!m_thread.joinable())
+		return;
+
+	m_input_size += size;
+
+	const u8* src = static_cast<const u8*>(data);
+	while (size > 0)
+	{
+		if (!m_current_chunk.data)
+		{
+			while (!m_free_chunks.pop(m_current_chunk.data))
+			{
+				// Only grow while the compressor is behind, ring buffers keep one slot unused.
+				if (m_chunk_storage.size() < (MAX_QUEUED_CHUNKS - 1))
+				{
+					m_current_chunk.data = m_chunk_storage.emplace_back(std::make_unique<u8[]>(CHUNK_SIZE)).get();
+					break;
+				}
+
+				std::this_thread::yield();
+			}
+		}
+
+		const size_t copy_size = std::min(size, CHUNK_SIZE - m_current_chunk.size);
+		std::memcpy(m_current_chunk.data + m_current_chunk.size, src, copy_size);
+		m_current_chunk.size += copy_size;
+		src += copy_size;
+		size -= copy_size;
+
+		if (m_current_chunk.size == CHUNK_SIZE)
+			SubmitCurrentChunk();
+	}
+}
+
+void GSDumpCompressed::AppendRawData(u8 c)
+{
+	if (m_current_chunk.data && m_current_chunk.size < (CHUNK_SIZE - 1))
+	{
+		m_current_chunk.data[m_current_chunk.size++] = c;
+		m_input_size++;
+		return;
+	}
+
+	AppendRawData(&c, 1);
+}
+
+u32 GSDumpCompressed::GetQueueDepth() const
+{
+	return static_cast<u32>(m_full_chunks.size());
+}
+
+u32 GSDumpCompressed::GetQueueCapacity() const
+{
+	return static_cast<u32>(MAX_QUEUED_CHUNKS - 1);
+}
+
 //////////////////////////////////////////////////////////////////////
 // GSDumpXz implementation
 //////////////////////////////////////////////////////////////////////
@@ -149,82 +295,86 @@ void GSDumpUncompressed::AppendRawData(u8 c)
 GSDumpXz::GSDumpXz(const std::string& fn, const std::string& serial, u32 crc,
 	u32 screenshot_width, u32 screenshot_height, const u32* screenshot_pixels,
 	const freezeData& fd, const GSPrivRegSet* regs)
-	: GSDumpBase(fn + ".gs.xz")
+	: GSDumpCompressed(fn + ".gs.xz")
 {
 	m_strm = LZMA_STREAM_INIT;
-	lzma_ret ret = lzma_easy_encoder(&m_strm, 6 /*level*/, LZMA_CHECK_CRC64);
+
+	// Block based multi-threaded encoder, the decoder handles multiple blocks transparently.
+	lzma_mt mt = {};
+	mt.preset = 6; // level
+	mt.check = LZMA_CHECK_CRC64;
+	mt.threads = std::clamp(lzma_cputhreads(), 1u, 4u);
+	lzma_ret ret = lzma_stream_encoder_mt(&m_strm, &mt);
+	if (ret != LZMA_OK)
+	{
+		Console.Warning("GSDumpXz: Multi-threaded encoder unavailable (error code %u), using a single thread.", ret);
+		ret = lzma_easy_encoder(&m_strm, 6 /*level*/, LZMA_CHECK_CRC64);
+	}
 	if (ret != LZMA_OK)
 	{
 		fprintf(stderr, "GSDumpXz: Error initializing LZMA encoder ! (error code %u)\n", ret);
 		return;
 	}
 
+	m_out_buff.resize(_1mb);
+
+	StartCompressionThread("GS Dump Compressor");
 	AddHeader(serial, crc, screenshot_width, screenshot_height, screenshot_pixels, fd, regs);
 }
 
 GSDumpXz::~GSDumpXz()
 {
-	Flush();
+	StopCompressionThread();
 
 	// Finish the stream
-	m_strm.avail_in = 0;
-	Compress(LZMA_FINISH, LZMA_STREAM_END);
+	if (!m_out_buff.empty())
+	{
+		m_strm.avail_in = 0;
+		Compress(LZMA_FINISH);
+	}
 
 	lzma_end(&m_strm);
 }
 
-void GSDumpXz::AppendRawData(const void* data, size_t size)
+void GSDumpXz::CompressChunk(const u8* data, size_t size)
 {
-	size_t old_size = m_in_buff.size();
-	m_in_buff.resize(old_size + size);
-	memcpy(&m_in_buff[old_size], data, size);
-
-	// Enough data was accumulated, time to write/compress it.  If compression
-	// is enabled, it will freeze PCSX2. 1GB should be enough for long dump.
-	//
-	// Note: long dumps are currently not supported so this path won't be executed
-	if (m_in_buff.size() > 1024 * 1024 * 1024)
-		Flush();
-}
+	m_strm.next_in = data;
+	m_strm.avail_in = size;
 
-void GSDumpXz::AppendRawData(u8 c)
-{
-	m_in_buff.push_back(c);
+	Compress(LZMA_RUN);
 }
 
-void GSDumpXz::Flush()
+void GSDumpXz::Compress(lzma_action action)
 {
-	if (m_in_buff.empty())
-		return;
-
-	m_strm.next_in = m_in_buff.data();
-	m_strm.avail_in = m_in_buff.size();
-
-	Compress(LZMA_RUN, LZMA_OK);
-
-	m_in_buff.clear();
-}
-
-void GSDumpXz::Compress(lzma_action action, lzma_ret expected_status)
-{
-	std::vector<u8> out_buff(1024 * 1024);
-	do
+	for (;;)
 	{
-		m_strm.next_out = out_buff.data();
-		m_strm.avail_out = out_buff.size();
+		m_strm.next_out = m_out_buff.data();
+		m_strm.avail_out = m_out_buff.size();
 
 		lzma_ret ret = lzma_code(&m_strm, action);
 
-		if (ret != expected_status)
+		if (ret != LZMA_OK && ret != LZMA_STREAM_END)
 		{
 			fprintf(stderr, "GSDumpXz: Error %d\n", (int)ret);
 			return;
 		}
 
-		size_t write_size = out_buff.size() - m_strm.avail_out;
-		Write(out_buff.data(), write_size);
+		size_t write_size = m_out_buff.size() - m_strm.avail_out;
+		Write(m_out_buff.data(), write_size);
 
-	} while (m_strm.avail_out == 0);
+		if (action == LZMA_FINISH)
+		{
+			// break when the encoder has flushed everything
+			if (ret == LZMA_STREAM_END)
+				break;
+		}
+		else
+		{
+			// break when all input data is consumed and the encoder has nothing more to give
+			if (m_strm.avail_in == 0 && m_strm.avail_out != 0)
+				break;
+		}
+	}
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -234,53 +384,43 @@ void GSDumpXz::Compress(lzma_action action, lzma_ret expected_status)
 GSDumpZst::GSDumpZst(const std::string& fn, const std::string& serial, u32 crc,
 	u32 screenshot_width, u32 screenshot_height, const u32* screenshot_pixels,
 	const freezeData& fd, const GSPrivRegSet* regs)
-	: GSDumpBase(fn + ".gs.zst")
+	: GSDumpCompressed(fn + ".gs.zst")
 {
 	m_strm = ZSTD_createCStream();
 
 	// Compression level 6 provides a good balance between speed and ratio.
 	ZSTD_CCtx_setParameter(m_strm, ZSTD_c_compressionLevel, 6);
 
-	m_in_buff.reserve(_1mb);
+	// Let zstd spread the work over a few workers of its own, so the compression thread mostly just feeds it.
+	const int workers = static_cast<int>(std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u));
+	const size_t res = ZSTD_CCtx_setParameter(m_strm, ZSTD_c_nbWorkers, workers);
+	if (ZSTD_isError(res))
+		Console.Warning("GSDumpZstd: Multi-threaded compression unavailable: %s", ZSTD_getErrorName(res));
+
 	m_out_buff.resize(_1mb);
 
+	StartCompressionThread("GS Dump Compressor");
 	AddHeader(serial, crc, screenshot_width, screenshot_height, screenshot_pixels, fd, regs);
 }
 
 GSDumpZst::~GSDumpZst()
 {
+	StopCompressionThread();
+
 	// Finish the stream
-	Compress(ZSTD_e_end);
+	Compress(nullptr, 0, ZSTD_e_end);
 
 	ZSTD_freeCStream(m_strm);
 }
 
-void GSDumpZst::AppendRawData(const void* data, size_t size)
-{
-	size_t old_size = m_in_buff.size();
-	m_in_buff.resize(old_size + size);
-	memcpy(&m_in_buff[old_size], data, size);
-	MayFlush();
-}
-
-void GSDumpZst::AppendRawData(u8 c)
+void GSDumpZst::CompressChunk(const u8* data, size_t size)
 {
-	m_in_buff.push_back(c);
-	MayFlush();
+	Compress(data, size, ZSTD_e_continue);
 }
 
-void GSDumpZst::MayFlush()
+void GSDumpZst::Compress(const u8* data, size_t size, ZSTD_EndDirective action)
 {
-	if (m_in_buff.size() >= _1mb)
-		Compress(ZSTD_e_continue);
-}
-
-void GSDumpZst::Compress(ZSTD_EndDirective action)
-{
-	if (m_in_buff.empty())
-		return;
-
-	ZSTD_inBuffer inbuf = {m_in_buff.data(), m_in_buff.size(), 0};
+	ZSTD_inBuffer inbuf = {data, size, 0};
 
 	for (;;)
 	{
@@ -312,6 +452,4 @@ void GSDumpZst::Compress(ZSTD_EndDirective action)
 				break;
 		}
 	}
-
-	m_in_buff.clear();
 }
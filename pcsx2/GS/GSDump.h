@@ -18,7 +18,13 @@
 #include "SaveState.h"
 #include "GSRegs.h"
 #include "Renderers/SW/GSVertexSW.h"
+#include "common/boost_spsc_queue.hpp"
+#include "common/Threading.h"
+#include "common/Timer.h"
+#include <atomic>
 #include <lzma.h>
+#include <memory>
+#include <thread>
 #include <zstd.h>
 
 /*
@@ -57,12 +63,31 @@ struct GSDumpHeader
 
 class GSDumpBase
 {
+public:
+	struct Stats
+	{
+		double input_rate; ///< Uncompressed bytes per second appended since the last update.
+		double output_rate; ///< Bytes per second written to disk since the last update.
+		u64 output_size; ///< Total bytes written to disk.
+		u32 queue_depth; ///< Chunks waiting for the compression thread.
+		u32 queue_capacity;
+	};
+
+private:
 	FILE* m_gs;
 	std::string m_filename;
 	int m_frames;
 	int m_extra_frames;
 
+	std::atomic<u64> m_output_size{0};
+	u64 m_stats_last_input = 0;
+	u64 m_stats_last_output = 0;
+	Common::Timer m_stats_timer;
+
 protected:
+	u64 m_input_size = 0;
+
+
 	void AddHeader(const std::string& serial, u32 crc,
 		u32 screenshot_width, u32 screenshot_height, const u32* screenshot_pixels,
 		const freezeData& fd, const GSPrivRegSet* regs);
@@ -71,12 +96,18 @@ protected:
 	virtual void AppendRawData(const void* data, size_t size) = 0;
 	virtual void AppendRawData(u8 c) = 0;
 
+	virtual u32 GetQueueDepth() const { return 0; }
+	virtual u32 GetQueueCapacity() const { return 0; }
+
 public:
 	GSDumpBase(std::string fn);
 	virtual ~GSDumpBase();
 
 	__fi const std::string& GetPath() const { return m_filename; }
 
+	/// Fills in throughput since the previous call, at most once per second. Returns false if it is too early.
+	bool UpdateStats(Stats* stats);
+
 	void ReadFIFO(u32 size);
 	void Transfer(int index, const u8* mem, size_t size);
 	bool VSync(int field, bool last, const GSPrivRegSet* regs);
@@ -94,16 +125,60 @@ public:
 	virtual ~GSDumpUncompressed() = default;
 };
 
-class GSDumpXz final : public GSDumpBase
+/// Base for compressed dumps. The GS thread only copies data into fixed size chunks, which are handed
+/// over a lock-free queue to a dedicated thread that runs the (slow) compressor and writes the file.
+class GSDumpCompressed : public GSDumpBase
+{
+	static constexpr size_t CHUNK_SIZE = _1mb;
+	static constexpr size_t MAX_QUEUED_CHUNKS = 128;
+
+	struct Chunk
+	{
+		u8* data;
+		size_t size;
+	};
+
+	std::vector<std::unique_ptr<u8[]>> m_chunk_storage;
+	ringbuffer_base<Chunk, MAX_QUEUED_CHUNKS> m_full_chunks;
+	ringbuffer_base<u8*, MAX_QUEUED_CHUNKS> m_free_chunks;
+	Chunk m_current_chunk = {};
+
+	std::thread m_thread;
+	Threading::WorkSema m_sema;
+	std::atomic_bool m_thread_exit{false};
+
+	void ThreadEntryPoint();
+	void SubmitCurrentChunk();
+
+	void AppendRawData(const void* data, size_t size) final;
+	void AppendRawData(u8 c) final;
+
+	u32 GetQueueDepth() const final;
+	u32 GetQueueCapacity() const final;
+
+protected:
+	/// Compresses one chunk of input on the compression thread.
+	virtual void CompressChunk(const u8* data, size_t size) = 0;
+
+	void StartCompressionThread(const char* name);
+
+	/// Flushes all pending chunks and joins the compression thread.
+	/// Must be called from the derived destructor, before the compressor state is released.
+	void StopCompressionThread();
+
+public:
+	GSDumpCompressed(std::string fn);
+	virtual ~GSDumpCompressed();
+};
+
+class GSDumpXz final : public GSDumpCompressed
 {
 	lzma_stream m_strm;
 
-	std::vector<u8> m_in_buff;
+	std::vector<u8> m_out_buff;
 
-	void Flush();
-	void Compress(lzma_action action, lzma_ret expected_status);
-	void AppendRawData(const void* data, size_t size);
-	void AppendRawData(u8 c);
+	void Compress(lzma_action action);
+	void CompressChunk(const u8* data, size_t size) final;
 
 public:
 	GSDumpXz(const std::string& fn, const std::string& serial, u32 crc,
@@ -112,17 +187,14 @@ public:
 	virtual ~GSDumpXz();
 };
 
-class GSDumpZst final : public GSDumpBase
+class GSDumpZst final : public GSDumpCompressed
 {
 	ZSTD_CStream* m_strm;
 
-	std::vector<u8> m_in_buff;
 	std::vector<u8> m_out_buff;
 
-	void MayFlush();
-	void Compress(ZSTD_EndDirective action);
-	void AppendRawData(const void* data, size_t size);
-	void AppendRawData(u8 c);
+	void Compress(const u8* data, size_t size, ZSTD_EndDirective action);
+	void CompressChunk(const u8* data, size_t size) final;
 
 public:
 	GSDumpZst(const std::string& fn, const std::string& serial, u32 crc,
@@ -92,7 +92,7 @@ GSLocalMemory::GSLocalMemory()
 		psm.rta = &GSLocalMemory::ReadTexel32;
 		psm.wfa = &GSLocalMemory::WritePixel32;
 		psm.wi = &GSLocalMemory::WriteImage<PSM_PSMCT32, 8, 8, 32>;
-		psm.ri = &GSLocalMemory::ReadImageX; // TODO
+		psm.ri = &GSLocalMemory::ReadImage<PSM_PSMCT32, 8, 8, 32>;
 		psm.rtx = &GSLocalMemory::ReadTexture32;
 		psm.rtxP = &GSLocalMemory::ReadTexture32;
 		psm.rtxb = &GSLocalMemory::ReadTextureBlock32;
@@ -215,6 +215,19 @@ GSLocalMemory::GSLocalMemory()
 	m_psm[PSM_PSMZ16].wi = &GSLocalMemory::WriteImage<PSM_PSMZ16, 16, 8, 16>;
 	m_psm[PSM_PSMZ16S].wi = &GSLocalMemory::WriteImage<PSM_PSMZ16S, 16, 8, 16>;
 
+	m_psm[PSM_PSMCT24].ri = &GSLocalMemory::ReadImage<PSM_PSMCT24, 8, 8, 24>;
+	m_psm[PSM_PSMCT16].ri = &GSLocalMemory::ReadImage<PSM_PSMCT16, 16, 8, 16>;
+	m_psm[PSM_PSMCT16S].ri = &GSLocalMemory::ReadImage<PSM_PSMCT16S, 16, 8, 16>;
+	m_psm[PSM_PSMT8].ri = &GSLocalMemory::ReadImage<PSM_PSMT8, 16, 16, 8>;
+	m_psm[PSM_PSMT4].ri = &GSLocalMemory::ReadImage<PSM_PSMT4, 32, 16, 4>;
+	m_psm[PSM_PSMT8H].ri = &GSLocalMemory::ReadImage<PSM_PSMT8H, 8, 8, 8>;
+	m_psm[PSM_PSMT4HL].ri = &GSLocalMemory::ReadImage<PSM_PSMT4HL, 8, 8, 4>;
+	m_psm[PSM_PSMT4HH].ri = &GSLocalMemory::ReadImage<PSM_PSMT4HH, 8, 8, 4>;
+	m_psm[PSM_PSMZ32].ri = &GSLocalMemory::ReadImage<PSM_PSMZ32, 8, 8, 32>;
+	m_psm[PSM_PSMZ24].ri = &GSLocalMemory::ReadImage<PSM_PSMZ24, 8, 8, 24>;
+	m_psm[PSM_PSMZ16].ri = &GSLocalMemory::ReadImage<PSM_PSMZ16, 16, 8, 16>;
+	m_psm[PSM_PSMZ16S].ri = &GSLocalMemory::ReadImage<PSM_PSMZ16S, 16, 8, 16>;
+
 	m_psm[PSM_PSMCT24].rtx = &GSLocalMemory::ReadTexture24;
 	m_psm[PSM_PSGPU24].rtx = &GSLocalMemory::ReadTextureGPU24;
 	m_psm[PSM_PSMCT16].rtx = &GSLocalMemory::ReadTexture16;
@@ -1389,6 +1402,7 @@ void GSLocalMemory::ReadImageX(int& tx, int& ty, u8* dst, int len, GIFRegBITBLTB
 				u8 low = ReadPixel4(pa.value(x));
 				u8 high = ReadPixel4(pa.value(x + 1));
 				*pb = low | (high << 4);
+				pb++;
 			});
 			break;
 
@@ -1422,6 +1436,179 @@ void GSLocalMemory::ReadImageX(int& tx, int& ty, u8* dst, int len, GIFRegBITBLTB
 	}
 }
 
+template <int psm, int bsx, int bsy, int trbpp>
+void GSLocalMemory::ReadImageBlock(int l, int r, int y, int h, u8* dst, int dstpitch, const GIFRegBITBLTBUF& BITBLTBUF) const
+{
+	alignas(32) u8 buff[256]; // one block, packed at trbpp
+
+	const int buffpitch = bsx * trbpp >> 3;
+
+	u32 bp = BITBLTBUF.SBP;
+	u32 bw = BITBLTBUF.SBW;
+
+	for (int ey = y + h; y < ey;)
+	{
+		const int y2 = y & (bsy - 1);
+		const int h2 = std::min(ey - y, bsy - y2);
+
+		for (int x = l; x < r; x += bsx)
+		{
+			u8* d = &dst[x * trbpp >> 3];
+
+			// the 32/16/8/4 bit block readers use aligned stores, partial blocks and unaligned destinations go through the buffer
+
+			bool direct = h2 == bsy;
+
+			switch (psm)
+			{
+				case PSM_PSMCT32:
+				case PSM_PSMZ32:
+				case PSM_PSMCT16:
+				case PSM_PSMCT16S:
+				case PSM_PSMZ16:
+				case PSM_PSMZ16S:
+					direct = direct && ((((size_t)d | (size_t)dstpitch) & 31) == 0);
+					break;
+				case PSM_PSMT8:
+				case PSM_PSMT4:
+					direct = direct && ((((size_t)d | (size_t)dstpitch) & 15) == 0);
+					break;
+				default:
+					break;
+			}
+
+			u8* RESTRICT bd = direct ? d : buff;
+			const int bpitch = direct ? dstpitch : buffpitch;
+
+			switch (psm)
+			{
+				case PSM_PSMCT32: GSBlock::ReadBlock32(BlockPtr32(x, y, bp, bw), bd, bpitch); break;
+				case PSM_PSMCT24: GSBlock::ReadAndPackBlock24(BlockPtr32(x, y, bp, bw), bd, bpitch); break;
+				case PSM_PSMCT16: GSBlock::ReadBlock16(BlockPtr16(x, y, bp, bw), bd, bpitch); break;
+				case PSM_PSMCT16S: GSBlock::ReadBlock16(BlockPtr16S(x, y, bp, bw), bd, bpitch); break;
+				case PSM_PSMT8: GSBlock::ReadBlock8(BlockPtr8(x, y, bp, bw), bd, bpitch); break;
+				case PSM_PSMT4: GSBlock::ReadBlock4(BlockPtr4(x, y, bp, bw), bd, bpitch); break;
+				case PSM_PSMT8H: GSBlock::ReadAndPackBlock8H(BlockPtr32(x, y, bp, bw), bd, bpitch); break;
+				case PSM_PSMT4HL: GSBlock::ReadAndPackBlock4HL(BlockPtr32(x, y, bp, bw), bd, bpitch); break;
+				case PSM_PSMT4HH: GSBlock::ReadAndPackBlock4HH(BlockPtr32(x, y, bp, bw), bd, bpitch); break;
+				case PSM_PSMZ32: GSBlock::ReadBlock32(BlockPtr32Z(x, y, bp, bw), bd, bpitch); break;
+				case PSM_PSMZ24: GSBlock::ReadAndPackBlock24(BlockPtr32Z(x, y, bp, bw), bd, bpitch); break;
+				case PSM_PSMZ16: GSBlock::ReadBlock16(BlockPtr16Z(x, y, bp, bw), bd, bpitch); break;
+				case PSM_PSMZ16S: GSBlock::ReadBlock16(BlockPtr16SZ(x, y, bp, bw), bd, bpitch); break;
+				default: __assume(0);
+			}
+
+			if (!direct)
+			{
+				for (int i = 0; i < h2; i++)
+					memcpy(&d[i * dstpitch], &buff[(y2 + i) * buffpitch], buffpitch);
+			}
+		}
+
+		dst += dstpitch * h2;
+		y += h2;
+	}
+}
+
+template <int psm, int bsx, int bsy>
+void GSLocalMemory::ReadImageLeftRight(int l, int r, int y, int h, u8* dst, int dstpitch, const GIFRegBITBLTBUF& BITBLTBUF) const
+{
+	u32 bp = BITBLTBUF.SBP;
+	u32 bw = BITBLTBUF.SBW;
+
+	for (; h > 0; y++, h--, dst += dstpitch)
+	{
+		for (int x = l; x < r; x++)
+		{
+			switch (psm)
+			{
+				case PSM_PSMCT32: *(u32*)&dst[x * 4] = ReadPixel32(x, y, bp, bw); break;
+				case PSM_PSMCT24: { u32 c = ReadPixel24(x, y, bp, bw); memcpy(&dst[x * 3], &c, 3); } break;
+				case PSM_PSMCT16: *(u16*)&dst[x * 2] = ReadPixel16(x, y, bp, bw); break;
+				case PSM_PSMCT16S: *(u16*)&dst[x * 2] = ReadPixel16S(x, y, bp, bw); break;
+				case PSM_PSMT8: dst[x] = ReadPixel8(x, y, bp, bw); break;
+				case PSM_PSMT4: dst[x >> 1] = (dst[x >> 1] & (0xf0 >> ((x & 1) << 2))) | (ReadPixel4(x, y, bp, bw) << ((x & 1) << 2)); break;
+				case PSM_PSMT8H: dst[x] = ReadPixel8H(x, y, bp, bw); break;
+				case PSM_PSMT4HL: dst[x >> 1] = (dst[x >> 1] & (0xf0 >> ((x & 1) << 2))) | (ReadPixel4HL(x, y, bp, bw) << ((x & 1) << 2)); break;
+				case PSM_PSMT4HH: dst[x >> 1] = (dst[x >> 1] & (0xf0 >> ((x & 1) << 2))) | (ReadPixel4HH(x, y, bp, bw) << ((x & 1) << 2)); break;
+				case PSM_PSMZ32: *(u32*)&dst[x * 4] = ReadPixel32Z(x, y, bp, bw); break;
+				case PSM_PSMZ24: { u32 c = ReadPixel24Z(x, y, bp, bw); memcpy(&dst[x * 3], &c, 3); } break;
+				case PSM_PSMZ16: *(u16*)&dst[x * 2] = ReadPixel16Z(x, y, bp, bw); break;
+				case PSM_PSMZ16S: *(u16*)&dst[x * 2] = ReadPixel16SZ(x, y, bp, bw); break;
+				default: __assume(0);
+			}
+		}
+	}
+}
+
+template <int psm, int bsx, int bsy, int trbpp>
+void GSLocalMemory::ReadImage(int& tx, int& ty, u8* dst, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG) const
+{
+	if (TRXREG.RRW == 0)
+		return;
+
+	const int l = (int)TRXPOS.SSAX;
+	const int r = l + (int)TRXREG.RRW;
+
+	// 4bpp rows which don't start and end on a byte boundary drift by a nibble every line, leave them to the slow path
+
+	if (trbpp == 4 && ((l | r) & 1))
+	{
+		ReadImageX(tx, ty, dst, len, BITBLTBUF, TRXPOS, TRXREG);
+		return;
+	}
+
+	// finish the incomplete row first
+
+	if (tx != l)
+	{
+		int n = std::min(len, (r - tx) * trbpp >> 3);
+		ReadImageX(tx, ty, dst, n, BITBLTBUF, TRXPOS, TRXREG);
+		dst += n;
+		len -= n;
+	}
+
+	const int la = (l + (bsx - 1)) & ~(bsx - 1);
+	const int ra = r & ~(bsx - 1);
+	const int dstpitch = (r - l) * trbpp >> 3;
+	int h = len / dstpitch;
+
+	if (ra - la >= bsx && h > 0) // "transfer width" >= "block width" && there is at least one full row
+	{
+		u8* d = &dst[-l * trbpp >> 3];
+
+		dst += dstpitch * h;
+		len -= dstpitch * h;
+
+		// left part
+
+		if (l < la)
+		{
+			ReadImageLeftRight<psm, bsx, bsy>(l, la, ty, h, d, dstpitch, BITBLTBUF);
+		}
+
+		// right part
+
+		if (ra < r)
+		{
+			ReadImageLeftRight<psm, bsx, bsy>(ra, r, ty, h, d, dstpitch, BITBLTBUF);
+		}
+
+		// horizontally aligned part, partial blocks at the top and bottom are read whole and trimmed
+
+		ReadImageBlock<psm, bsx, bsy, trbpp>(la, ra, ty, h, d, dstpitch, BITBLTBUF);
+
+		ty += h;
+	}
+
+	// the rest
+
+	if (len > 0)
+	{
+		ReadImageX(tx, ty, dst, len, BITBLTBUF, TRXPOS, TRXREG);
+	}
+}
+
 ///////////////////
 
 void GSLocalMemory::ReadTexture32(const GSOffset& off, const GSVector4i& r, u8* dst, int dstpitch, const GIFRegTEXA& TEXA)
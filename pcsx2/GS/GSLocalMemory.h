@@ -1131,7 +1131,14 @@ public:
 	void WriteImage24Z(int& tx, int& ty, const u8* src, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG);
 	void WriteImageX(int& tx, int& ty, const u8* src, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG);
 
-	// TODO: ReadImage32/24/...
+	template <int psm, int bsx, int bsy, int trbpp>
+	void ReadImageBlock(int l, int r, int y, int h, u8* dst, int dstpitch, const GIFRegBITBLTBUF& BITBLTBUF) const;
+
+	template <int psm, int bsx, int bsy>
+	void ReadImageLeftRight(int l, int r, int y, int h, u8* dst, int dstpitch, const GIFRegBITBLTBUF& BITBLTBUF) const;
+
+	template <int psm, int bsx, int bsy, int trbpp>
+	void ReadImage(int& tx, int& ty, u8* dst, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG) const;
 
 	void ReadImageX(int& tx, int& ty, u8* dst, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG) const;
 
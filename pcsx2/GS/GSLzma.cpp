@@ -16,8 +16,10 @@
 #include "PrecompiledHeader.h"
 
 #include "common/AlignedMalloc.h"
+#include "common/Console.h"
 #include "common/FileSystem.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
 
 #include "GSDump.h"
 #include "GSLzma.h"
@@ -114,7 +116,7 @@ bool GSDumpFile::GetPreviewImageFromDump(const char* filename, u32* width, u32*
 	return true;
 }
 
-bool GSDumpFile::ReadFile()
+bool GSDumpFile::ReadHeader()
 {
 	u32 ss;
 	if (Read(&m_crc, sizeof(m_crc)) != sizeof(m_crc) || Read(&ss, sizeof(ss)) != sizeof(ss))
@@ -125,7 +127,8 @@ bool GSDumpFile::ReadFile()
 		return false;
 
 	// Pull serial out of new header, if present.
-	if (m_crc == 0xFFFFFFFFu)
+	const bool has_header = (m_crc == 0xFFFFFFFFu);
+	if (has_header)
 	{
 		GSDumpHeader header;
 		if (m_state_data.size() < sizeof(header))
@@ -160,6 +163,19 @@ bool GSDumpFile::ReadFile()
 	if (Read(m_regs_data.data(), m_regs_data.size()) != m_regs_data.size())
 		return false;
 
+	// New dumps have the real state following the header, old ones only have the state.
+	m_header_size = sizeof(u32) * 2 + ss + m_regs_data.size();
+	if (has_header)
+		m_header_size += m_state_data.size();
+
+	return true;
+}
+
+bool GSDumpFile::ReadFile()
+{
+	if (!ReadHeader())
+		return false;
+
 	// read all the packet data in
 	// TODO: make this suck less by getting the full/extracted size and preallocating
 	for (;;)
@@ -253,6 +269,349 @@ bool GSDumpFile::ReadFile()
 	return true;
 }
 
+bool GSDumpFile::OpenStream(size_t lookahead_size /* = DEFAULT_STREAM_LOOKAHEAD */)
+{
+	if (!ReadHeader())
+		return false;
+
+	m_stream_lookahead = lookahead_size;
+	m_stream_offset = 0;
+	m_stream_frame = 0;
+	m_frame_index.assign(1, 0);
+	m_frame_index_complete = false;
+	StartStreamThread();
+	m_streaming.store(true, std::memory_order_release);
+	return true;
+}
+
+void GSDumpFile::CloseStream()
+{
+	m_streaming.store(false, std::memory_order_release);
+	StopStreamThread();
+	m_stream_free_blocks.clear();
+}
+
+bool GSDumpFile::GetNextPacket(GSData* packet)
+{
+	for (;;)
+	{
+		if (m_stream_current_block && m_stream_current_packet < m_stream_current_block->packets.size())
+		{
+			*packet = m_stream_current_block->packets[m_stream_current_packet++];
+			return true;
+		}
+
+		std::unique_lock lock(m_stream_mutex);
+		if (!m_stream_thread.joinable())
+			return false;
+
+		// Hand the finished block back to the reader, which may be waiting for space.
+		if (m_stream_current_block)
+		{
+			m_stream_queued_bytes -= m_stream_current_block->data.size();
+			m_stream_free_blocks.push_back(std::move(m_stream_current_block));
+			m_stream_consumed_cv.notify_one();
+		}
+
+		m_stream_produced_cv.wait(lock, [this]() { return !m_stream_queue.empty() || m_stream_finished; });
+		if (m_stream_queue.empty())
+		{
+			if (m_stream_error)
+				Console.Error("(GSDump) Failed to read packet data.");
+
+			return false;
+		}
+
+		m_stream_current_block = std::move(m_stream_queue.front());
+		m_stream_queue.pop_front();
+		m_stream_current_packet = 0;
+	}
+}
+
+bool GSDumpFile::SeekToFrame(u32 frame)
+{
+	if (!m_stream_thread.joinable())
+		return false;
+
+	StopStreamThread();
+
+	// Jump to the closest frame we know the position of, then parse forward from there.
+	u32 start_frame;
+	u64 start_offset;
+	{
+		std::unique_lock lock(m_stream_mutex);
+		start_frame = std::min<u32>(frame, static_cast<u32>(m_frame_index.size() - 1));
+		start_offset = m_frame_index[start_frame];
+	}
+
+	bool result = SeekStreamTo(start_offset, start_frame);
+	try
+	{
+		while (result && m_stream_frame < frame)
+		{
+			bool eof = false;
+			result = StreamReadPacket(nullptr, &eof) && !eof;
+			if (eof)
+			{
+				std::unique_lock lock(m_stream_mutex);
+				m_frame_index_complete = true;
+			}
+		}
+	}
+	catch (...)
+	{
+		result = false;
+	}
+
+	// Even if we failed, the stream has to be running, it'll just report the end.
+	StartStreamThread();
+	if (!result)
+		Console.Error("(GSDump) Failed to seek to frame %u.", frame);
+
+	return result;
+}
+
+u32 GSDumpFile::GetIndexedFrameCount()
+{
+	std::unique_lock lock(m_stream_mutex);
+	return static_cast<u32>(m_frame_index.size() - 1);
+}
+
+bool GSDumpFile::IsFrameIndexComplete()
+{
+	std::unique_lock lock(m_stream_mutex);
+	return m_frame_index_complete;
+}
+
+bool GSDumpFile::Skip(u64 size)
+{
+	u8 buffer[64 * 1024];
+	while (size > 0)
+	{
+		const size_t chunk = static_cast<size_t>(std::min<u64>(size, sizeof(buffer)));
+		if (Read(buffer, chunk) != chunk)
+			return false;
+
+		size -= chunk;
+	}
+
+	return true;
+}
+
+bool GSDumpFile::SeekStreamTo(u64 offset, u32 frame)
+{
+	// Compressed streams can't go backwards, so start again from the top of the file.
+	if (offset < m_stream_offset)
+	{
+		if (!Rewind() || !Skip(m_header_size))
+			return false;
+
+		m_stream_offset = 0;
+	}
+
+	if (!Skip(offset - m_stream_offset))
+		return false;
+
+	m_stream_offset = offset;
+	m_stream_frame = frame;
+	return true;
+}
+
+void GSDumpFile::StartStreamThread()
+{
+	m_stream_stop = false;
+	m_stream_finished = false;
+	m_stream_error = false;
+	m_stream_thread = std::thread(&GSDumpFile::StreamThreadEntryPoint, this);
+}
+
+void GSDumpFile::StopStreamThread()
+{
+	if (!m_stream_thread.joinable())
+		return;
+
+	{
+		std::unique_lock lock(m_stream_mutex);
+		m_stream_stop = true;
+		m_stream_consumed_cv.notify_one();
+	}
+
+	m_stream_thread.join();
+
+	// Anything buffered is stale now.
+	if (m_stream_current_block)
+		m_stream_free_blocks.push_back(std::move(m_stream_current_block));
+	while (!m_stream_queue.empty())
+	{
+		m_stream_free_blocks.push_back(std::move(m_stream_queue.front()));
+		m_stream_queue.pop_front();
+	}
+	m_stream_current_packet = 0;
+	m_stream_queued_bytes = 0;
+}
+
+void GSDumpFile::StreamThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("GS Dump Reader");
+
+	// Packets are handed over in blocks, so the consumer doesn't need to take the lock for every one.
+	static constexpr size_t STREAM_BLOCK_SIZE = 1 * _1mb;
+
+	std::unique_lock lock(m_stream_mutex);
+	while (!m_stream_stop)
+	{
+		if (m_stream_queued_bytes >= m_stream_lookahead)
+		{
+			m_stream_consumed_cv.wait(lock);
+			continue;
+		}
+
+		std::unique_ptr<StreamBlock> block;
+		if (!m_stream_free_blocks.empty())
+		{
+			block = std::move(m_stream_free_blocks.back());
+			m_stream_free_blocks.pop_back();
+		}
+		else
+		{
+			block = std::make_unique<StreamBlock>();
+		}
+
+		lock.unlock();
+
+		block->data.clear();
+		block->packets.clear();
+		block->offsets.clear();
+
+		bool eof = false;
+		bool error = false;
+		try
+		{
+			while (!eof && block->data.size() < STREAM_BLOCK_SIZE)
+			{
+				if (!StreamReadPacket(block.get(), &eof))
+				{
+					error = true;
+					break;
+				}
+			}
+		}
+		catch (...)
+		{
+			error = true;
+		}
+
+		// Data pointers can only be filled in once the buffer has stopped growing.
+		for (size_t i = 0; i < block->packets.size(); i++)
+			block->packets[i].data = (block->packets[i].length > 0) ? (block->data.data() + block->offsets[i]) : nullptr;
+
+		lock.lock();
+
+		if (!block->packets.empty())
+		{
+			m_stream_queued_bytes += block->data.size();
+			m_stream_queue.push_back(std::move(block));
+		}
+		else
+		{
+			m_stream_free_blocks.push_back(std::move(block));
+		}
+
+		if (eof || error)
+		{
+			m_stream_finished = true;
+			m_stream_error = error;
+			m_frame_index_complete |= !error;
+		}
+
+		m_stream_produced_cv.notify_one();
+		if (m_stream_finished)
+			break;
+	}
+}
+
+bool GSDumpFile::StreamReadPacket(StreamBlock* block, bool* eof)
+{
+	GSData packet = {};
+	packet.path = GSTransferPath::Dummy;
+	if (Read(&packet.id, sizeof(u8)) != sizeof(u8))
+	{
+		*eof = IsEof();
+		return *eof;
+	}
+
+	u64 header_size = sizeof(u8);
+	switch (packet.id)
+	{
+		case GSType::Transfer:
+		{
+			u32 length;
+			if (Read(&packet.path, sizeof(u8)) != sizeof(u8) || Read(&length, sizeof(u32)) != sizeof(u32))
+			{
+				*eof = IsEof();
+				return *eof;
+			}
+			packet.length = length;
+			header_size += sizeof(u8) + sizeof(u32);
+		}
+		break;
+		case GSType::VSync:
+			packet.length = 1;
+			break;
+		case GSType::ReadFIFO2:
+			packet.length = 4;
+			break;
+		case GSType::Registers:
+			packet.length = 8192;
+			break;
+		default:
+			return false;
+	}
+
+	size_t read;
+	if (block)
+	{
+		const size_t offset = block->data.size();
+		block->data.resize(offset + packet.length);
+		read = Read(block->data.data() + offset, packet.length);
+		if (read == packet.length)
+		{
+			block->packets.push_back(packet);
+			block->offsets.push_back(offset);
+		}
+		else
+		{
+			block->data.resize(offset);
+		}
+	}
+	else
+	{
+		read = Skip(packet.length) ? packet.length : 0;
+	}
+
+	if (read != packet.length)
+	{
+		// Same as ReadFile(), drop a truncated packet on the end of the dump.
+		Console.Error("(GSDump) Dropping last packet of %u bytes (we only have %u bytes)",
+			static_cast<u32>(packet.length), static_cast<u32>(read));
+		*eof = true;
+		return true;
+	}
+
+	m_stream_offset += header_size + packet.length;
+
+	if (packet.id == GSType::VSync)
+	{
+		m_stream_frame++;
+
+		std::unique_lock lock(m_stream_mutex);
+		if (m_stream_frame == m_frame_index.size())
+			m_frame_index.push_back(m_stream_offset);
+	}
+
+	return true;
+}
+
 /******************************************************************/
 GSDumpLzma::GSDumpLzma(FILE* file, FILE* repack_file)
 	: GSDumpFile(file, repack_file)
@@ -352,8 +711,23 @@ size_t GSDumpLzma::Read(void* ptr, size_t size)
 	return off;
 }
 
+bool GSDumpLzma::Rewind()
+{
+	if (FileSystem::FSeek64(m_fp, 0, SEEK_SET) != 0)
+		return false;
+
+	lzma_end(&m_strm);
+	_aligned_free(m_inbuf);
+	_aligned_free(m_area);
+	Initialize();
+	return true;
+}
+
 GSDumpLzma::~GSDumpLzma()
 {
+	// The stream thread calls into us, it has to stop before we go away.
+	CloseStream();
+
 	lzma_end(&m_strm);
 
 	if (m_inbuf)
@@ -441,8 +815,23 @@ size_t GSDumpDecompressZst::Read(void* ptr, size_t size)
 	return off;
 }
 
+bool GSDumpDecompressZst::Rewind()
+{
+	if (FileSystem::FSeek64(m_fp, 0, SEEK_SET) != 0)
+		return false;
+
+	ZSTD_DCtx_reset(m_strm, ZSTD_reset_session_only);
+	m_inbuf.pos = 0;
+	m_inbuf.size = 0;
+	m_avail = 0;
+	m_start = 0;
+	return true;
+}
+
 GSDumpDecompressZst::~GSDumpDecompressZst()
 {
+	CloseStream();
+
 	ZSTD_freeDStream(m_strm);
 
 	if (m_inbuf.src)
@@ -458,6 +847,11 @@ GSDumpRaw::GSDumpRaw(FILE* file, FILE* repack_file)
 {
 }
 
+GSDumpRaw::~GSDumpRaw()
+{
+	CloseStream();
+}
+
 bool GSDumpRaw::IsEof()
 {
 	return !!feof(m_fp);
@@ -477,3 +871,8 @@ size_t GSDumpRaw::Read(void* ptr, size_t size)
 
 	return ret;
 }
+
+bool GSDumpRaw::Rewind()
+{
+	return (FileSystem::FSeek64(m_fp, 0, SEEK_SET) == 0);
+}
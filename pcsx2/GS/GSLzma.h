@@ -15,8 +15,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <lzma.h>
@@ -301,6 +306,9 @@ public:
 	using ByteArray = std::vector<u8>;
 	using GSDataArray = std::vector<GSData>;
 
+	/// Amount of decoded packet data the streaming reader is allowed to buffer ahead of the consumer.
+	static constexpr size_t DEFAULT_STREAM_LOOKAHEAD = 64 * _1mb;
+
 	virtual ~GSDumpFile();
 
 	static std::unique_ptr<GSDumpFile> OpenGSDump(const char* filename, const char* repack_filename = nullptr);
@@ -313,19 +321,58 @@ public:
 	__fi const ByteArray& GetStateData() const { return m_state_data; }
 	__fi const GSDataArray& GetPackets() const { return m_dump_packets; }
 
+	/// Reads the whole dump into memory, after which all packets are available through GetPackets().
 	bool ReadFile();
 
+	/// Reads the header, then decodes packets on a background thread, buffering at most
+	/// lookahead_size bytes of packet data. Packets are consumed in order with GetNextPacket().
+	bool OpenStream(size_t lookahead_size = DEFAULT_STREAM_LOOKAHEAD);
+	void CloseStream();
+	/// Safe to call from any thread, SeekToFrame() restarts the stream thread underneath.
+	__fi bool IsStreaming() const { return m_streaming.load(std::memory_order_acquire); }
+
+	/// Returns the next packet in the stream, or false at the end of the dump (or on error).
+	/// The packet's data remains valid until the next call to GetNextPacket() or SeekToFrame().
+	bool GetNextPacket(GSData* packet);
+
+	/// Moves the stream to the first packet of the given frame, i.e. after that many vsyncs.
+	/// Only the packet position changes, the caller is responsible for any GS state.
+	bool SeekToFrame(u32 frame);
+
+	/// Number of frames located so far, which is the total once IsFrameIndexComplete() is true.
+	u32 GetIndexedFrameCount();
+	bool IsFrameIndexComplete();
+
 protected:
 	GSDumpFile(FILE* file, FILE* repack_file);
 
 	virtual bool IsEof() = 0;
 	virtual size_t Read(void* ptr, size_t size) = 0;
 
+	/// Returns the decoder to the start of the file.
+	virtual bool Rewind() = 0;
+
 	void Repack(void* ptr, size_t size);
 
 	FILE* m_fp = nullptr;
 
 private:
+	/// A run of whole packets decoded by the stream thread.
+	struct StreamBlock
+	{
+		std::vector<u8> data;
+		std::vector<GSData> packets;
+		std::vector<size_t> offsets;
+	};
+
+	bool ReadHeader();
+	bool Skip(u64 size);
+	bool SeekStreamTo(u64 offset, u32 frame);
+	void StartStreamThread();
+	void StopStreamThread();
+	void StreamThreadEntryPoint();
+	bool StreamReadPacket(StreamBlock* block, bool* eof);
+
 	FILE* m_repack_fp = nullptr;
 
 	std::string m_serial;
@@ -336,6 +383,30 @@ private:
 	std::vector<u8> m_packet_data;
 
 	GSDataArray m_dump_packets;
+
+	// Streaming state. Offsets are in decompressed bytes from the first packet.
+	u64 m_header_size = 0;
+	u64 m_stream_offset = 0;
+	u32 m_stream_frame = 0;
+	size_t m_stream_lookahead = 0;
+
+	std::thread m_stream_thread;
+	std::atomic_bool m_streaming{false}; // set between OpenStream() and CloseStream()
+	std::mutex m_stream_mutex;
+	std::condition_variable m_stream_produced_cv;
+	std::condition_variable m_stream_consumed_cv;
+	std::deque<std::unique_ptr<StreamBlock>> m_stream_queue;
+	std::vector<std::unique_ptr<StreamBlock>> m_stream_free_blocks;
+	std::unique_ptr<StreamBlock> m_stream_current_block;
+	size_t m_stream_current_packet = 0;
+	size_t m_stream_queued_bytes = 0;
+	bool m_stream_stop = false;
+	bool m_stream_finished = false;
+	bool m_stream_error = false;
+
+	// Offset of the first packet of each frame, built up as the stream is decoded.
+	std::vector<u64> m_frame_index;
+	bool m_frame_index_complete = false;
 };
 
 class GSDumpLzma : public GSDumpFile
@@ -358,6 +429,7 @@ public:
 
 	bool IsEof() final;
 	size_t Read(void* ptr, size_t size) final;
+	bool Rewind() final;
 };
 
 class GSDumpDecompressZst : public GSDumpFile
@@ -382,14 +454,16 @@ public:
 
 	bool IsEof() final;
 	size_t Read(void* ptr, size_t size) final;
+	bool Rewind() final;
 };
 
 class GSDumpRaw : public GSDumpFile
 {
 public:
 	GSDumpRaw(FILE* file, FILE* repack_file);
-	virtual ~GSDumpRaw() = default;
+	virtual ~GSDumpRaw();
 
 	bool IsEof() final;
 	size_t Read(void* ptr, size_t size) final;
+	bool Rewind() final;
 };
@@ -28,12 +28,20 @@ void GSPerfMon::Reset()
 	m_count = 0;
 	std::memset(m_counters, 0, sizeof(m_counters));
 	std::memset(m_stats, 0, sizeof(m_stats));
+	std::memset(m_frame_base, 0, sizeof(m_frame_base));
+	std::memset(m_last_frame, 0, sizeof(m_last_frame));
 }
 
 void GSPerfMon::EndFrame()
 {
 	m_frame++;
 	m_count++;
+
+	for (size_t i = 0; i < std::size(m_counters); i++)
+	{
+		m_last_frame[i] = m_counters[i] - m_frame_base[i];
+		m_frame_base[i] = m_counters[i];
+	}
 }
 
 void GSPerfMon::Update()
@@ -49,4 +57,5 @@ void GSPerfMon::Update()
 	}
 
 	memset(m_counters, 0, sizeof(m_counters));
+	memset(m_frame_base, 0, sizeof(m_frame_base));
 }
@@ -40,6 +40,8 @@ public:
 protected:
 	double m_counters[CounterLast] = {};
 	double m_stats[CounterLast] = {};
+	double m_frame_base[CounterLast] = {};
+	double m_last_frame[CounterLast] = {};
 	u64 m_frame = 0;
 	clock_t m_lastframe = 0;
 	int m_count = 0;
@@ -56,6 +58,8 @@ public:
 
 	void Put(counter_t c, double val) { m_counters[c] += val; }
 	double Get(counter_t c) { return m_stats[c]; }
+	/// Returns the value accumulated by a counter over the last completed frame, rather than the average.
+	double GetLastFrame(counter_t c) { return m_last_frame[c]; }
 	void Update();
 
 	__fi void AddDisplayFramebufferSpriteBlit() { m_disp_fb_sprite_blits++; }
@@ -2020,7 +2020,7 @@ void GSState::Read(u8* mem, int len)
 	if (!m_tr.Update(w, h, bpp, len))
 		return;
 
-	m_mem.ReadImageX(m_tr.x, m_tr.y, mem, len, m_env.BITBLTBUF, m_env.TRXPOS, m_env.TRXREG);
+	(m_mem.*GSLocalMemory::m_psm[m_env.BITBLTBUF.SPSM].ri)(m_tr.x, m_tr.y, mem, len, m_env.BITBLTBUF, m_env.TRXPOS, m_env.TRXREG);
 
 	if (s_dump && s_save && s_n >= s_saven)
 	{
@@ -2277,7 +2277,7 @@ void GSState::ReadLocalMemoryUnsync(u8* mem, int qwc, GIFRegBITBLTBUF BITBLTBUF,
 	if (!tb.Update(w, h, bpp, len))
 		return;
 
-	m_mem.ReadImageX(tb.x, tb.y, mem, len, BITBLTBUF, TRXPOS, TRXREG);
+	(m_mem.*GSLocalMemory::m_psm[BITBLTBUF.SPSM].ri)(tb.x, tb.y, mem, len, BITBLTBUF, TRXPOS, TRXREG);
 }
 
 template void GSState::Transfer<0>(const u8* mem, u32 size);
@@ -19,6 +19,7 @@
 #include "common/boost_spsc_queue.hpp"
 #include "common/General.h"
 #include "common/Threading.h"
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
@@ -26,6 +27,16 @@
 template <class T, int CAPACITY>
 class GSJobQueue final
 {
+public:
+	/// Counts of how often each side had to wait, and how often that wait ended with the thread parked.
+	struct Stats
+	{
+		u64 worker_waits;
+		u64 worker_parks;
+		u64 push_spins;
+		u64 push_parks;
+	};
+
 private:
 	std::thread m_thread;
 	std::function<void()> m_startup;
@@ -36,6 +47,24 @@ private:
 
 	Threading::WorkSema m_sema;
 
+	/// Producer sleeps here when the ring is still full after spinning.
+	Threading::KernelSemaphore m_space_sema;
+	std::atomic<bool> m_push_waiting{false};
+
+	/// How long either side spins before parking, in ns.
+	const u32 m_spin_ns;
+
+	std::atomic<u64> m_worker_waits{0};
+	std::atomic<u64> m_worker_parks{0};
+	std::atomic<u64> m_push_spins{0};
+	std::atomic<u64> m_push_parks{0};
+
+	void WakeProducer()
+	{
+		if (m_push_waiting.exchange(false, std::memory_order_acq_rel))
+			m_space_sema.Post();
+	}
+
 	void ThreadProc()
 	{
 		if (m_startup)
@@ -43,11 +72,23 @@ private:
 
 		while (true)
 		{
-			m_sema.WaitForWorkWithSpin();
+			m_worker_waits.fetch_add(1, std::memory_order_relaxed);
+			if (m_sema.WaitForWorkWithSpin(m_spin_ns))
+				m_worker_parks.fetch_add(1, std::memory_order_relaxed);
 			if (m_exit)
 				break;
 			while (m_queue.consume_one(*this))
-				;
+			{
+				// Wake a parked producer as soon as a slot frees up, without a fence per job.
+				if (m_push_waiting.load(std::memory_order_relaxed))
+					WakeProducer();
+			}
+
+			// The loads above can miss a producer that parked while we drained the ring.
+			// Pairs with the fence in Push(): either the producer sees the freed slots, or we see its flag.
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (m_push_waiting.load(std::memory_order_relaxed))
+				WakeProducer();
 		}
 
 		if (m_shutdown)
@@ -55,11 +96,13 @@ private:
 	}
 
 public:
-	GSJobQueue(std::function<void()> startup, std::function<void(T&)> func, std::function<void()> shutdown)
+	/// spin_ns sets how long the producer and worker spin before parking, 0 parks immediately.
+	GSJobQueue(std::function<void()> startup, std::function<void(T&)> func, std::function<void()> shutdown, u32 spin_ns = SPIN_TIME_NS)
 		: m_startup(std::move(startup))
 		, m_func(std::move(func))
 		, m_shutdown(std::move(shutdown))
 		, m_exit(false)
+		, m_spin_ns(spin_ns)
 	{
 		m_thread = std::thread(&GSJobQueue::ThreadProc, this);
 	}
@@ -76,16 +119,47 @@ public:
 		return m_queue.empty();
 	}
 
+	Stats GetStats() const
+	{
+		return {m_worker_waits.load(std::memory_order_relaxed), m_worker_parks.load(std::memory_order_relaxed),
+			m_push_spins.load(std::memory_order_relaxed), m_push_parks.load(std::memory_order_relaxed)};
+	}
+
 	void Push(const T& item)
 	{
-		while (!m_queue.push(item))
-			std::this_thread::yield();
+		if (!m_queue.push(item))
+		{
+			m_push_spins.fetch_add(1, std::memory_order_relaxed);
+
+			u32 waited = 0;
+			while (!m_queue.push(item))
+			{
+				if (waited < m_spin_ns)
+				{
+					waited += ShortSpin();
+					continue;
+				}
+
+				// Ring is still full, park until the worker frees a slot.
+				m_push_waiting.store(true, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (m_queue.push(item))
+				{
+					// If the worker already cleared the flag it has posted (or is about to), consume that wakeup.
+					if (!m_push_waiting.exchange(false, std::memory_order_acq_rel))
+						m_space_sema.Wait();
+					break;
+				}
+				m_push_parks.fetch_add(1, std::memory_order_relaxed);
+				m_space_sema.Wait();
+			}
+		}
 		m_sema.NotifyOfWork();
 	}
 
 	void Wait()
 	{
-		m_sema.WaitForEmptyWithSpin();
+		m_sema.WaitForEmptyWithSpin(m_spin_ns);
 		assert(IsEmpty());
 	}
 
@@ -26,6 +26,7 @@
 #include "common/Timer.h"
 #include "fmt/core.h"
 #include <array>
+#include <atomic>
 
 #ifndef PCSX2_CORE
 #include "gui/AppCoreThread.h"
@@ -63,12 +64,18 @@ static constexpr std::array<PresentShader, 6> s_tv_shader_indices = {
 
 std::unique_ptr<GSRenderer> g_gs_renderer;
 
+// Set while a GS dump is requested or being written, read by the CPU thread (see GSIsDumping()).
+static std::atomic_bool s_dump_active{false};
+
 GSRenderer::GSRenderer()
 	: m_shader_time_start(Common::Timer::GetCurrentValue())
 {
 }
 
-GSRenderer::~GSRenderer() = default;
+GSRenderer::~GSRenderer()
+{
+	s_dump_active.store(false, std::memory_order_release);
+}
 
 void GSRenderer::Reset(bool hardware_reset)
 {
@@ -555,7 +562,7 @@ static GSVector4i CalculateDrawSrcRect(const GSTexture* src)
 #endif
 }
 
-void GSRenderer::VSync(u32 field, bool registers_written)
+void GSRenderer::VSync(u32 field, bool registers_written, bool skip_present, bool rolled_back)
 {
 	Flush();
 
@@ -597,6 +604,14 @@ void GSRenderer::VSync(u32 field, bool registers_written)
 
 	const bool blank_frame = !Merge(field);
 
+	// Frames which aren't presented (run-ahead) are still merged, so the deinterlacer has the
+	// previous field, but they never reach the display or the frame rate counters.
+	if (skip_present)
+	{
+		UpdateSnapshotAndDump(field, false, rolled_back);
+		return;
+	}
+
 	if (skip_frame)
 	{
 		g_gs_device->ResetAPIState();
@@ -647,9 +662,41 @@ void GSRenderer::VSync(u32 field, bool registers_written)
 	std::unique_lock snapshot_lock(m_snapshot_mutex);
 #endif
 
-	if (!m_snapshot.empty())
+	UpdateSnapshotAndDump(field, true, rolled_back);
+
+#ifndef PCSX2_CORE
+	// capture
+	if (m_capture.IsCapturing())
 	{
-		if (!m_dump && m_dump_frames > 0)
+		if (GSTexture* current = g_gs_device->GetCurrent())
+		{
+			GSVector2i size = m_capture.GetSize();
+
+			bool res;
+			GSTexture::GSMap m;
+			if (size == current->GetSize())
+				res = g_gs_device->DownloadTexture(current, GSVector4i(0, 0, size.x, size.y), m);
+			else
+				res = g_gs_device->DownloadTextureConvert(current, GSVector4(0, 0, 1, 1), size, GSTexture::Format::Color, ShaderConvert::COPY, m, true);
+
+			if (res)
+			{
+				m_capture.DeliverFrame(m.bits, m.pitch, !g_gs_device->IsRBSwapped());
+				g_gs_device->DownloadTextureComplete();
+			}
+		}
+	}
+#endif
+}
+
+// Takes queued screenshots, and starts or advances GS dumps. Only presented frames are captured.
+void GSRenderer::UpdateSnapshotAndDump(u32 field, bool presented, bool rolled_back)
+{
+	// New dumps have to start on a frame which stays, everything before it is in the dump's state.
+	const bool start_dump = (m_dump_frames > 0 && !rolled_back);
+	if (!m_snapshot.empty() && presented && (start_dump || m_dump_frames == 0))
+	{
+		if (!m_dump && start_dump)
 		{
 			freezeData fd = {0, nullptr};
 			Freeze(&fd, true);
@@ -711,8 +758,27 @@ void GSRenderer::VSync(u32 field, bool registers_written)
 
 		m_snapshot = {};
 	}
+	else if (m_dump && rolled_back)
+	{
+		// The dump can't follow the machine being rolled back, give up on it rather than write a
+		// broken one. Run-ahead stops while dumping, this only happens for a dump started just
+		// before the CPU noticed.
+		Host::AddKeyedOSDMessage("GSDump", "GS dump abandoned, run-ahead rolled back frames in it.", 10.0f);
+		m_dump.reset();
+		m_dump_frames = 0;
+	}
 	else if (m_dump)
 	{
+		GSDumpBase::Stats stats;
+		if (m_dump->UpdateStats(&stats))
+		{
+			Host::AddKeyedOSDMessage("GSDumpStats",
+				fmt::format("GS dump: {:.1f} MB/s in, {:.1f} MB/s out, {:.1f} MB written, queue {}/{}",
+					stats.input_rate / _1mb, stats.output_rate / _1mb, static_cast<double>(stats.output_size) / _1mb,
+					stats.queue_depth, stats.queue_capacity),
+				2.0f);
+		}
+
 		const bool last = (m_dump_frames == 0);
 		if (m_dump->VSync(field, last, m_regs))
 		{
@@ -725,29 +791,17 @@ void GSRenderer::VSync(u32 field, bool registers_written)
 		}
 	}
 
-#ifndef PCSX2_CORE
-	// capture
-	if (m_capture.IsCapturing())
-	{
-		if (GSTexture* current = g_gs_device->GetCurrent())
-		{
-			GSVector2i size = m_capture.GetSize();
+	UpdateDumpActive();
+}
 
-			bool res;
-			GSTexture::GSMap m;
-			if (size == current->GetSize())
-				res = g_gs_device->DownloadTexture(current, GSVector4i(0, 0, size.x, size.y), m);
-			else
-				res = g_gs_device->DownloadTextureConvert(current, GSVector4(0, 0, 1, 1), size, GSTexture::Format::Color, ShaderConvert::COPY, m, true);
+void GSRenderer::UpdateDumpActive()
+{
+	s_dump_active.store(m_dump || (!m_snapshot.empty() && m_dump_frames > 0), std::memory_order_release);
+}
 
-			if (res)
-			{
-				m_capture.DeliverFrame(m.bits, m.pitch, !g_gs_device->IsRBSwapped());
-				g_gs_device->DownloadTextureComplete();
-			}
-		}
-	}
-#endif
+bool GSRenderer::IsDumpActive()
+{
+	return s_dump_active.load(std::memory_order_acquire);
 }
 
 void GSRenderer::QueueSnapshot(const std::string& path, u32 gsdump_frames)
@@ -811,12 +865,14 @@ void GSRenderer::QueueSnapshot(const std::string& path, u32 gsdump_frames)
 #ifdef PCSX2_CORE
 	m_dump_frames = gsdump_frames;
 #endif
+	UpdateDumpActive();
 }
 
 void GSRenderer::StopGSDump()
 {
 	m_snapshot = {};
 	m_dump_frames = 0;
+	UpdateDumpActive();
 }
 
 void GSRenderer::PresentCurrentFrame()
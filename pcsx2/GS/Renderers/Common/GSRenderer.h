@@ -29,6 +29,8 @@ class GSRenderer : public GSState
 {
 private:
 	bool Merge(int field);
+	void UpdateSnapshotAndDump(u32 field, bool presented, bool rolled_back);
+	void UpdateDumpActive();
 
 	u64 m_shader_time_start = 0;
 
@@ -57,7 +59,7 @@ public:
 
 	virtual void Destroy();
 
-	virtual void VSync(u32 field, bool registers_written);
+	virtual void VSync(u32 field, bool registers_written, bool skip_present, bool rolled_back);
 	virtual bool CanUpscale() { return false; }
 	virtual int GetUpscaleMultiplier() { return 1; }
 	virtual GSVector2 GetTextureScaleFactor() { return { 1.0f, 1.0f }; }
@@ -72,6 +74,9 @@ public:
 	void StopGSDump();
 	void PresentCurrentFrame();
 
+	/// True while a GS dump is requested or being written, callable from any thread.
+	static bool IsDumpActive();
+
 #ifndef PCSX2_CORE
 	bool BeginCapture(std::string& filename);
 	void EndCapture();
@@ -21,6 +21,7 @@
 #include "GS/Renderers/SW/GSVertexSW.h"
 #include "GS/Renderers/HW/GSVertexHW.h"
 #include "GSFunctionMap.h"
+#include <cfloat>
 
 class GSState;
 
@@ -42,7 +43,7 @@ public:
 protected:
 	const GSState* m_state;
 
-	static const GSVector4 s_minmax;
+	static constexpr GSVector4 s_minmax = GSVector4::cxpr(FLT_MAX, -FLT_MAX, 0.f, 0.f);
 
 	typedef void (GSVertexTrace::*FindMinMaxPtr)(const void* vertex, const u32* index, int count);
 
@@ -52,6 +53,17 @@ protected:
 	void FindMinMax(const void* vertex, const u32* index, int count);
 
 public:
+	/// Bounds of the drawn vertices, before the offset and texture size are applied.
+	struct RawMinMax
+	{
+		GSVector4 tmin, tmax;
+		GSVector4i cmin, cmax;
+		GSVector4i pmin, pmax;
+	};
+
+	template <GS_PRIM_CLASS primclass, u32 iip, u32 tme, u32 fst, u32 color, bool provoking_vertex_first>
+	static RawMinMax FindRawMinMax(const void* vertex, const u32* index, int count);
+
 	GS_PRIM_CLASS m_primclass;
 
 	Vertex m_min;
@@ -83,3 +95,226 @@ public:
 
 	void CorrectDepthTrace(const void* vertex, int count);
 };
+
+template <GS_PRIM_CLASS primclass, u32 iip, u32 tme, u32 fst, u32 color, bool flat_swapped>
+GSVertexTrace::RawMinMax GSVertexTrace::FindRawMinMax(const void* vertex, const u32* index, int count)
+{
+	int n = 1;
+
+	switch (primclass)
+	{
+		case GS_POINT_CLASS:
+			n = 1;
+			break;
+		case GS_LINE_CLASS:
+		case GS_SPRITE_CLASS:
+			n = 2;
+			break;
+		case GS_TRIANGLE_CLASS:
+			n = 3;
+			break;
+	}
+
+	GSVector4 tmin = s_minmax.xxxx();
+	GSVector4 tmax = s_minmax.yyyy();
+	GSVector4i cmin = GSVector4i::xffffffff();
+	GSVector4i cmax = GSVector4i::zero();
+
+	GSVector4i pmin = GSVector4i::xffffffff();
+	GSVector4i pmax = GSVector4i::zero();
+
+#if _M_SSE >= 0x501
+	// Each half of the 256-bit accumulators tracks one vertex of the pair, they are folded after the loops
+	GSVector8 tmin8 = GSVector8(tmin, tmin);
+	GSVector8 tmax8 = GSVector8(tmax, tmax);
+	GSVector8i pmin8 = GSVector8i::xffffffff();
+	GSVector8i pmax8 = GSVector8i::zero();
+#endif
+
+	const GSVertex* RESTRICT v = (GSVertex*)vertex;
+
+	// Process 2 vertices at a time for increased efficiency
+	auto processVertices = [&](const GSVertex& v0, const GSVertex& v1, bool finalVertex)
+	{
+		if (color)
+		{
+			GSVector4i c0 = GSVector4i::load(v0.RGBAQ.U32[0]);
+			GSVector4i c1 = GSVector4i::load(v1.RGBAQ.U32[0]);
+			if (iip || finalVertex)
+			{
+				cmin = cmin.min_u8(c0.min_u8(c1));
+				cmax = cmax.max_u8(c0.max_u8(c1));
+			}
+			else if (n == 2)
+			{
+				// For even n, we process v1 and v2 of the same prim
+				// (For odd n, we process one vertex from each of two prims)
+				cmin = cmin.min_u8(c1);
+				cmax = cmax.max_u8(c1);
+			}
+		}
+
+#if _M_SSE >= 0x501
+
+		// Same as below, with v0 in the low and v1 in the high 128 bits
+
+		if (tme)
+		{
+			if (!fst)
+			{
+				GSVector8 stq = GSVector8::load(&v0.m[0], &v1.m[0]);
+
+				// Sprites take q from v1 for both vertices
+				GSVector8 qsrc = primclass == GS_SPRITE_CLASS ? stq.bb() : stq;
+
+				// Only s and t are divided, the z (rgba) field is often denormal
+				GSVector8 st = stq.xyxy() / qsrc.wwww();
+
+				stq = st.xyww(qsrc);
+
+				tmin8 = tmin8.min(stq);
+				tmax8 = tmax8.max(stq);
+			}
+			else
+			{
+				GSVector8i uv = GSVector8i::load(&v0.m[1], &v1.m[1]);
+
+				GSVector8 st = GSVector8(uv.uph16()).xyxy();
+
+				tmin8 = tmin8.min(st);
+				tmax8 = tmax8.max(st);
+			}
+		}
+
+		GSVector8i xyzf = GSVector8i::load(&v0.m[1], &v1.m[1]);
+
+		GSVector8i xy = xyzf.upl16();
+		GSVector8i z = xyzf.yyyy();
+
+		GSVector8i p = xy.blend16<0xf0>(z.uph32(primclass == GS_SPRITE_CLASS ? GSVector8i::broadcast128(&v1.m[1]) : xyzf));
+
+		pmin8 = pmin8.min_u32(p);
+		pmax8 = pmax8.max_u32(p);
+
+#else
+
+		if (tme)
+		{
+			if (!fst)
+			{
+				GSVector4 stq0 = GSVector4::cast(GSVector4i(v0.m[0]));
+				GSVector4 stq1 = GSVector4::cast(GSVector4i(v1.m[0]));
+
+				GSVector4 q;
+				// Sprites always have indices == vertices, so we don't have to look at the index table here
+				if (primclass == GS_SPRITE_CLASS)
+					q = stq1.wwww();
+				else
+					q = stq0.wwww(stq1);
+
+				// Note: If in the future this is changed in a way that causes parts of calculations to go unused,
+				//       make sure to remove the z (rgba) field as it's often denormal.
+				//       Then, use GSVector4::noopt() to prevent clang from optimizing out your "useless" shuffle
+				//       e.g. stq = (stq.xyww() / stq.wwww()).noopt().xyww(stq);
+				GSVector4 st = stq0.xyxy(stq1) / q;
+
+				stq0 = st.xyww(primclass == GS_SPRITE_CLASS ? stq1 : stq0);
+				stq1 = st.zwww(stq1);
+
+				tmin = tmin.min(stq0.min(stq1));
+				tmax = tmax.max(stq0.max(stq1));
+			}
+			else
+			{
+				GSVector4i uv0(v0.m[1]);
+				GSVector4i uv1(v1.m[1]);
+
+				GSVector4 st0 = GSVector4(uv0.uph16()).xyxy();
+				GSVector4 st1 = GSVector4(uv1.uph16()).xyxy();
+
+				tmin = tmin.min(st0.min(st1));
+				tmax = tmax.max(st0.max(st1));
+			}
+		}
+
+		GSVector4i xyzf0(v0.m[1]);
+		GSVector4i xyzf1(v1.m[1]);
+
+		GSVector4i xy0 = xyzf0.upl16();
+		GSVector4i z0 = xyzf0.yyyy();
+		GSVector4i xy1 = xyzf1.upl16();
+		GSVector4i z1 = xyzf1.yyyy();
+
+		GSVector4i p0 = xy0.blend16<0xf0>(z0.uph32(primclass == GS_SPRITE_CLASS ? xyzf1 : xyzf0));
+		GSVector4i p1 = xy1.blend16<0xf0>(z1.uph32(xyzf1));
+
+		pmin = pmin.min_u32(p0.min_u32(p1));
+		pmax = pmax.max_u32(p0.max_u32(p1));
+
+#endif
+	};
+
+	if (n == 2)
+	{
+		int i = 0;
+		for (; i < (count - 3); i += 4) // 4 vertices (2 prims) per iteration
+		{
+			processVertices(v[index[i + 0]], v[index[i + 1]], false);
+			processVertices(v[index[i + 2]], v[index[i + 3]], false);
+		}
+		if (count & 2)
+		{
+			processVertices(v[index[i + 0]], v[index[i + 1]], false);
+		}
+	}
+	else if (iip || n == 1) // iip means final and non-final vertexes are treated the same
+	{
+		int i = 0;
+		for (; i < (count - 3); i += 4) // 4x loop unroll
+		{
+			processVertices(v[index[i + 0]], v[index[i + 1]], true);
+			processVertices(v[index[i + 2]], v[index[i + 3]], true);
+		}
+		if (count & 2)
+		{
+			processVertices(v[index[i + 0]], v[index[i + 1]], true);
+			i += 2;
+		}
+		if (count & 1)
+		{
+			// Compiler optimizations go!
+			// (And if they don't, it's only one vertex out of many)
+			processVertices(v[index[i]], v[index[i]], true);
+		}
+	}
+	else if (n == 3)
+	{
+		int i = 0;
+		for (; i < (count - 3); i += 6)
+		{
+			processVertices(v[index[i + 0]], v[index[i + 3]], flat_swapped);
+			processVertices(v[index[i + 1]], v[index[i + 4]], false);
+			processVertices(v[index[i + 2]], v[index[i + 5]], !flat_swapped);
+		}
+		if (count & 1)
+		{
+			processVertices(v[index[i + 0]], v[index[i + 1]], flat_swapped);
+			// Compiler optimizations go!
+			// (And if they don't, it's only one vertex out of many)
+			processVertices(v[index[i + 2]], v[index[i + 2]], !flat_swapped);
+		}
+	}
+	else
+	{
+		pxAssertRel(0, "Bad n value");
+	}
+
+#if _M_SSE >= 0x501
+	tmin = tmin8.extract<0>().min(tmin8.extract<1>());
+	tmax = tmax8.extract<0>().max(tmax8.extract<1>());
+	pmin = pmin8.extract<0>().min_u32(pmin8.extract<1>());
+	pmax = pmax8.extract<0>().max_u32(pmax8.extract<1>());
+#endif
+
+	return {tmin, tmax, cmin, cmax, pmin, pmax};
+}
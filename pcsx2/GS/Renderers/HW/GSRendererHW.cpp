@@ -196,7 +196,7 @@ void GSRendererHW::UpdateSettings(const Pcsx2Config::GSOptions& old_config)
 	SetTCOffset();
 }
 
-void GSRendererHW::VSync(u32 field, bool registers_written)
+void GSRendererHW::VSync(u32 field, bool registers_written, bool skip_present, bool rolled_back)
 {
 	if (m_reset)
 	{
@@ -207,7 +207,7 @@ void GSRendererHW::VSync(u32 field, bool registers_written)
 	if (GSConfig.LoadTextureReplacements)
 		GSTextureReplacements::ProcessAsyncLoadedTextures();
 
-	GSRenderer::VSync(field, registers_written);
+	GSRenderer::VSync(field, registers_written, skip_present, rolled_back);
 
 	m_tc->IncAge();
 
@@ -190,7 +190,7 @@ public:
 
 	void Reset(bool hardware_reset) override;
 	void UpdateSettings(const Pcsx2Config::GSOptions& old_config) override;
-	void VSync(u32 field, bool registers_written) override;
+	void VSync(u32 field, bool registers_written, bool skip_present, bool rolled_back) override;
 
 	GSTexture* GetOutput(int i, int& y_offset) override;
 	GSTexture* GetFeedbackOutput() override;
@@ -57,12 +57,7 @@ void GSTextureCache::RemovePartial()
 	//m_src.RemoveAll();
 
 	for (int type = 0; type < 2; type++)
-	{
-		for (auto t : m_dst[type])
-			delete t;
-
-		m_dst[type].clear();
-	}
+		RemoveTargets(type);
 }
 
 void GSTextureCache::RemoveAll()
@@ -70,12 +65,7 @@ void GSTextureCache::RemoveAll()
 	m_src.RemoveAll();
 
 	for (int type = 0; type < 2; type++)
-	{
-		for (auto t : m_dst[type])
-			delete t;
-
-		m_dst[type].clear();
-	}
+		RemoveTargets(type);
 
 	for (auto it : m_hash_cache)
 		g_gs_device->Recycle(it.second.texture);
@@ -103,7 +93,7 @@ GSTextureCache::Source* GSTextureCache::LookupDepthSource(const GIFRegTEX0& TEX0
 	const u32 bp = TEX0.TBP0;
 	const u32 psm = TEX0.PSM;
 
-	for (auto t : m_dst[DepthStencil])
+	for (auto t : m_dst_map[DepthStencil][bp >> 5])
 	{
 		if (t->m_used && t->m_dirty.empty() && GSUtil::HasSharedBits(bp, psm, t->m_TEX0.TBP0, t->m_TEX0.PSM))
 		{
@@ -125,7 +115,7 @@ GSTextureCache::Source* GSTextureCache::LookupDepthSource(const GIFRegTEX0& TEX0
 	if (!dst)
 	{
 		// Retry on the render target (Silent Hill 4)
-		for (auto t : m_dst[RenderTarget])
+		for (auto t : m_dst_map[RenderTarget][bp >> 5])
 		{
 			// FIXME: do I need to allow m_age == 1 as a potential match (as DepthStencil) ???
 			if (!t->m_age && t->m_used && t->m_dirty.empty() && GSUtil::HasSharedBits(bp, psm, t->m_TEX0.TBP0, t->m_TEX0.PSM))
@@ -347,7 +337,7 @@ GSTextureCache::Source* GSTextureCache::LookupSource(const GIFRegTEX0& TEX0, con
 			// Unfortunately, I don't have any Arc the Lad testcase
 			//
 			// 1/ Check only current frame, I guess it is only used as a postprocessing effect
-			for (auto t : m_dst[DepthStencil])
+			for (auto t : m_dst_map[DepthStencil][bp >> 5])
 			{
 				if (!t->m_age && t->m_used && t->m_dirty.empty() && GSUtil::HasSharedBits(bp, psm, t->m_TEX0.TBP0, t->m_TEX0.PSM))
 				{
@@ -442,13 +432,11 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(const GIFRegTEX0& TEX0, con
 	auto& list = m_dst[type];
 	if (!is_frame)
 	{
-		for (auto i = list.begin(); i != list.end(); ++i)
+		for (auto t : m_dst_map[type][bp >> 5])
 		{
-			Target* t = *i;
-
 			if (bp == t->m_TEX0.TBP0)
 			{
-				list.MoveFront(i.Index());
+				MoveTargetFront(t);
 
 				dst = t;
 
@@ -463,7 +451,7 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(const GIFRegTEX0& TEX0, con
 	{
 		assert(type == RenderTarget);
 		// Let's try to find a perfect frame that contains valid data
-		for (auto t : list)
+		for (auto t : m_dst_map[type][bp >> 5])
 		{
 			if (bp == t->m_TEX0.TBP0 && t->m_end_block >= bp)
 			{
@@ -496,7 +484,7 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(const GIFRegTEX0& TEX0, con
 		// 3rd try ! Try to find a frame that doesn't contain valid data (honestly I'm not sure we need to do it)
 		if (!dst)
 		{
-			for (auto t : list)
+			for (auto t : m_dst_map[type][bp >> 5])
 			{
 				if (bp == t->m_TEX0.TBP0)
 				{
@@ -540,7 +528,7 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(const GIFRegTEX0& TEX0, con
 		// Depth stencil/RT can be an older RT/DS but only check recent RT/DS to avoid to pick
 		// some bad data.
 		Target* dst_match = nullptr;
-		for (auto t : m_dst[rev_type])
+		for (auto t : m_dst_map[rev_type][bp >> 5])
 		{
 			if (bp == t->m_TEX0.TBP0)
 			{
@@ -692,18 +680,15 @@ void GSTextureCache::InvalidateVideoMemType(int type, u32 bp)
 	if (GSConfig.UserHacks_DisableDepthSupport)
 		return;
 
-	auto& list = m_dst[type];
-	for (auto i = list.begin(); i != list.end(); ++i)
+	for (auto t : m_dst_map[type][bp >> 5])
 	{
-		Target* t = *i;
-
 		if (bp == t->m_TEX0.TBP0)
 		{
 			GL_CACHE("TC: InvalidateVideoMemType: Remove Target(%s) %d (0x%x)", to_string(type),
 				t->m_texture ? t->m_texture->GetID() : 0,
 				t->m_TEX0.TBP0);
 
-			list.erase(i);
+			RemoveTarget(t);
 			delete t;
 
 			break;
@@ -854,138 +839,157 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 	if (!target)
 		return;
 
+	// Targets can only be affected if they start between the largest target span before bp, for writes inside
+	// of a target, and the last row of pages of the write, for targets that begin after bp.
+	const u32 write_rows = (std::max(r.bottom, 0) + GSLocalMemory::m_psm[psm].pgs.y - 1) / GSLocalMemory::m_psm[psm].pgs.y;
+	const u32 write_end = bp + std::max(write_rows * std::max(bw, 1u) * 32, 1u) - 1;
+
 	for (int type = 0; type < 2; type++)
 	{
-		auto& list = m_dst[type];
-		for (auto i = list.begin(); i != list.end();)
+		u32 start_page = (bp - std::min(bp, m_dst_max_span[type])) >> 5;
+		u32 write_end_page = std::min(write_end, MAX_BP) >> 5;
+
+		// Writes that wrap around the end of memory, or start in the part of a target that wrapped around, can
+		// hit targets that begin anywhere.
+		if (write_end > MAX_BP || bp < m_dst_wrap_end[type])
 		{
-			auto j = i++;
-			Target* t = *j;
+			start_page = 0;
+			write_end_page = MAX_PAGES - 1;
+		}
 
-			// GH: (I think) this code is completely broken. Typical issue:
-			// EE write an alpha channel into 32 bits texture
-			// Results: the target is deleted (because HasCompatibleBits is false)
-			//
-			// Major issues are expected if the game try to reuse the target
-			// If we dirty the RT, it will likely upload partially invalid data.
-			// (The color on the previous example)
-			if (GSUtil::HasSharedBits(bp, psm, t->m_TEX0.TBP0, t->m_TEX0.PSM))
+		for (u32 page = FindTargetPage(type, start_page); page <= write_end_page; page = FindTargetPage(type, page + 1))
+		{
+			auto& list = m_dst_map[type][page];
+			for (auto i = list.begin(); i != list.end();)
 			{
-				if (!found && GSUtil::HasCompatibleBits(psm, t->m_TEX0.PSM))
-				{
-					GL_CACHE("TC: Dirty Target(%s) %d (0x%x) r(%d,%d,%d,%d)", to_string(type),
-						t->m_texture ? t->m_texture->GetID() : 0,
-						t->m_TEX0.TBP0, r.x, r.y, r.z, r.w);
-					t->m_TEX0.TBW = bw;
-					t->m_dirty.push_back(GSDirtyRect(r, psm, bw));
-				}
-				else
+				Target* t = *i;
+				++i;
+
+				// GH: (I think) this code is completely broken. Typical issue:
+				// EE write an alpha channel into 32 bits texture
+				// Results: the target is deleted (because HasCompatibleBits is false)
+				//
+				// Major issues are expected if the game try to reuse the target
+				// If we dirty the RT, it will likely upload partially invalid data.
+				// (The color on the previous example)
+				if (GSUtil::HasSharedBits(bp, psm, t->m_TEX0.TBP0, t->m_TEX0.PSM))
 				{
-					// YOLO skipping t->m_TEX0.TBW = bw; It would change the surface offset results...
-					const SurfaceOffset so = ComputeSurfaceOffset(off, r, t);
-					if (so.is_valid)
+					if (!found && GSUtil::HasCompatibleBits(psm, t->m_TEX0.PSM))
 					{
-						// Offset from Target to Write in Target coords.
-						t->m_dirty.push_back(GSDirtyRect(so.b2a_offset, psm, bw));
-						GL_CACHE("TC: Dirty in the middle [aggressive] of Target(%s) %d [PSM:%s BP:0x%x->0x%x BW:%u rect(%d,%d=>%d,%d)] write[PSM:%s BP:0x%x BW:%u rect(%d,%d=>%d,%d)]",
-							to_string(type),
+						GL_CACHE("TC: Dirty Target(%s) %d (0x%x) r(%d,%d,%d,%d)", to_string(type),
 							t->m_texture ? t->m_texture->GetID() : 0,
-							psm_str(t->m_TEX0.PSM),
-							t->m_TEX0.TBP0,
-							t->m_end_block,
-							t->m_TEX0.TBW,
-							so.b2a_offset.x,
-							so.b2a_offset.y,
-							so.b2a_offset.z,
-							so.b2a_offset.w,
-							psm_str(psm),
-							bp,
-							bw,
-							r.x,
-							r.y,
-							r.z,
-							r.w
-						);
+							t->m_TEX0.TBP0, r.x, r.y, r.z, r.w);
+						t->m_TEX0.TBW = bw;
+						t->m_dirty.push_back(GSDirtyRect(r, psm, bw));
 					}
 					else
 					{
-						list.erase(j);
-						GL_CACHE("TC: Remove Target(%s) %d (0x%x)", to_string(type),
-							t->m_texture ? t->m_texture->GetID() : 0,
-							t->m_TEX0.TBP0);
-						delete t;
+						// YOLO skipping t->m_TEX0.TBW = bw; It would change the surface offset results...
+						const SurfaceOffset so = ComputeSurfaceOffset(off, r, t);
+						if (so.is_valid)
+						{
+							// Offset from Target to Write in Target coords.
+							t->m_dirty.push_back(GSDirtyRect(so.b2a_offset, psm, bw));
+							GL_CACHE("TC: Dirty in the middle [aggressive] of Target(%s) %d [PSM:%s BP:0x%x->0x%x BW:%u rect(%d,%d=>%d,%d)] write[PSM:%s BP:0x%x BW:%u rect(%d,%d=>%d,%d)]",
+								to_string(type),
+								t->m_texture ? t->m_texture->GetID() : 0,
+								psm_str(t->m_TEX0.PSM),
+								t->m_TEX0.TBP0,
+								t->m_end_block,
+								t->m_TEX0.TBW,
+								so.b2a_offset.x,
+								so.b2a_offset.y,
+								so.b2a_offset.z,
+								so.b2a_offset.w,
+								psm_str(psm),
+								bp,
+								bw,
+								r.x,
+								r.y,
+								r.z,
+								r.w
+							);
+						}
+						else
+						{
+							RemoveTarget(t);
+							GL_CACHE("TC: Remove Target(%s) %d (0x%x)", to_string(type),
+								t->m_texture ? t->m_texture->GetID() : 0,
+								t->m_TEX0.TBP0);
+							delete t;
+						}
+						continue;
 					}
-					continue;
 				}
-			}
-			else if (bp == t->m_TEX0.TBP0)
-			{
-				// EE writes the ALPHA channel. Mark it as invalid for
-				// the texture cache. Otherwise it will generate a wrong
-				// hit on the texture cache.
-				// Game: Conflict - Desert Storm (flickering)
-				t->m_dirty_alpha = false;
-			}
+				else if (bp == t->m_TEX0.TBP0)
+				{
+					// EE writes the ALPHA channel. Mark it as invalid for
+					// the texture cache. Otherwise it will generate a wrong
+					// hit on the texture cache.
+					// Game: Conflict - Desert Storm (flickering)
+					t->m_dirty_alpha = false;
+				}
 
-			// GH: Try to detect texture write that will overlap with a target buffer
-			// TODO Use ComputeSurfaceOffset below.
-			if (GSUtil::HasSharedBits(psm, t->m_TEX0.PSM))
-			{
-				if (bp < t->m_TEX0.TBP0)
+				// GH: Try to detect texture write that will overlap with a target buffer
+				// TODO Use ComputeSurfaceOffset below.
+				if (GSUtil::HasSharedBits(psm, t->m_TEX0.PSM))
 				{
-					u32 rowsize = bw * 8192;
-					u32 offset = (u32)((t->m_TEX0.TBP0 - bp) * 256);
-
-					// This grossness is needed to fix incorrect invalidations in True Crime: New York City.
-					// Because it's writing tiny texture blocks (which are later decompressed) over previous targets,
-					// we need to be ensure said targets are invalidated, otherwise the SW prim render path won't be
-					// triggered. This whole thing needs rewriting anyway, because it can't handle non-page-aligned
-					// writes, but for now we'll just use the unsafer logic when the TC hack is enabled.
-					const bool start_of_page = rowsize > 0 && (offset % rowsize == 0);
-					if (start_of_page || (rowsize > 0 && GSConfig.UserHacks_CPUSpriteRenderBW != 0))
+					if (bp < t->m_TEX0.TBP0)
 					{
-						int y = GSLocalMemory::m_psm[psm].pgs.y * offset / rowsize;
-
-						if (r.bottom > y && (start_of_page || r.top >= y))
+						u32 rowsize = bw * 8192;
+						u32 offset = (u32)((t->m_TEX0.TBP0 - bp) * 256);
+
+						// This grossness is needed to fix incorrect invalidations in True Crime: New York City.
+						// Because it's writing tiny texture blocks (which are later decompressed) over previous targets,
+						// we need to be ensure said targets are invalidated, otherwise the SW prim render path won't be
+						// triggered. This whole thing needs rewriting anyway, because it can't handle non-page-aligned
+						// writes, but for now we'll just use the unsafer logic when the TC hack is enabled.
+						const bool start_of_page = rowsize > 0 && (offset % rowsize == 0);
+						if (start_of_page || (rowsize > 0 && GSConfig.UserHacks_CPUSpriteRenderBW != 0))
 						{
-							GL_CACHE("TC: Dirty After Target(%s) %d (0x%x)", to_string(type),
-								t->m_texture ? t->m_texture->GetID() : 0,
-								t->m_TEX0.TBP0);
-							// TODO: do not add this rect above too
-							t->m_TEX0.TBW = bw;
-							t->m_dirty.push_back(GSDirtyRect(GSVector4i(r.left, r.top - y, r.right, r.bottom - y), psm, bw));
-							continue;
+							int y = GSLocalMemory::m_psm[psm].pgs.y * offset / rowsize;
+
+							if (r.bottom > y && (start_of_page || r.top >= y))
+							{
+								GL_CACHE("TC: Dirty After Target(%s) %d (0x%x)", to_string(type),
+									t->m_texture ? t->m_texture->GetID() : 0,
+									t->m_TEX0.TBP0);
+								// TODO: do not add this rect above too
+								t->m_TEX0.TBW = bw;
+								t->m_dirty.push_back(GSDirtyRect(GSVector4i(r.left, r.top - y, r.right, r.bottom - y), psm, bw));
+								continue;
+							}
 						}
 					}
-				}
 
-				// FIXME: this code "fixes" black FMV issue with rule of rose.
+					// FIXME: this code "fixes" black FMV issue with rule of rose.
 #if 1
-				// Greg: I'm not sure the 'bw' equality is required but it won't hurt too much
-				//
-				// Ben 10 Alien Force : Vilgax Attacks uses a small temporary target for multiple textures (different bw)
-				// It is too complex to handle, and purpose of the code was to handle FMV (large bw). So let's skip small
-				// (128 pixels) target
-				if (bw > 2 && t->m_TEX0.TBW == bw && t->Inside(bp, bw, psm, rect) && GSUtil::HasCompatibleBits(psm, t->m_TEX0.PSM))
-				{
-					const u32 rowsize = bw * 8192u;
-					const u32 offset = (u32)((bp - t->m_TEX0.TBP0) * 256);
-
-					if (offset % rowsize == 0)
+					// Greg: I'm not sure the 'bw' equality is required but it won't hurt too much
+					//
+					// Ben 10 Alien Force : Vilgax Attacks uses a small temporary target for multiple textures (different bw)
+					// It is too complex to handle, and purpose of the code was to handle FMV (large bw). So let's skip small
+					// (128 pixels) target
+					if (bw > 2 && t->m_TEX0.TBW == bw && t->Inside(bp, bw, psm, rect) && GSUtil::HasCompatibleBits(psm, t->m_TEX0.PSM))
 					{
-						const int y = GSLocalMemory::m_psm[psm].pgs.y * offset / rowsize;
+						const u32 rowsize = bw * 8192u;
+						const u32 offset = (u32)((bp - t->m_TEX0.TBP0) * 256);
 
-						GL_CACHE("TC: Dirty in the middle of Target(%s) %d (0x%x->0x%x) pos(%d,%d => %d,%d) bw:%u", to_string(type),
-							t->m_texture ? t->m_texture->GetID() : 0,
-							t->m_TEX0.TBP0, t->m_end_block,
-							r.left, r.top + y, r.right, r.bottom + y, bw);
+						if (offset % rowsize == 0)
+						{
+							const int y = GSLocalMemory::m_psm[psm].pgs.y * offset / rowsize;
 
-						t->m_TEX0.TBW = bw;
-						t->m_dirty.push_back(GSDirtyRect(GSVector4i(r.left, r.top + y, r.right, r.bottom + y), psm, bw));
-						continue;
+							GL_CACHE("TC: Dirty in the middle of Target(%s) %d (0x%x->0x%x) pos(%d,%d => %d,%d) bw:%u", to_string(type),
+								t->m_texture ? t->m_texture->GetID() : 0,
+								t->m_TEX0.TBP0, t->m_end_block,
+								r.left, r.top + y, r.right, r.bottom + y, bw);
+
+							t->m_TEX0.TBW = bw;
+							t->m_dirty.push_back(GSDirtyRect(GSVector4i(r.left, r.top + y, r.right, r.bottom + y), psm, bw));
+							continue;
+						}
 					}
-				}
 #endif
+				}
 			}
 		}
 	}
@@ -1020,7 +1024,7 @@ void GSTextureCache::InvalidateLocalMem(const GSOffset& off, const GSVector4i& r
 		GL_INS("ERROR: InvalidateLocalMem depth format isn't supported (%d,%d to %d,%d)", r.x, r.y, r.z, r.w);
 		if (!GSConfig.UserHacks_DisableDepthSupport)
 		{
-			auto& dss = m_dst[DepthStencil];
+			auto& dss = m_dst_map[DepthStencil][bp >> 5];
 			for (auto it = dss.rbegin(); it != dss.rend(); ++it)  // Iterate targets from LRU to MRU.
 			{
 				Target* t = *it;
@@ -1038,7 +1042,7 @@ void GSTextureCache::InvalidateLocalMem(const GSOffset& off, const GSVector4i& r
 	// It works for all the games mentioned below and fixes a couple of other ones as well
 	// (Busen0: Wizardry and Chaos Legion).
 	// Also in a few games the below code ran the Grandia3 case when it shouldn't :p
-	auto& rts = m_dst[RenderTarget];
+	auto& rts = m_dst_map[RenderTarget][bp >> 5];
 	for (auto it = rts.rbegin(); it != rts.rend(); ++it)  // Iterate targets from LRU to MRU.
 	{
 		Target* t = *it;
@@ -1226,7 +1230,7 @@ bool GSTextureCache::Move(u32 SBP, u32 SBW, u32 SPSM, int sx, int sy, u32 DBP, u
 
 GSTextureCache::Target* GSTextureCache::GetExactTarget(u32 BP, u32 BW, u32 PSM) const
 {
-	auto& rts = m_dst[GSLocalMemory::m_psm[PSM].depth ? DepthStencil : RenderTarget];
+	auto& rts = m_dst_map[GSLocalMemory::m_psm[PSM].depth ? DepthStencil : RenderTarget][BP >> 5];
 	for (auto it = rts.begin(); it != rts.end(); ++it) // Iterate targets from MRU to LRU.
 	{
 		Target* t = *it;
@@ -1239,7 +1243,7 @@ GSTextureCache::Target* GSTextureCache::GetExactTarget(u32 BP, u32 BW, u32 PSM)
 
 GSTextureCache::Target* GSTextureCache::GetTargetWithSharedBits(u32 BP, u32 PSM) const
 {
-	auto& rts = m_dst[GSLocalMemory::m_psm[PSM].depth ? DepthStencil : RenderTarget];
+	auto& rts = m_dst_map[GSLocalMemory::m_psm[PSM].depth ? DepthStencil : RenderTarget][BP >> 5];
 	for (auto it = rts.begin(); it != rts.end(); ++it) // Iterate targets from MRU to LRU.
 	{
 		Target* t = *it;
@@ -1290,23 +1294,24 @@ void GSTextureCache::InvalidateVideoMemSubTarget(GSTextureCache::Target* rt)
 	if (!rt)
 		return;
 
-	auto& list = m_dst[RenderTarget];
-
-	for (auto i = list.begin(); i != list.end();)
+	// Sub targets start strictly inside of rt.
+	const u32 end_page = std::min(rt->m_end_block, MAX_BP) >> 5;
+	for (u32 page = FindTargetPage(RenderTarget, rt->m_TEX0.TBP0 >> 5); page <= end_page; page = FindTargetPage(RenderTarget, page + 1))
 	{
-		Target* t = *i;
-
-		if ((t->m_TEX0.TBP0 > rt->m_TEX0.TBP0) && (t->m_end_block < rt->m_end_block) && (t->m_TEX0.TBW == rt->m_TEX0.TBW) && (t->m_TEX0.TBP0 < t->m_end_block))
-		{
-			GL_INS("InvalidateVideoMemSubTarget: rt 0x%x -> 0x%x, sub rt 0x%x -> 0x%x",
-				rt->m_TEX0.TBP0, rt->m_end_block, t->m_TEX0.TBP0, t->m_end_block);
-
-			i = list.erase(i);
-			delete t;
-		}
-		else
+		auto& list = m_dst_map[RenderTarget][page];
+		for (auto i = list.begin(); i != list.end();)
 		{
+			Target* t = *i;
 			++i;
+
+			if ((t->m_TEX0.TBP0 > rt->m_TEX0.TBP0) && (t->m_end_block < rt->m_end_block) && (t->m_TEX0.TBW == rt->m_TEX0.TBW) && (t->m_TEX0.TBP0 < t->m_end_block))
+			{
+				GL_INS("InvalidateVideoMemSubTarget: rt 0x%x -> 0x%x, sub rt 0x%x -> 0x%x",
+					rt->m_TEX0.TBP0, rt->m_end_block, t->m_TEX0.TBP0, t->m_end_block);
+
+				RemoveTarget(t);
+				delete t;
+			}
 		}
 	}
 }
@@ -1370,6 +1375,7 @@ void GSTextureCache::IncAge()
 		for (auto i = list.begin(); i != list.end();)
 		{
 			Target* t = *i;
+			++i;
 
 			// This variable is used to detect the texture shuffle effect. There is a high
 			// probability that game will do it on the current RT.
@@ -1383,17 +1389,13 @@ void GSTextureCache::IncAge()
 
 			if (++t->m_age > max_rt_age)
 			{
-				i = list.erase(i);
+				RemoveTarget(t);
 				GL_CACHE("TC: Remove Target(%s): %d (0x%x) due to age", to_string(type),
 					t->m_texture ? t->m_texture->GetID() : 0,
 					t->m_TEX0.TBP0);
 
 				delete t;
 			}
-			else
-			{
-				++i;
-			}
 		}
 	}
 
@@ -1915,11 +1917,71 @@ GSTextureCache::Target* GSTextureCache::CreateTarget(const GIFRegTEX0& TEX0, int
 
 	t->m_texture->SetScale(static_cast<GSRendererHW*>(g_gs_renderer.get())->GetTextureScaleFactor());
 
-	m_dst[type].push_front(t);
+	t->m_list_it = m_dst[type].InsertFront(t);
+	t->m_map_it = m_dst_map[type][t->m_TEX0.TBP0 >> 5].InsertFront(t);
+	m_dst_pages[type][t->m_TEX0.TBP0 >> 10] |= 1u << ((t->m_TEX0.TBP0 >> 5) & 31);
 
 	return t;
 }
 
+void GSTextureCache::MoveTargetFront(Target* t)
+{
+	m_dst[t->m_type].MoveFront(t->m_list_it);
+	m_dst_map[t->m_type][t->m_TEX0.TBP0 >> 5].MoveFront(t->m_map_it);
+}
+
+void GSTextureCache::RemoveTarget(Target* t)
+{
+	m_dst[t->m_type].EraseIndex(t->m_list_it);
+	const u32 page = t->m_TEX0.TBP0 >> 5;
+	m_dst_map[t->m_type][page].EraseIndex(t->m_map_it);
+	if (m_dst_map[t->m_type][page].empty())
+		m_dst_pages[t->m_type][page >> 5] &= ~(1u << (page & 31));
+}
+
+void GSTextureCache::RemoveTargets(int type)
+{
+	for (auto t : m_dst[type])
+		delete t;
+
+	m_dst[type].clear();
+	for (FastList<Target*>& list : m_dst_map[type])
+		list.clear();
+	memset(m_dst_pages[type], 0, sizeof(m_dst_pages[type]));
+	m_dst_max_span[type] = 0;
+	m_dst_wrap_end[type] = 0;
+}
+
+u32 GSTextureCache::FindTargetPage(int type, u32 page) const
+{
+	for (u32 word = page >> 5; word < std::size(m_dst_pages[type]); word++)
+	{
+		unsigned long mask = m_dst_pages[type][word];
+		if (word == (page >> 5))
+			mask &= ~0u << (page & 31);
+
+		unsigned long bit;
+		if (_BitScanForward(&bit, mask))
+			return word * 32 + bit;
+	}
+
+	return MAX_PAGES;
+}
+
+void GSTextureCache::UpdateTargetSpan(const Target* t)
+{
+	if (t->m_end_block >= t->m_TEX0.TBP0)
+	{
+		m_dst_max_span[t->m_type] = std::max(m_dst_max_span[t->m_type], t->m_end_block - t->m_TEX0.TBP0);
+	}
+	else
+	{
+		// Wrapped around, spans to the end of memory and continues from the start of it.
+		m_dst_max_span[t->m_type] = std::max(m_dst_max_span[t->m_type], MAX_BP - t->m_TEX0.TBP0);
+		m_dst_wrap_end[t->m_type] = std::max(m_dst_wrap_end[t->m_type], t->m_end_block + 1);
+	}
+}
+
 void GSTextureCache::Read(Target* t, const GSVector4i& r)
 {
 	if (!t->m_dirty.empty() || r.width() == 0 || r.height() == 0)
@@ -2552,6 +2614,7 @@ void GSTextureCache::Target::UpdateValidity(const GSVector4i& rect)
 	// at the moment, we blow the valid rect out to twice the size. The only thing stopping everything breaking is the fact
 	// that we clamp the draw rect to the target size in GSRendererHW::Draw().
 	m_end_block = GSLocalMemory::m_psm[m_TEX0.PSM].info.bn(m_valid.z - 1, m_valid.w - 1, m_TEX0.TBP0, m_TEX0.TBW); // Valid only for color formats
+	static_cast<GSRendererHW*>(g_gs_renderer.get())->GetTextureCache()->UpdateTargetSpan(this);
 
 	// GL_CACHE("UpdateValidity (0x%x->0x%x) from R:%d,%d Valid: %d,%d", m_TEX0.TBP0, m_end_block, rect.z, rect.w, m_valid.z, m_valid.w);
 }
@@ -196,6 +196,9 @@ public:
 		GSVector4i m_valid;
 		const bool m_depth_supported;
 		bool m_dirty_alpha;
+		// Keep GSTextureCache::m_dst and m_dst_map iterators to allow fast erase
+		u16 m_list_it = 0;
+		u16 m_map_it = 0;
 
 	public:
 		Target(const GIFRegTEX0& TEX0, const bool depth_supported, const int type);
@@ -300,6 +303,13 @@ protected:
 	std::unordered_map<HashCacheKey, HashCacheEntry, HashCacheKeyHash> m_hash_cache;
 	u64 m_hash_cache_memory_usage = 0;
 	FastList<Target*> m_dst[2];
+	// Same targets as m_dst, indexed by the page of their base pointer and kept in the same MRU order.
+	std::array<FastList<Target*>, MAX_PAGES> m_dst_map[2];
+	// Largest distance between a target base pointer and its end block, bounds the pages to search in m_dst_map.
+	u32 m_dst_max_span[2] = {};
+	// One past the last block that targets wrapping around the end of memory cover at its start, 0 when there are none.
+	u32 m_dst_wrap_end[2] = {};
+	u32 m_dst_pages[2][MAX_PAGES / 32] = {}; // bitmap of the pages with targets in m_dst_map
 	FastList<TargetHeightElem> m_target_heights;
 	static u8* m_temp;
 	constexpr static size_t S_SURFACE_OFFSET_CACHE_MAX_SIZE = std::numeric_limits<u16>::max();
@@ -309,6 +319,13 @@ protected:
 	Source* CreateSource(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, Target* t = NULL, bool half_right = false, int x_offset = 0, int y_offset = 0, const GSVector2i* lod = nullptr, const GSVector4i* src_range = nullptr);
 	Target* CreateTarget(const GIFRegTEX0& TEX0, int w, int h, int type, const bool clear);
 
+	void MoveTargetFront(Target* t);
+	void RemoveTarget(Target* t);
+	void RemoveTargets(int type);
+
+	/// Returns the first page at or after page with a target based in it, or MAX_PAGES.
+	u32 FindTargetPage(int type, u32 page) const;
+
 	/// Expands a target when the block pointer for a display framebuffer is within another target, but the read offset
 	/// plus the height is larger than the current size of the target.
 	void ScaleTargetForDisplay(Target* t, const GIFRegTEX0& dispfb, int real_h);
@@ -344,6 +361,9 @@ public:
 
 	u32 GetTargetHeight(u32 fbp, u32 fbw, u32 psm, u32 min_height);
 
+	/// Widens the target range searched by invalidations after the end block of a target moves.
+	void UpdateTargetSpan(const Target* t);
+
 	void InvalidateVideoMemType(int type, u32 bp);
 	void InvalidateVideoMemSubTarget(GSTextureCache::Target* rt);
 	void InvalidateVideoMem(const GSOffset& off, const GSVector4i& r, bool target = true);
@@ -1173,6 +1173,13 @@ GSRasterizerList::GSRasterizerList(int threads)
 
 GSRasterizerList::~GSRasterizerList()
 {
+	for (size_t i = 0; i < m_workers.size(); i++)
+	{
+		const GSWorker::Stats stats = m_workers[i]->GetStats();
+		DevCon.WriteLn("GS-SW-%u: %llu waits (%llu parked), %llu full pushes (%llu parked)", static_cast<u32>(i),
+			stats.worker_waits, stats.worker_parks, stats.push_spins, stats.push_parks);
+	}
+
 	PerformanceMetrics::SetGSSWThreadCount(0);
 	_aligned_free(m_scanline);
 }
@@ -76,7 +76,7 @@ void GSRendererSW::Destroy()
 	m_output = nullptr;
 }
 
-void GSRendererSW::VSync(u32 field, bool registers_written)
+void GSRendererSW::VSync(u32 field, bool registers_written, bool skip_present, bool rolled_back)
 {
 	Sync(0); // IncAge might delete a cached texture in use
 
@@ -113,7 +113,7 @@ void GSRendererSW::VSync(u32 field, bool registers_written)
 	//
 	*/
 
-	GSRenderer::VSync(field, registers_written);
+	GSRenderer::VSync(field, registers_written, skip_present, rolled_back);
 
 	m_tc->IncAge();
 
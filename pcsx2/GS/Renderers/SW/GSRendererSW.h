@@ -68,7 +68,7 @@ protected:
 	std::atomic<u16> m_tex_pages[512];
 
 	void Reset(bool hardware_reset) override;
-	void VSync(u32 field, bool registers_written) override;
+	void VSync(u32 field, bool registers_written, bool skip_present, bool rolled_back) override;
 	GSTexture* GetOutput(int i, int& y_offset) override;
 	GSTexture* GetFeedbackOutput() override;
 
@@ -445,6 +445,7 @@ RecTab::RecTab(wxWindow* parent)
 
 	record_grid_box->Add(res_box, wxSizerFlags().Expand());
 
+	m_ui.addComboBoxAndLabel(record_grid_box, "Format:", "capture_format", &theApp.m_gs_capture_format, -1, record_prereq);
 	m_ui.addSpinAndLabel(record_grid_box, "Saving Threads:",        "capture_threads",       1, 32, 4, -1, record_prereq);
 	m_ui.addSpinAndLabel(record_grid_box, "PNG Compression Level:", "png_compression_level", 1,  9, 1, -1, record_prereq);
 
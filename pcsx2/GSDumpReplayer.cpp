@@ -16,11 +16,13 @@
 #include "PrecompiledHeader.h"
 
 #include <atomic>
+#include <mutex>
 
 #include "fmt/core.h"
 
 #include "common/FileSystem.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
 #include "common/Timer.h"
 
 #include "imgui.h"
@@ -34,6 +36,7 @@
 #include "Gif_Unit.h"
 #include "GSDumpReplayer.h"
 #include "GS/GSLzma.h"
+#include "GS/GSPerfMon.h"
 #include "GS.h"
 #include "Host.h"
 #include "R3000A.h"
@@ -61,6 +64,18 @@ static bool s_needs_state_loaded = false;
 static u64 s_frame_ticks = 0;
 static u64 s_next_frame_time = 0;
 
+static bool s_is_dump_runner = false;
+static s32 s_loop_count = 0;
+static u32 s_current_loop = 0;
+
+static std::mutex s_frame_stats_mutex;
+static std::vector<GSDumpReplayer::FrameStats> s_frame_stats;
+
+// Only touched on the GS thread.
+static Threading::ThreadHandle s_gs_thread_handle;
+static u64 s_last_gs_wall_time = 0;
+static u64 s_last_gs_cpu_time = 0;
+
 R5900cpu GSDumpReplayerCpu = {
 	GSDumpReplayerCpuReserve,
 	GSDumpReplayerCpuShutdown,
@@ -74,6 +89,9 @@ R5900cpu GSDumpReplayerCpu = {
 	GSDumpReplayerCpuGetCacheReserve,
 	GSDumpReplayerCpuSetCacheReserve};
 
+// Dumps at least this big on disk are streamed rather than read into memory.
+static constexpr s64 STREAM_DUMP_SIZE_THRESHOLD = 64 * _1mb;
+
 static InterpVU0 gsDumpVU0;
 static InterpVU1 gsDumpVU1;
 
@@ -82,20 +100,59 @@ bool GSDumpReplayer::IsReplayingDump()
 	return static_cast<bool>(s_dump_file);
 }
 
+bool GSDumpReplayer::IsRunner()
+{
+	return s_is_dump_runner;
+}
+
+void GSDumpReplayer::SetIsDumpRunner(bool is_runner)
+{
+	s_is_dump_runner = is_runner;
+}
+
+void GSDumpReplayer::SetLoopCount(s32 loop_count)
+{
+	s_loop_count = loop_count;
+}
+
+s32 GSDumpReplayer::GetLoopCount()
+{
+	return s_loop_count;
+}
+
+std::vector<GSDumpReplayer::FrameStats> GSDumpReplayer::GetFrameStats()
+{
+	std::unique_lock lock(s_frame_stats_mutex);
+	return s_frame_stats;
+}
+
 bool GSDumpReplayer::Initialize(const char* filename)
 {
 	Common::Timer timer;
 	Console.WriteLn("(GSDumpReplayer) Reading file...");
 
+	// Big dumps are decoded as they play instead of being read up front, compressed dumps can
+	// expand to many times their size on disk.
+	const s64 file_size = FileSystem::GetPathFileSize(filename);
+	const bool stream = (file_size >= STREAM_DUMP_SIZE_THRESHOLD);
+
 	s_dump_file = GSDumpFile::OpenGSDump(filename);
-	if (!s_dump_file || !s_dump_file->ReadFile())
+	if (!s_dump_file || !(stream ? s_dump_file->OpenStream() : s_dump_file->ReadFile()))
 	{
 		Host::ReportFormattedErrorAsync("GSDumpReplayer", "Failed to open or read '%s'.", filename);
 		s_dump_file.reset();
 		return false;
 	}
 
-	Console.WriteLn("(GSDumpReplayer) Read file in %.2f ms.", timer.GetTimeMilliseconds());
+	if (stream)
+		Console.WriteLn("(GSDumpReplayer) Streaming %lld MB dump.", static_cast<long long>(file_size / _1mb));
+	else
+		Console.WriteLn("(GSDumpReplayer) Read file in %.2f ms.", timer.GetTimeMilliseconds());
+
+	{
+		std::unique_lock lock(s_frame_stats_mutex);
+		s_frame_stats.clear();
+	}
 
 	// We replace all CPUs.
 	Cpu = &GSDumpReplayerCpu;
@@ -158,9 +215,13 @@ void GSDumpReplayerCpuShutdown()
 
 void GSDumpReplayerCpuReset()
 {
+	if (s_dump_file && s_dump_file->IsStreaming() && s_current_packet != 0)
+		s_dump_file->SeekToFrame(0);
+
 	s_needs_state_loaded = true;
 	s_current_packet = 0;
 	s_dump_frame_number = 0;
+	s_current_loop = 0;
 }
 
 static void GSDumpReplayerLoadInitialState()
@@ -176,6 +237,44 @@ static void GSDumpReplayerLoadInitialState()
 	GetMTGS().Freeze(FreezeAction::Load, mfd);
 	if (mfd.retval != 0)
 		Host::ReportFormattedErrorAsync("GSDumpReplayer", "Failed to load GS state.");
+
+	// Start timing the first frame once the state has been uploaded, not before.
+	if (s_is_dump_runner)
+	{
+		GetMTGS().RunOnGSThread([]() {
+			s_gs_thread_handle = Threading::ThreadHandle::GetForCallingThread();
+			s_last_gs_wall_time = Common::Timer::GetCurrentValue();
+			s_last_gs_cpu_time = s_gs_thread_handle.GetCPUTime();
+		});
+	}
+}
+
+static void GSDumpReplayerRecordFrameStats(u32 loop, u32 frame)
+{
+	const u64 wall_time = Common::Timer::GetCurrentValue();
+	const u64 cpu_time = s_gs_thread_handle.GetCPUTime();
+
+	GSDumpReplayer::FrameStats stats = {};
+	stats.loop = loop;
+	stats.frame = frame;
+	stats.gs_wall_ms = Common::Timer::ConvertValueToMilliseconds(wall_time - s_last_gs_wall_time);
+	stats.gs_cpu_ms = static_cast<double>(cpu_time - s_last_gs_cpu_time) * 1000.0 /
+		static_cast<double>(Threading::GetThreadTicksPerSecond());
+	stats.draws = static_cast<u32>(g_perfmon.GetLastFrame(GSPerfMon::Draw));
+	stats.draw_calls = static_cast<u32>(g_perfmon.GetLastFrame(GSPerfMon::DrawCalls));
+	stats.prims = static_cast<u32>(g_perfmon.GetLastFrame(GSPerfMon::Prim));
+	stats.readbacks = static_cast<u32>(g_perfmon.GetLastFrame(GSPerfMon::Readbacks));
+	stats.barriers = static_cast<u32>(g_perfmon.GetLastFrame(GSPerfMon::Barriers));
+	stats.has_hash = GSGetCurrentFrameHash(&stats.hash);
+
+	{
+		std::unique_lock lock(s_frame_stats_mutex);
+		s_frame_stats.push_back(stats);
+	}
+
+	// Don't charge the readback for the hash to the next frame.
+	s_last_gs_wall_time = Common::Timer::GetCurrentValue();
+	s_last_gs_cpu_time = s_gs_thread_handle.GetCPUTime();
 }
 
 static void GSDumpReplayerSendPacketToMTGS(GIF_PATH path, const u8* data, u32 length)
@@ -205,7 +304,7 @@ static void GSDumpReplayerUpdateFrameLimit()
 
 static void GSDumpReplayerFrameLimit()
 {
-	if (s_frame_ticks == 0)
+	if (s_frame_ticks == 0 || s_is_dump_runner)
 		return;
 
 	// Frame limiter
@@ -219,6 +318,33 @@ static void GSDumpReplayerFrameLimit()
 	s_next_frame_time = std::max(now, s_next_frame_time + s_frame_ticks);
 }
 
+static bool GSDumpReplayerFinishLoop()
+{
+	s_current_packet = 0;
+	s_dump_frame_number = 0;
+	s_current_loop++;
+
+	if (s_loop_count > 0 && s_current_loop >= static_cast<u32>(s_loop_count))
+	{
+		Console.WriteLn("(GSDumpReplayer) Completed %u loop(s), shutting down.", s_current_loop);
+		s_dump_running = false;
+		Host::RequestVMShutdown(false, false);
+		return false;
+	}
+
+	return true;
+}
+
+static void GSDumpReplayerStopStream()
+{
+	if (s_dump_running)
+	{
+		Host::ReportFormattedErrorAsync("GSDumpReplayer", "Failed to read packets from dump.");
+		s_dump_running = false;
+		Host::RequestVMShutdown(false, false);
+	}
+}
+
 void GSDumpReplayerCpuStep()
 {
 	if (s_needs_state_loaded)
@@ -227,10 +353,32 @@ void GSDumpReplayerCpuStep()
 		s_needs_state_loaded = false;
 	}
 
-	const GSDumpFile::GSData& packet = s_dump_file->GetPackets()[s_current_packet];
-	s_current_packet = (s_current_packet + 1) % static_cast<u32>(s_dump_file->GetPackets().size());
-	if (s_current_packet == 0)
-		s_dump_frame_number = 0;
+	GSDumpFile::GSData packet;
+	if (s_dump_file->IsStreaming())
+	{
+		// The end of the stream is only known once we try to read past it.
+		if (!s_dump_file->GetNextPacket(&packet))
+		{
+			if (s_current_packet == 0 || !GSDumpReplayerFinishLoop())
+			{
+				GSDumpReplayerStopStream();
+				return;
+			}
+
+			if (!s_dump_file->SeekToFrame(0) || !s_dump_file->GetNextPacket(&packet))
+			{
+				GSDumpReplayerStopStream();
+				return;
+			}
+		}
+
+		s_current_packet++;
+	}
+	else
+	{
+		packet = s_dump_file->GetPackets()[s_current_packet];
+		s_current_packet = (s_current_packet + 1) % static_cast<u32>(s_dump_file->GetPackets().size());
+	}
 
 	switch (packet.id)
 	{
@@ -268,8 +416,15 @@ void GSDumpReplayerCpuStep()
 			GSDumpReplayerCpuCheckExecutionState();
 			GSDumpReplayerUpdateFrameLimit();
 			GSDumpReplayerFrameLimit();
-			GetMTGS().PostVsyncStart(false);
+			GetMTGS().PostVsyncStart(false, false, false);
 			VMManager::Internal::VSyncOnCPUThread();
+
+			if (s_is_dump_runner)
+			{
+				const u32 loop = s_current_loop;
+				const u32 frame = s_dump_frame_number;
+				GetMTGS().RunOnGSThread([loop, frame]() { GSDumpReplayerRecordFrameStats(loop, frame); });
+			}
 		}
 		break;
 
@@ -289,6 +444,9 @@ void GSDumpReplayerCpuStep()
 		}
 		break;
 	}
+
+	if (s_current_packet == 0 && !s_dump_file->IsStreaming())
+		GSDumpReplayerFinishLoop();
 }
 
 void GSDumpReplayerCpuExecute()
@@ -356,7 +514,10 @@ void GSDumpReplayer::RenderUI()
 	DRAW_LINE(font, text.c_str(), IM_COL32(255, 255, 255, 255));
 
 	text.clear();
-	fmt::format_to(std::back_inserter(text), "Packet Number: {}/{}", s_current_packet, static_cast<u32>(s_dump_file->GetPackets().size()));
+	if (s_dump_file->IsStreaming())
+		fmt::format_to(std::back_inserter(text), "Packet Number: {} (streaming)", s_current_packet);
+	else
+		fmt::format_to(std::back_inserter(text), "Packet Number: {}/{}", s_current_packet, static_cast<u32>(s_dump_file->GetPackets().size()));
 	DRAW_LINE(font, text.c_str(), IM_COL32(255, 255, 255, 255));
 
 #undef DRAW_LINE
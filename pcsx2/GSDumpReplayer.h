@@ -21,8 +21,35 @@
 
 namespace GSDumpReplayer
 {
+/// Statistics for a single presented frame, collected on the GS thread when running as a dump runner.
+struct FrameStats
+{
+	u32 loop;
+	u32 frame;
+	double gs_wall_ms;
+	double gs_cpu_ms;
+	u32 draws;
+	u32 draw_calls;
+	u32 prims;
+	u32 readbacks;
+	u32 barriers;
+	bool has_hash;
+	u64 hash;
+};
+
 bool IsReplayingDump();
 
+/// If set, the frame limiter is bypassed and per-frame statistics are collected for GetFrameStats().
+bool IsRunner();
+void SetIsDumpRunner(bool is_runner);
+
+/// Number of times the dump is played before the VM shuts down. Zero or less plays forever.
+void SetLoopCount(s32 loop_count);
+s32 GetLoopCount();
+
+/// Returns the statistics gathered so far. Only safe to call once the GS thread is idle.
+std::vector<FrameStats> GetFrameStats();
+
 bool Initialize(const char* filename);
 void Reset();
 void Shutdown();
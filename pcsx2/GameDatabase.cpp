@@ -21,6 +21,7 @@
 #include "vtlb.h"
 
 #include "common/FileSystem.h"
+#include "common/MappedFile.h"
 #include "common/Path.h"
 #include "common/StringUtil.h"
 #include "common/Timer.h"
@@ -30,6 +31,7 @@
 #include "ryml.hpp"
 #include "fmt/core.h"
 #include "fmt/ranges.h"
+#include <cstring>
 #include <fstream>
 #include <mutex>
 #include <optional>
@@ -45,12 +47,55 @@ namespace GameDatabase
 {
 	static void parseAndInsert(const std::string_view& serial, const c4::yml::NodeRef& node);
 	static void initDatabase();
+
+	static std::string getCacheFileName();
+	static u64 getCacheSchemaHash();
+	static bool openCache(std::time_t source_timestamp);
+	static void writeCache(std::time_t source_timestamp);
+	static const GameDatabaseSchema::GameEntry* decodeCacheEntry(const std::string& serial);
 } // namespace GameDatabase
 
 static constexpr char GAMEDB_YAML_FILE_NAME[] = "GameIndex.yaml";
+static constexpr char GAMEDB_CACHE_FILE_NAME[] = "gamedb.cache";
+
+enum : u32
+{
+	GAMEDB_CACHE_SIGNATURE = 0x43424447, // GDBC
+	GAMEDB_CACHE_VERSION = 1
+};
 
+// The compiled cache is a sorted serial index and a record blob, with all strings
+// stored once in a shared table. Only the record for a looked up serial is decoded.
+struct GameDatabaseCacheHeader
+{
+	u32 signature;
+	u32 version;
+	u64 schema_hash;
+	s64 source_timestamp;
+	u32 num_entries;
+	u32 index_offset;
+	u32 strings_offset;
+	u32 strings_size;
+	u32 records_offset;
+	u32 records_size;
+};
+static_assert(sizeof(GameDatabaseCacheHeader) == 48);
+
+struct GameDatabaseCacheIndexEntry
+{
+	u32 serial_offset;
+	u32 serial_length;
+	u32 record_offset;
+	u32 record_size;
+};
+static_assert(sizeof(GameDatabaseCacheIndexEntry) == 16);
+
+// Decoded entries. When the database comes from the YAML, every entry lives here,
+// otherwise entries are decoded from the cache the first time they are looked up.
 static std::unordered_map<std::string, GameDatabaseSchema::GameEntry> s_game_db;
 static std::once_flag s_load_once_flag;
+static std::mutex s_game_db_mutex;
+static MappedFile s_cache_file;
 
 std::string GameDatabaseSchema::GameEntry::memcardFiltersAsString() const
 {
@@ -672,6 +717,341 @@ u32 GameDatabaseSchema::GameEntry::applyGSHardwareFixes(Pcsx2Config::GSOptions&
 	return num_applied_fixes;
 }
 
+namespace
+{
+	class CacheRecordWriter
+	{
+	public:
+		void writeU8(u8 value) { m_records.push_back(value); }
+
+		void writeU32(u32 value)
+		{
+			const size_t pos = m_records.size();
+			m_records.resize(pos + sizeof(value));
+			std::memcpy(&m_records[pos], &value, sizeof(value));
+		}
+
+		void writeString(const std::string_view& str)
+		{
+			writeU32(addString(str));
+			writeU32(static_cast<u32>(str.size()));
+		}
+
+		u32 addString(const std::string_view& str)
+		{
+			auto it = m_string_offsets.find(std::string(str));
+			if (it != m_string_offsets.end())
+				return it->second;
+
+			const u32 offset = static_cast<u32>(m_strings.size());
+			m_strings.append(str);
+			m_string_offsets.emplace(str, offset);
+			return offset;
+		}
+
+		u32 getRecordOffset() const { return static_cast<u32>(m_records.size()); }
+		const std::vector<u8>& getRecords() const { return m_records; }
+		const std::string& getStrings() const { return m_strings; }
+
+	private:
+		std::vector<u8> m_records;
+		std::string m_strings;
+		std::unordered_map<std::string, u32> m_string_offsets;
+	};
+
+	class CacheRecordReader
+	{
+	public:
+		CacheRecordReader(const u8* record, u32 record_size, const char* strings, u32 strings_size)
+			: m_ptr(record)
+			, m_end(record + record_size)
+			, m_strings(strings)
+			, m_strings_size(strings_size)
+		{
+		}
+
+		bool readU8(u8* value)
+		{
+			if (m_ptr == m_end)
+				return false;
+
+			*value = *(m_ptr++);
+			return true;
+		}
+
+		bool readU32(u32* value)
+		{
+			if (static_cast<size_t>(m_end - m_ptr) < sizeof(*value))
+				return false;
+
+			std::memcpy(value, m_ptr, sizeof(*value));
+			m_ptr += sizeof(*value);
+			return true;
+		}
+
+		bool readString(std::string* str)
+		{
+			u32 offset, length;
+			if (!readU32(&offset) || !readU32(&length) || offset > m_strings_size || length > (m_strings_size - offset))
+				return false;
+
+			str->assign(m_strings + offset, length);
+			return true;
+		}
+
+	private:
+		const u8* m_ptr;
+		const u8* m_end;
+		const char* m_strings;
+		u32 m_strings_size;
+	};
+} // namespace
+
+std::string GameDatabase::getCacheFileName()
+{
+	return EmuFolders::Cache.empty() ? std::string() : Path::Combine(EmuFolders::Cache, GAMEDB_CACHE_FILE_NAME);
+}
+
+u64 GameDatabase::getCacheSchemaHash()
+{
+	// Fixes are stored by id, so a cache written by a build with different ids must not be used.
+	u64 hash = 0xcbf29ce484222325ULL;
+	const auto hash_string = [&hash](const char* str) {
+		for (; *str != '\0'; str++)
+			hash = (hash ^ static_cast<u8>(*str)) * 0x100000001b3ULL;
+		hash = (hash ^ 0xFF) * 0x100000001b3ULL;
+	};
+
+	for (GamefixId id = GamefixId_FIRST; id < pxEnumEnd; id++)
+		hash_string(EnumToString(id));
+	for (SpeedhackId id = SpeedhackId_FIRST; id < pxEnumEnd; id++)
+		hash_string(EnumToString(id));
+	for (const char* name : s_gs_hw_fix_names)
+		hash_string(name);
+
+	return hash;
+}
+
+bool GameDatabase::openCache(std::time_t source_timestamp)
+{
+	const std::string filename(getCacheFileName());
+	if (filename.empty() || !s_cache_file.Open(filename.c_str()))
+		return false;
+
+	const u8* data = s_cache_file.GetData();
+	const size_t size = s_cache_file.GetSize();
+	const GameDatabaseCacheHeader* header = reinterpret_cast<const GameDatabaseCacheHeader*>(data);
+	const auto range_valid = [size](u64 offset, u64 length) { return (offset <= size && length <= (size - offset)); };
+	if (size < sizeof(GameDatabaseCacheHeader) || header->signature != GAMEDB_CACHE_SIGNATURE ||
+		header->version != GAMEDB_CACHE_VERSION || header->schema_hash != getCacheSchemaHash() ||
+		header->source_timestamp != static_cast<s64>(source_timestamp) ||
+		(header->index_offset % alignof(GameDatabaseCacheIndexEntry)) != 0 ||
+		!range_valid(header->index_offset, static_cast<u64>(header->num_entries) * sizeof(GameDatabaseCacheIndexEntry)) ||
+		!range_valid(header->strings_offset, header->strings_size) ||
+		!range_valid(header->records_offset, header->records_size))
+	{
+		Console.Warning("[GameDB] Cache is out of date or invalid, rebuilding from YAML.");
+		s_cache_file.Close();
+		return false;
+	}
+
+	// Check the index up front, so lookups can trust it.
+	const GameDatabaseCacheIndexEntry* index = reinterpret_cast<const GameDatabaseCacheIndexEntry*>(data + header->index_offset);
+	for (u32 i = 0; i < header->num_entries; i++)
+	{
+		const GameDatabaseCacheIndexEntry& ie = index[i];
+		if (ie.serial_offset > header->strings_size || ie.serial_length > (header->strings_size - ie.serial_offset) ||
+			ie.record_offset > header->records_size || ie.record_size > (header->records_size - ie.record_offset))
+		{
+			Console.Warning("[GameDB] Cache index is corrupted, rebuilding from YAML.");
+			s_cache_file.Close();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void GameDatabase::writeCache(std::time_t source_timestamp)
+{
+	const std::string filename(getCacheFileName());
+	if (filename.empty() || s_game_db.empty())
+		return;
+
+	std::vector<const std::pair<const std::string, GameDatabaseSchema::GameEntry>*> sorted_entries;
+	sorted_entries.reserve(s_game_db.size());
+	for (const auto& it : s_game_db)
+		sorted_entries.push_back(&it);
+	std::sort(sorted_entries.begin(), sorted_entries.end(), [](const auto* lhs, const auto* rhs) { return lhs->first < rhs->first; });
+
+	CacheRecordWriter writer;
+	std::vector<GameDatabaseCacheIndexEntry> index;
+	index.reserve(sorted_entries.size());
+	for (const auto* it : sorted_entries)
+	{
+		const GameDatabaseSchema::GameEntry& entry = it->second;
+		GameDatabaseCacheIndexEntry& ie = index.emplace_back();
+		ie.serial_offset = writer.addString(it->first);
+		ie.serial_length = static_cast<u32>(it->first.size());
+		ie.record_offset = writer.getRecordOffset();
+
+		writer.writeU8(static_cast<u8>(entry.compat));
+		writer.writeU8(static_cast<u8>(entry.eeRoundMode));
+		writer.writeU8(static_cast<u8>(entry.vuRoundMode));
+		writer.writeU8(static_cast<u8>(entry.eeClampMode));
+		writer.writeU8(static_cast<u8>(entry.vuClampMode));
+		writer.writeString(entry.name);
+		writer.writeString(entry.region);
+
+		writer.writeU32(static_cast<u32>(entry.gameFixes.size()));
+		for (const GamefixId id : entry.gameFixes)
+			writer.writeU32(static_cast<u32>(id));
+
+		writer.writeU32(static_cast<u32>(entry.speedHacks.size()));
+		for (const auto& [id, value] : entry.speedHacks)
+		{
+			writer.writeU32(static_cast<u32>(id));
+			writer.writeU32(static_cast<u32>(value));
+		}
+
+		writer.writeU32(static_cast<u32>(entry.gsHWFixes.size()));
+		for (const auto& [id, value] : entry.gsHWFixes)
+		{
+			writer.writeU32(static_cast<u32>(id));
+			writer.writeU32(static_cast<u32>(value));
+		}
+
+		writer.writeU32(static_cast<u32>(entry.memcardFilters.size()));
+		for (const std::string& filter : entry.memcardFilters)
+			writer.writeString(filter);
+
+		writer.writeU32(static_cast<u32>(entry.patches.size()));
+		for (const auto& [crc, patch] : entry.patches)
+		{
+			writer.writeU32(crc);
+			writer.writeString(patch);
+		}
+
+		ie.record_size = writer.getRecordOffset() - ie.record_offset;
+	}
+
+	GameDatabaseCacheHeader header = {};
+	header.signature = GAMEDB_CACHE_SIGNATURE;
+	header.version = GAMEDB_CACHE_VERSION;
+	header.schema_hash = getCacheSchemaHash();
+	header.source_timestamp = static_cast<s64>(source_timestamp);
+	header.num_entries = static_cast<u32>(index.size());
+	header.index_offset = sizeof(header);
+	header.strings_offset = header.index_offset + static_cast<u32>(index.size() * sizeof(GameDatabaseCacheIndexEntry));
+	header.strings_size = static_cast<u32>(writer.getStrings().size());
+	header.records_offset = header.strings_offset + header.strings_size;
+	header.records_size = static_cast<u32>(writer.getRecords().size());
+
+	// Write to a temporary file first, so a partially-written cache is never picked up.
+	const std::string temp_filename(filename + ".tmp");
+	auto fp = FileSystem::OpenManagedCFile(temp_filename.c_str(), "wb");
+	if (!fp)
+	{
+		Console.Error("[GameDB] Failed to open '%s' for writing", temp_filename.c_str());
+		return;
+	}
+
+	const bool written = (std::fwrite(&header, sizeof(header), 1, fp.get()) == 1 &&
+						  std::fwrite(index.data(), sizeof(GameDatabaseCacheIndexEntry), index.size(), fp.get()) == index.size() &&
+						  std::fwrite(writer.getStrings().data(), writer.getStrings().size(), 1, fp.get()) == 1 &&
+						  std::fwrite(writer.getRecords().data(), writer.getRecords().size(), 1, fp.get()) == 1 &&
+						  std::fflush(fp.get()) == 0);
+	fp.reset();
+
+	if (!written || !FileSystem::RenamePath(temp_filename.c_str(), filename.c_str()))
+	{
+		Console.Error("[GameDB] Failed to write cache to '%s'", filename.c_str());
+		FileSystem::DeleteFilePath(temp_filename.c_str());
+		return;
+	}
+
+	Console.WriteLn("[GameDB] Wrote cache with %zu entries to '%s'", index.size(), filename.c_str());
+}
+
+const GameDatabaseSchema::GameEntry* GameDatabase::decodeCacheEntry(const std::string& serial)
+{
+	const u8* data = s_cache_file.GetData();
+	const GameDatabaseCacheHeader* header = reinterpret_cast<const GameDatabaseCacheHeader*>(data);
+	const GameDatabaseCacheIndexEntry* index_begin = reinterpret_cast<const GameDatabaseCacheIndexEntry*>(data + header->index_offset);
+	const GameDatabaseCacheIndexEntry* index_end = index_begin + header->num_entries;
+	const char* strings = reinterpret_cast<const char*>(data + header->strings_offset);
+	const auto serial_of = [strings](const GameDatabaseCacheIndexEntry& ie) { return std::string_view(strings + ie.serial_offset, ie.serial_length); };
+
+	const GameDatabaseCacheIndexEntry* ie = std::lower_bound(index_begin, index_end, serial,
+		[&serial_of](const GameDatabaseCacheIndexEntry& lhs, const std::string& rhs) { return serial_of(lhs) < rhs; });
+	if (ie == index_end || serial_of(*ie) != serial)
+		return nullptr;
+
+	CacheRecordReader reader(data + header->records_offset + ie->record_offset, ie->record_size, strings, header->strings_size);
+	GameDatabaseSchema::GameEntry entry;
+	bool okay = true;
+
+	u8 compat, ee_round, vu_round, ee_clamp, vu_clamp;
+	okay = okay && reader.readU8(&compat) && reader.readU8(&ee_round) && reader.readU8(&vu_round) &&
+		   reader.readU8(&ee_clamp) && reader.readU8(&vu_clamp);
+	okay = okay && reader.readString(&entry.name) && reader.readString(&entry.region);
+	entry.compat = static_cast<GameDatabaseSchema::Compatibility>(compat);
+	entry.eeRoundMode = static_cast<GameDatabaseSchema::RoundMode>(static_cast<s8>(ee_round));
+	entry.vuRoundMode = static_cast<GameDatabaseSchema::RoundMode>(static_cast<s8>(vu_round));
+	entry.eeClampMode = static_cast<GameDatabaseSchema::ClampMode>(static_cast<s8>(ee_clamp));
+	entry.vuClampMode = static_cast<GameDatabaseSchema::ClampMode>(static_cast<s8>(vu_clamp));
+
+	u32 count = 0;
+	okay = okay && reader.readU32(&count);
+	for (u32 i = 0; okay && i < count; i++)
+	{
+		u32 id;
+		okay = reader.readU32(&id) && id < GamefixId_COUNT;
+		if (okay)
+			entry.gameFixes.push_back(static_cast<GamefixId>(id));
+	}
+
+	okay = okay && reader.readU32(&count);
+	for (u32 i = 0; okay && i < count; i++)
+	{
+		u32 id, value;
+		okay = reader.readU32(&id) && reader.readU32(&value) && id < SpeedhackId_COUNT;
+		if (okay)
+			entry.speedHacks.emplace_back(static_cast<SpeedhackId>(id), static_cast<int>(value));
+	}
+
+	okay = okay && reader.readU32(&count);
+	for (u32 i = 0; okay && i < count; i++)
+	{
+		u32 id, value;
+		okay = reader.readU32(&id) && reader.readU32(&value) && id < static_cast<u32>(GameDatabaseSchema::GSHWFixId::Count);
+		if (okay)
+			entry.gsHWFixes.emplace_back(static_cast<GameDatabaseSchema::GSHWFixId>(id), static_cast<s32>(value));
+	}
+
+	okay = okay && reader.readU32(&count);
+	for (u32 i = 0; okay && i < count; i++)
+		okay = reader.readString(&entry.memcardFilters.emplace_back());
+
+	okay = okay && reader.readU32(&count);
+	for (u32 i = 0; okay && i < count; i++)
+	{
+		u32 crc;
+		std::string patch;
+		okay = reader.readU32(&crc) && reader.readString(&patch);
+		if (okay)
+			entry.patches.emplace(crc, std::move(patch));
+	}
+
+	if (!okay)
+	{
+		Console.Error(fmt::format("[GameDB] Corrupted cache record for '{}'", serial));
+		return nullptr;
+	}
+
+	return &s_game_db.emplace(serial, std::move(entry)).first->second;
+}
+
 void GameDatabase::initDatabase()
 {
 	ryml::Callbacks rymlCallbacks = ryml::get_callbacks();
@@ -727,8 +1107,19 @@ void GameDatabase::ensureLoaded()
 	std::call_once(s_load_once_flag, []() {
 		Common::Timer timer;
 		Console.WriteLn(fmt::format("[GameDB] Has not been initialized yet, initializing..."));
+
+		// Use the compiled cache unless the YAML has changed since it was written.
+		const std::time_t source_timestamp = Host::GetResourceFileTimestamp(GAMEDB_YAML_FILE_NAME).value_or(0);
+		if (openCache(source_timestamp))
+		{
+			Console.WriteLn("[GameDB] %u games on record (cache mapped in %.2fms)",
+				reinterpret_cast<const GameDatabaseCacheHeader*>(s_cache_file.GetData())->num_entries, timer.GetTimeMilliseconds());
+			return;
+		}
+
 		initDatabase();
 		Console.WriteLn("[GameDB] %zu games on record (loaded in %.2fms)", s_game_db.size(), timer.GetTimeMilliseconds());
+		writeCache(source_timestamp);
 	});
 }
 
@@ -738,6 +1129,8 @@ const GameDatabaseSchema::GameEntry* GameDatabase::findGame(const std::string_vi
 
 	std::string serialLower = StringUtil::toLower(serial);
 	Console.WriteLn(fmt::format("[GameDB] Searching for '{}' in GameDB", serialLower));
+
+	std::unique_lock lock(s_game_db_mutex);
 	const auto gameEntry = s_game_db.find(serialLower);
 	if (gameEntry != s_game_db.end())
 	{
@@ -745,6 +1138,15 @@ const GameDatabaseSchema::GameEntry* GameDatabase::findGame(const std::string_vi
 		return &gameEntry->second;
 	}
 
+	if (s_cache_file.IsOpen())
+	{
+		if (const GameDatabaseSchema::GameEntry* entry = decodeCacheEntry(serialLower))
+		{
+			Console.WriteLn(fmt::format("[GameDB] Found '{}' in GameDB", serialLower));
+			return entry;
+		}
+	}
+
 	Console.Error(fmt::format("[GameDB] Could not find '{}' in GameDB", serialLower));
 	return nullptr;
 }
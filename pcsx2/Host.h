@@ -17,6 +17,7 @@
 
 #include "common/Pcsx2Defs.h"
 
+#include <ctime>
 #include <string>
 #include <string_view>
 #include <optional>
@@ -51,6 +52,9 @@ namespace Host
 	/// Reads a resource file file from the resources directory as a string.
 	std::optional<std::string> ReadResourceFileToString(const char* filename);
 
+	/// Returns the modification timestamp of a resource file, if it exists.
+	std::optional<std::time_t> GetResourceFileTimestamp(const char* filename);
+
 	/// Adds OSD messages, duration is in seconds.
 	void AddOSDMessage(std::string message, float duration = 2.0f);
 	void AddKeyedOSDMessage(std::string key, std::string message, float duration = 2.0f);
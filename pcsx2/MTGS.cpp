@@ -193,10 +193,12 @@ struct RingCmdPacket_Vsync
 
 	// must be 16 byte aligned
 	u32 registers_written;
-	u32 pad[3];
+	u32 skip_present;
+	u32 rolled_back;
+	u32 pad[1];
 };
 
-void SysMtgsThread::PostVsyncStart(bool registers_written)
+void SysMtgsThread::PostVsyncStart(bool registers_written, bool skip_present, bool rolled_back)
 {
 	// Optimization note: Typically regset1 isn't needed.  The regs in that area are typically
 	// changed infrequently, usually during video mode changes.  However, on modern systems the
@@ -212,6 +214,8 @@ void SysMtgsThread::PostVsyncStart(bool registers_written)
 	remainder[1] = GSIMR._u32;
 	(GSRegSIGBLID&)remainder[2] = GSSIGLBLID;
 	remainder[4] = static_cast<u32>(registers_written);
+	remainder[5] = static_cast<u32>(skip_present);
+	remainder[6] = static_cast<u32>(rolled_back);
 	m_packet_writepos = (m_packet_writepos + 2) & RingBufferMask;
 
 	SendDataPacket();
@@ -461,7 +465,7 @@ void SysMtgsThread::MainLoop()
 							((GSRegSIGBLID&)RingBuffer.Regs[0x1080]) = (GSRegSIGBLID&)remainder[2];
 
 							// CSR & 0x2000; is the pageflip id.
-							GSvsync((((u32&)RingBuffer.Regs[0x1000]) & 0x2000) ? 0 : 1, remainder[4] != 0);
+							GSvsync((((u32&)RingBuffer.Regs[0x1000]) & 0x2000) ? 0 : 1, remainder[4] != 0, remainder[5] != 0, remainder[6] != 0);
 
 							m_QueuedFrameCount.fetch_sub(1);
 							if (m_VsyncSignalListener.exchange(false))
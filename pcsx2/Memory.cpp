@@ -48,15 +48,20 @@ BIOS
 
 #include "common/AlignedMalloc.h"
 #include "common/PageFaultSource.h"
+#include "DebugTools/Breakpoints.h"
 
 #ifdef PCSX2_CORE
 #include "GSDumpReplayer.h"
+#else
+#include "gui/SysThreads.h"
 #endif
 
 #ifdef ENABLECACHE
 #include "Cache.h"
 #endif
 
+#include <map>
+
 int MemMode = 0;		// 0 is Kernel Mode, 1 is Supervisor Mode, 2 is User Mode
 
 void memSetKernelMode() {
@@ -917,6 +922,29 @@ struct vtlb_PageProtectionInfo
 
 alignas(16) static vtlb_PageProtectionInfo m_PageProtectInfo[Ps2MemSize::MainRam >> 12];
 
+// MEMCHECK_READ / MEMCHECK_WRITE bits of the memchecks overlapping each ram page.
+// See the "Memcheck Page Guards" section below.
+alignas(16) static u8 m_PageWatchInfo[Ps2MemSize::MainRam >> 12];
+
+// Set for each ram page written since dirty tracking was (re)started.
+// See the "Dirty Page Tracking" section below.
+alignas(16) static u8 m_PageDirty[Ps2MemSize::MainRam >> 12];
+static bool m_DirtyTracking = false;
+
+// Host protection required by a ram page: read watches need all access trapped, while
+// write watches, counted code pages and clean tracked pages only need writes trapped.
+static __fi PageProtectionMode mmap_GetRamPageProtection( int rampage )
+{
+	if( m_PageWatchInfo[rampage] & MEMCHECK_READ )
+		return PageAccess_None();
+
+	if( (m_PageWatchInfo[rampage] & MEMCHECK_WRITE) || m_PageProtectInfo[rampage].Mode == ProtMode_Write ||
+		(m_DirtyTracking && !m_PageDirty[rampage]) )
+		return PageAccess_ReadOnly();
+
+	return PageAccess_ReadWrite();
+}
+
 
 // returns:
 //  ProtMode_NotRequired - unchecked block (resides in ROM, thus is integrity is constant)
@@ -963,7 +991,7 @@ void mmap_MarkCountedRamPage( u32 paddr )
 	);
 
 	m_PageProtectInfo[rampage].Mode = ProtMode_Write;
-	HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, PageAccess_ReadOnly() );
+	HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, mmap_GetRamPageProtection(rampage) );
 }
 
 // offset - offset of address relative to psM.
@@ -980,11 +1008,380 @@ static __fi void mmap_ClearCpuBlock( uint offset )
 	pxAssertMsg( m_PageProtectInfo[rampage].Mode != ProtMode_Manual,
 		"Attempted to clear a block that is already under manual protection." );
 
-	HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, PageAccess_ReadWrite() );
 	m_PageProtectInfo[rampage].Mode = ProtMode_Manual;
+	HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, mmap_GetRamPageProtection(rampage) );
 	Cpu->Clear( m_PageProtectInfo[rampage].ReverseRamMap, 0x400 );
 }
 
+// ===========================================================================================
+//  Memcheck Page Guards
+// ===========================================================================================
+// EE memchecks that lie entirely within main ram are not compiled into the recompiled code
+// (which would otherwise force every memory op into its own block, see isMemcheckNeeded).
+// Instead the host pages backing them are protected: read watches make the page
+// inaccessible, write watches make it read-only.  When a guarded page faults, the access is
+// matched against the memcheck ranges and recorded, the page is opened, and the faulting
+// instruction is single-stepped by the host before the page is re-protected.
+//
+// Only faults raised by the recompiler's direct ram accesses are matched (see
+// mmap_MarkRecAccess), since the host touches guarded pages for plenty of other reasons:
+// opcode fetches while compiling, block integrity checks, DMA transfers and so on.  Guest
+// accesses performed by C++ code (the interpreter, or the EE cache emulation) are checked
+// inline instead, see CBreakPoints::IsPageGuarded.
+//
+// While memchecks are guarded the recompiler flushes the guest state before every memory op
+// (see isMemcheckGuardNeeded), so a break can be taken right at the access: the fault handler
+// sends the EE thread to mmap_MemcheckBreak instead of retrying the access, leaving cpuRegs.pc
+// on the load/store (or on the branch, for an access in a delay slot) as the inline checks do.
+// Write-on-change watches can only tell once the store is done, so they break straight after
+// it instead.  Logging is left to the next EE event test, the fault handler can't print.
+
+struct mmap_MemcheckGuard
+{
+	u32 start;
+	u32 end;
+	u8 cond;
+	u8 result;
+};
+
+struct mmap_MemcheckHit
+{
+	u32 addr;
+	u32 pc;
+	bool write;
+};
+
+static constexpr size_t MemcheckGuardMax = 64;
+static constexpr size_t MemcheckHitMax = 16;
+
+// Written only while the EE is paused, and under the page fault mutex.
+static mmap_MemcheckGuard m_MemcheckGuards[MemcheckGuardMax];
+static size_t m_MemcheckGuardCount = 0;
+
+// Hits to log, filled by the fault handler (under the page fault mutex) and drained by the
+// EE event test.
+static mmap_MemcheckHit m_MemcheckHits[MemcheckHitMax];
+static std::atomic<u32> m_MemcheckHitCount{0};
+
+// Only accesses made from the EE thread are reported; the debugger's own memory views
+// read ram from other threads and must not trigger the memchecks they display.
+static thread_local bool s_memcheck_ee_thread = false;
+
+struct mmap_RecAccess
+{
+	uptr end;
+	u32 pc;
+	u8 bytes;
+	bool delay_slot;
+};
+
+// Host code ranges of the recompiler's direct ram accesses, keyed by their start address.
+// Only filled while memchecks are guarded, and only touched from the EE thread (both when
+// compiling and when faulting), so no locking is needed.  Cleared with the recompiler.
+static std::map<uptr, mmap_RecAccess> m_MemcheckRecAccesses;
+
+// Pages opened for the instruction currently being single-stepped on this thread.  A single
+// host instruction touches at most two pages for each of its (at most two) memory operands.
+static thread_local int s_memcheck_open_pages[4];
+static thread_local uint s_memcheck_open_count = 0;
+static thread_local bool s_memcheck_open_overflow = false;
+
+// Store being single-stepped through a write-on-change watch, compared once it's done.
+struct mmap_MemcheckChange
+{
+	u32 offset;
+	u32 bytes;
+	u32 pc;
+	bool delay_slot;
+	u8 result;
+	u8 old_value[16];
+};
+
+static thread_local mmap_MemcheckChange s_memcheck_change;
+static thread_local bool s_memcheck_change_pending = false;
+
+// Guest pc mmap_MemcheckBreak leaves the EE on.
+static u32 s_memcheck_break_pc = 0;
+
+static void mmap_RecordMemcheckHit( u32 addr, u32 pc, bool write )
+{
+	const u32 hit = m_MemcheckHitCount.load(std::memory_order_relaxed);
+	if( hit < MemcheckHitMax )
+	{
+		m_MemcheckHits[hit] = { addr, pc, write };
+		m_MemcheckHitCount.store(hit + 1, std::memory_order_release);
+	}
+	cpuSetEvent();
+}
+
+// Entered in place of a recompiled access (see SrcType_PageFault::RequestRedirect).  The
+// recompiler flushed everything but the pc before the access, so the EE can stop right here.
+static void mmap_MemcheckBreak()
+{
+	cpuRegs.pc = s_memcheck_break_pc;
+	CBreakPoints::SetBreakpointTriggered(true);
+#ifndef PCSX2_CORE
+	GetCoreThread().PauseSelfDebug();
+#endif
+	Cpu->ExitExecution();
+}
+
+// Returns true if a break at pc should be taken, false if the debugger just resumed from it.
+static bool mmap_ShouldMemcheckBreak( u32 pc )
+{
+	return CBreakPoints::CheckSkipFirst(BREAKPOINT_EE, pc) == 0;
+}
+
+static uptr mmap_MemcheckCloseStep()
+{
+	for( uint i = 0; i < s_memcheck_open_count; ++i )
+	{
+		const int rampage = s_memcheck_open_pages[i];
+		HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, mmap_GetRamPageProtection(rampage) );
+	}
+	s_memcheck_open_count = 0;
+
+	if( s_memcheck_open_overflow )
+	{
+		// Lost track of some of the opened pages, re-protect every guarded one.
+		for( int rampage = 0; rampage < (int)std::size(m_PageWatchInfo); ++rampage )
+		{
+			if( m_PageWatchInfo[rampage] )
+				HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, mmap_GetRamPageProtection(rampage) );
+		}
+		s_memcheck_open_overflow = false;
+	}
+
+	if( !s_memcheck_change_pending )
+		return 0;
+
+	s_memcheck_change_pending = false;
+	const mmap_MemcheckChange& change = s_memcheck_change;
+	if( std::memcmp( &eeMem->Main[change.offset], change.old_value, change.bytes ) == 0 )
+		return 0;
+
+	if( change.result & MEMCHECK_LOG )
+		mmap_RecordMemcheckHit( change.offset, change.pc, true );
+	if( !(change.result & MEMCHECK_BREAK) || !mmap_ShouldMemcheckBreak(change.pc) )
+		return 0;
+
+	// The store is done, stop on the instruction after it.  A store in a delay slot doesn't
+	// know where its branch goes, so that one stops on the branch and runs the (now
+	// unchanged) store again.
+	s_memcheck_break_pc = change.delay_slot ? change.pc : change.pc + 4;
+	return (uptr)mmap_MemcheckBreak;
+}
+
+// Registers [code, code_end) as recompiled code performing a direct ram access of the given
+// size.  guest_pc is where a break on it restarts from: the load/store itself, or its branch
+// when it sits in a delay slot.  Called by the recompiler while emitting, from the EE thread.
+void mmap_MarkRecAccess( const u8* code, const u8* code_end, u32 bytes, u32 guest_pc, bool delay_slot )
+{
+	if( !m_MemcheckGuardCount ) return;
+	m_MemcheckRecAccesses[(uptr)code] = { (uptr)code_end, guest_pc, (u8)bytes, delay_slot };
+}
+
+bool mmap_HasMemcheckGuards()
+{
+	return m_MemcheckGuardCount != 0;
+}
+
+// Returns the direct ram access performed by the recompiled instruction at host address
+// code, or nullptr if it isn't one.
+static const mmap_RecAccess* mmap_FindRecAccess( uptr code )
+{
+	auto it = m_MemcheckRecAccesses.upper_bound( code );
+	if( it == m_MemcheckRecAccesses.begin() ) return nullptr;
+	--it;
+	return (code < it->second.end) ? &it->second : nullptr;
+}
+
+// offset - offset of the faulting address relative to psM.
+// code   - host address of the faulting instruction, 0 if unknown.
+static void mmap_MemcheckFault( uint offset, bool write, uptr code )
+{
+	const int rampage = offset >> 12;
+
+	// Read-only pages only fault on writes, which covers hosts that don't report the
+	// access type.
+	if( !(m_PageWatchInfo[rampage] & MEMCHECK_READ) )
+		write = true;
+
+	// EE accesses are naturally aligned, so they never straddle pages and the faulting
+	// address is the start of the access.
+	const mmap_RecAccess* access = s_memcheck_ee_thread ? mmap_FindRecAccess( code ) : nullptr;
+	if( access )
+	{
+		bool brk = false;
+		for( size_t i = 0; i < m_MemcheckGuardCount; ++i )
+		{
+			const mmap_MemcheckGuard& guard = m_MemcheckGuards[i];
+			if( !(offset < guard.end && guard.start < offset + access->bytes) )
+				continue;
+
+			if( write && !(guard.cond & MEMCHECK_WRITE) )
+			{
+				if( !(guard.cond & MEMCHECK_WRITE_ONCHANGE) )
+					continue;
+
+				// Compared with the new value once the store has been stepped over.
+				if( !s_memcheck_change_pending )
+				{
+					s_memcheck_change = { (u32)offset, access->bytes, access->pc, access->delay_slot, 0, {} };
+					std::memcpy( s_memcheck_change.old_value, &eeMem->Main[offset], access->bytes );
+					s_memcheck_change_pending = true;
+				}
+				s_memcheck_change.result |= guard.result;
+				continue;
+			}
+
+			if( !(guard.cond & (write ? MEMCHECK_WRITE : MEMCHECK_READ)) )
+				continue;
+
+			if( guard.result & MEMCHECK_LOG )
+				mmap_RecordMemcheckHit( (u32)offset, access->pc, write );
+			if( guard.result & MEMCHECK_BREAK )
+				brk = true;
+		}
+
+		if( brk && mmap_ShouldMemcheckBreak(access->pc) )
+		{
+			// Leave the page guarded, the access runs (and skips this break) once the EE resumes.
+			s_memcheck_change_pending = false;
+			s_memcheck_break_pc = access->pc;
+			Source_PageFault->RequestRedirect( (uptr)mmap_MemcheckBreak );
+			return;
+		}
+	}
+
+	// Code living in a write-guarded page still needs its blocks invalidated.
+	if( write && m_PageProtectInfo[rampage].Mode == ProtMode_Write )
+		mmap_ClearCpuBlock( offset );
+
+	HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, PageAccess_ReadWrite() );
+	if( s_memcheck_open_count < std::size(s_memcheck_open_pages) )
+		s_memcheck_open_pages[s_memcheck_open_count++] = rampage;
+	else
+		s_memcheck_open_overflow = true;
+
+	Source_PageFault->RequestSingleStep( mmap_MemcheckCloseStep );
+}
+
+// Rebuilds the page guards from the current EE memchecks.  Must be called with the EE paused.
+void mmap_UpdateMemcheckProtection()
+{
+	std::unique_lock lock(PageFault_Mutex);
+
+	u8 watch[std::size(m_PageWatchInfo)] = {};
+	m_MemcheckGuardCount = 0;
+
+	for( const MemCheck& check : CBreakPoints::GetMemChecks() )
+	{
+		if( !CBreakPoints::IsPageGuarded(check) )
+			continue;
+
+		if( m_MemcheckGuardCount == MemcheckGuardMax )
+		{
+			Console.Warning( "(mmap) Too many main ram memchecks, some will be ignored." );
+			break;
+		}
+
+		const u32 start = standardizeBreakpointAddress(check.start);
+		const u32 end = standardizeBreakpointAddress(check.end - 1) + 1;
+
+		// Write-on-change watches still trap every write, the value is compared afterwards.
+		m_MemcheckGuards[m_MemcheckGuardCount++] = { start, end, (u8)check.cond, (u8)check.result };
+		const u8 page_cond = (check.cond & MEMCHECK_WRITE_ONCHANGE) ? (check.cond | MEMCHECK_WRITE) : check.cond;
+		for( u32 rampage = start >> 12; rampage <= (end - 1) >> 12; ++rampage )
+			watch[rampage] |= page_cond & MEMCHECK_READWRITE;
+	}
+
+	for( int rampage = 0; rampage < (int)std::size(m_PageWatchInfo); ++rampage )
+	{
+		if( watch[rampage] == m_PageWatchInfo[rampage] )
+			continue;
+
+		m_PageWatchInfo[rampage] = watch[rampage];
+		if( eeMem )
+			HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, mmap_GetRamPageProtection(rampage) );
+	}
+}
+
+// Logs the memchecks hit since the last call.  Called from the EE event test.
+void mmap_ProcessMemcheckHits()
+{
+	s_memcheck_ee_thread = true;
+
+	const u32 count = m_MemcheckHitCount.load(std::memory_order_acquire);
+	if( !count ) return;
+
+	std::unique_lock lock(PageFault_Mutex);
+
+	for( u32 i = 0; i < m_MemcheckHitCount.load(std::memory_order_relaxed); ++i )
+	{
+		const mmap_MemcheckHit& hit = m_MemcheckHits[i];
+		if( hit.write )
+			DevCon.WriteLn( "Hit store breakpoint @0x%x (pc 0x%x)", hit.addr, hit.pc );
+		else
+			DevCon.WriteLn( "Hit load breakpoint @0x%x (pc 0x%x)", hit.addr, hit.pc );
+	}
+
+	m_MemcheckHitCount.store(0, std::memory_order_relaxed);
+}
+
+// ===========================================================================================
+//  Dirty Page Tracking
+// ===========================================================================================
+// Incremental savestates only store the main ram pages written since the previous capture.
+// While tracking, clean pages are kept read-only; the first write to each one faults, marks
+// the page dirty and opens it again.  Resetting the block tracking (which happens whenever
+// ram is rewritten wholesale, e.g. when a state is loaded) stops tracking, so the next
+// capture has to take every page.
+
+// Marks every page clean and write-protects them.  Must be called with the EE paused.
+void mmap_StartDirtyTracking()
+{
+	std::unique_lock lock(PageFault_Mutex);
+
+	memzero( m_PageDirty );
+	m_DirtyTracking = true;
+	if( !eeMem ) return;
+
+	HostSys::MemProtect( eeMem->Main, Ps2MemSize::MainRam, PageAccess_ReadOnly() );
+	for( int rampage = 0; rampage < (int)std::size(m_PageWatchInfo); ++rampage )
+	{
+		if( m_PageWatchInfo[rampage] & MEMCHECK_READ )
+			HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, mmap_GetRamPageProtection(rampage) );
+	}
+}
+
+void mmap_StopDirtyTracking()
+{
+	std::unique_lock lock(PageFault_Mutex);
+
+	if( !m_DirtyTracking ) return;
+	m_DirtyTracking = false;
+	if( !eeMem ) return;
+
+	for( int rampage = 0; rampage < (int)std::size(m_PageDirty); ++rampage )
+	{
+		if( !m_PageDirty[rampage] )
+			HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, mmap_GetRamPageProtection(rampage) );
+	}
+}
+
+bool mmap_IsDirtyTracking()
+{
+	return m_DirtyTracking;
+}
+
+// Returns true if the page has been written since tracking started, or if nothing is being
+// tracked.  Must be called with the EE paused.
+bool mmap_IsRamPageDirty( u32 rampage )
+{
+	return !m_DirtyTracking || m_PageDirty[rampage];
+}
+
 void mmap_PageFaultHandler::OnPageFaultEvent( const PageFaultInfo& info, bool& handled )
 {
 	pxAssert( eeMem );
@@ -993,7 +1390,18 @@ void mmap_PageFaultHandler::OnPageFaultEvent( const PageFaultInfo& info, bool& h
 	uptr offset = info.addr - (uptr)eeMem->Main;
 	if( offset >= Ps2MemSize::MainRam ) return;
 
-	mmap_ClearCpuBlock( offset );
+	// Faults on pages without a read watch are always writes.  Reads of watched pages
+	// mark them too, which only costs an extra page in the next incremental state.
+	const int rampage = offset >> 12;
+	m_PageDirty[rampage] = 1;
+
+	if( m_PageWatchInfo[rampage] )
+		mmap_MemcheckFault( offset, info.write, info.pc );
+	else if( m_PageProtectInfo[rampage].Mode == ProtMode_Write )
+		mmap_ClearCpuBlock( offset );
+	else
+		HostSys::MemProtect( &eeMem->Main[rampage<<12], __pagesize, mmap_GetRamPageProtection(rampage) );
+
 	handled = true;
 }
 
@@ -1005,5 +1413,12 @@ void mmap_ResetBlockTracking()
 {
 	//DbgCon.WriteLn( "vtlb/mmap: Block Tracking reset..." );
 	memzero( m_PageProtectInfo );
+	m_DirtyTracking = false;
 	if (eeMem) HostSys::MemProtect( eeMem->Main, Ps2MemSize::MainRam, PageAccess_ReadWrite() );
+
+	// The recompiled accesses go with the recompiler.  Which memchecks can be guarded depends
+	// on the cpu settings, so rebuild the guards too (this also re-protects their pages).
+	m_MemcheckRecAccesses.clear();
+	memzero( m_PageWatchInfo );
+	mmap_UpdateMemcheckProtection();
 }
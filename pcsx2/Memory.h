@@ -127,6 +127,14 @@ enum vtlb_ProtectionMode
 extern vtlb_ProtectionMode mmap_GetRamPageInfo( u32 paddr );
 extern void mmap_MarkCountedRamPage( u32 paddr );
 extern void mmap_ResetBlockTracking();
+extern void mmap_UpdateMemcheckProtection();
+extern bool mmap_HasMemcheckGuards();
+extern void mmap_ProcessMemcheckHits();
+extern void mmap_MarkRecAccess( const u8* code, const u8* code_end, u32 bytes, u32 guest_pc, bool delay_slot );
+extern void mmap_StartDirtyTracking();
+extern void mmap_StopDirtyTracking();
+extern bool mmap_IsDirtyTracking();
+extern bool mmap_IsRamPageDirty( u32 rampage );
 
 #define memRead8 vtlb_memRead<mem8_t>
 #define memRead16 vtlb_memRead<mem16_t>
@@ -15,12 +15,20 @@
 
 #include "PrecompiledHeader.h"
 #include "common/FileSystem.h"
+#include "common/MappedFile.h"
 #include "common/SafeArray.inl"
 #include "common/Path.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
+#include "common/Timer.h"
 
 #include <array>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <zlib.h>
 
 #include "MemoryCardFile.h"
 #include "MemoryCardFolder.h"
@@ -160,22 +168,54 @@ static bool ConvertRAWtoNoECC(const char* file_in, const char* file_out)
 // --------------------------------------------------------------------------------------
 //  FileMemoryCard
 // --------------------------------------------------------------------------------------
-// Provides thread-safe direct file IO mapping.
+// Cards are mapped copy-on-write, so reads are served straight from memory and writes only
+// change the mapping.  The sectors written are flushed to the file by a background thread,
+// through a journal which is replayed if the flush didn't complete.
 //
 class FileMemoryCard
 {
 protected:
+	// Raw sector size (512 bytes of data and 16 of ECC), the unit dirty data is tracked and flushed in.
+	static constexpr u32 FLUSH_SECTOR_SIZE = 528;
+
+	// Writes usually come in bursts, this lets a whole burst go out in one flush.
+	static constexpr std::chrono::milliseconds FLUSH_DELAY{100};
+
+	// Sectors which failed to write back are retried after this long.
+	static constexpr std::chrono::milliseconds FLUSH_RETRY_DELAY{1000};
+
+	struct FlushStats
+	{
+		u64 sectors = 0;
+		u32 flushes = 0;
+		double total_time = 0.0;
+		double max_time = 0.0;
+	};
+
 	std::FILE* m_file[8];
 	std::string m_filenames[8];
+	std::string m_journal_filenames[8];
+	MappedFile m_image[8];
+	u32 m_offset[8];
 	u8 m_effeffs[528 * 16];
-	SafeArray<u8> m_currentdata;
 	u64 m_chksum[8];
 	bool m_ispsx[8];
 	u32 m_chkaddr;
 
+	// Dirty sector flags are written by the emulation thread and taken by the flush thread, and
+	// the mapping is only modified or copied from with the mutex held.
+	std::mutex m_flush_mutex;
+	std::condition_variable m_flush_cv;
+	std::thread m_flush_thread;
+	std::vector<u8> m_dirty_sectors[8];
+	bool m_flush_pending = false;
+	bool m_flush_retry = false;
+	bool m_flush_thread_exit = false;
+	FlushStats m_flush_stats[8];
+
 public:
 	FileMemoryCard();
-	virtual ~FileMemoryCard() = default;
+	virtual ~FileMemoryCard();
 
 	void Lock();
 	void Unlock();
@@ -192,8 +232,17 @@ public:
 	u64 GetCRC(uint slot);
 
 protected:
-	bool Seek(std::FILE* f, u32 adr);
+	u32 GetDataOffset(std::FILE* f);
 	bool Create(const char* mcdFile, uint sizeInMB);
+	u8* GetCardData(uint slot, u32 adr, int size);
+	void MarkDirty(uint slot, u32 offset, u32 size);
+
+	void StartFlushThread();
+	void StopFlushThread();
+	void FlushThreadEntryPoint();
+	bool WriteBack(uint slot, const std::vector<std::pair<u32, u32>>& sectors, const std::vector<u8>& data);
+	bool WriteJournal(uint slot, const std::vector<std::pair<u32, u32>>& sectors, const std::vector<u8>& data);
+	void ReplayJournal(uint slot);
 };
 
 uint FileMcd_GetMtapPort(uint slot)
@@ -264,12 +313,30 @@ std::string FileMcd_GetDefaultName(uint slot)
 		return StringUtil::StdStringFromFormat("Mcd%03u.ps2", slot + 1);
 }
 
+// Journals hold a header, then each sector as its file offset, size and data, then a crc32 of
+// everything before it.  Only complete journals (with a matching crc) are replayed.
+struct FileMcdJournalHeader
+{
+	u32 magic;
+	u32 version;
+	u32 count;
+	u32 reserved;
+};
+
+static constexpr u32 FILEMCD_JOURNAL_MAGIC = 0x4C4A434D; // MCJL
+static constexpr u32 FILEMCD_JOURNAL_VERSION = 1;
+
 FileMemoryCard::FileMemoryCard()
 {
 	memset8<0xff>(m_effeffs);
 	m_chkaddr = 0;
 }
 
+FileMemoryCard::~FileMemoryCard()
+{
+	StopFlushThread();
+}
+
 void FileMemoryCard::Open()
 {
 	for (int slot = 0; slot < 8; ++slot)
@@ -331,22 +398,31 @@ void FileMemoryCard::Open()
 		FileSystem::SetPathCompression(fname.c_str(), EmuConfig.McdCompressNTFS);
 #endif
 
+		// the file which is actually mapped and written
+		std::string image_name(fname);
 		if (StringUtil::EndsWith(fname, ".bin"))
 		{
-			std::string newname(fname + "x");
-			if (!ConvertNoECCtoRAW(fname.c_str(), newname.c_str()))
+			image_name += 'x';
+			if (!ConvertNoECCtoRAW(fname.c_str(), image_name.c_str()))
 			{
 				Console.Error("Could convert memory card: %s", fname.c_str());
-				FileSystem::DeleteFilePath(newname.c_str());
+				FileSystem::DeleteFilePath(image_name.c_str());
 				continue;
 			}
-
-			// store the original filename
-			m_file[slot] = FileSystem::OpenSharedCFile(newname.c_str(), "r+b", FileSystem::FileShareMode::DenyWrite);
 		}
-		else
+
+		m_file[slot] = FileSystem::OpenSharedCFile(image_name.c_str(), "r+b", FileSystem::FileShareMode::DenyWrite);
+		if (m_file[slot])
 		{
-			m_file[slot] = FileSystem::OpenSharedCFile(fname.c_str(), "r+b", FileSystem::FileShareMode::DenyWrite);
+			m_journal_filenames[slot] = image_name + ".journal";
+			ReplayJournal(slot);
+
+			if (!m_image[slot].Open(image_name.c_str(), true))
+			{
+				Console.Error("(FileMcd) Failed to map memory card: %s", image_name.c_str());
+				std::fclose(m_file[slot]);
+				m_file[slot] = nullptr;
+			}
 		}
 
 		if (!m_file[slot])
@@ -360,22 +436,40 @@ void FileMemoryCard::Open()
 		else // Load checksum
 		{
 			m_filenames[slot] = std::move(fname);
-			m_ispsx[slot] = FileSystem::FSize64(m_file[slot]) == 0x20000;
+			m_ispsx[slot] = m_image[slot].GetSize() == 0x20000;
+			m_offset[slot] = GetDataOffset(m_file[slot]);
 			m_chkaddr = 0x210;
+			m_dirty_sectors[slot].assign((m_image[slot].GetSize() + FLUSH_SECTOR_SIZE - 1) / FLUSH_SECTOR_SIZE, 0);
+			m_flush_stats[slot] = {};
 
-			if (!m_ispsx[slot] && FileSystem::FSeek64(m_file[slot], m_chkaddr, SEEK_SET) == 0)
-				std::fread(&m_chksum[slot], sizeof(m_chksum[slot]), 1, m_file[slot]);
+			if (!m_ispsx[slot] && m_image[slot].GetSize() >= m_chkaddr + sizeof(m_chksum[slot]))
+				std::memcpy(&m_chksum[slot], m_image[slot].GetData() + m_chkaddr, sizeof(m_chksum[slot]));
+
+			StartFlushThread();
 		}
 	}
 }
 
 void FileMemoryCard::Close()
 {
+	// writes out everything still pending
+	StopFlushThread();
+
 	for (int slot = 0; slot < 8; ++slot)
 	{
 		if (!m_file[slot])
 			continue;
 
+		const FlushStats& stats = m_flush_stats[slot];
+		if (stats.flushes > 0)
+		{
+			Console.WriteLn("(FileMcd) Slot %d: %llu sectors written back in %u flushes, %.2f ms average, %.2f ms worst.",
+				slot, stats.sectors, stats.flushes, stats.total_time / stats.flushes, stats.max_time);
+		}
+
+		m_image[slot].Close();
+		m_dirty_sectors[slot] = {};
+
 		// Store checksum
 		if (!m_ispsx[slot] && FileSystem::FSeek64(m_file[slot], m_chkaddr, SEEK_SET) == 0)
 			std::fwrite(&m_chksum[slot], sizeof(m_chksum[slot]), 1, m_file[slot]);
@@ -391,11 +485,12 @@ void FileMemoryCard::Close()
 		}
 
 		m_filenames[slot] = {};
+		m_journal_filenames[slot] = {};
 	}
 }
 
-// Returns FALSE if the seek failed (is outside the bounds of the file).
-bool FileMemoryCard::Seek(std::FILE* f, u32 adr)
+// Returns the number of header bytes in front of the card data.
+u32 FileMemoryCard::GetDataOffset(std::FILE* f)
 {
 	const s64 size = FileSystem::FSize64(f);
 
@@ -414,7 +509,7 @@ bool FileMemoryCard::Seek(std::FILE* f, u32 adr)
 		// perform sanity checks here?
 	}
 
-	return (FileSystem::FSeek64(f, adr + offset, SEEK_SET) == 0);
+	return offset;
 }
 
 // returns FALSE if an error occurred (either permission denied or disk full)
@@ -436,6 +531,31 @@ bool FileMemoryCard::Create(const char* mcdFile, uint sizeInMB)
 	return true;
 }
 
+// Returns null if the range lies outside the card.
+u8* FileMemoryCard::GetCardData(uint slot, u32 adr, int size)
+{
+	const u64 offset = static_cast<u64>(m_offset[slot]) + adr;
+	if (size < 0 || (offset + static_cast<u64>(size)) > m_image[slot].GetSize())
+		return nullptr;
+
+	return m_image[slot].GetMutableData() + offset;
+}
+
+// Must be called with the flush mutex held.
+void FileMemoryCard::MarkDirty(uint slot, u32 offset, u32 size)
+{
+	if (size == 0)
+		return;
+
+	std::vector<u8>& dirty = m_dirty_sectors[slot];
+	const u32 last = (offset + size - 1) / FLUSH_SECTOR_SIZE;
+	for (u32 sector = offset / FLUSH_SECTOR_SIZE; sector <= last; sector++)
+		dirty[sector] = 1;
+
+	m_flush_pending = true;
+	m_flush_cv.notify_one();
+}
+
 s32 FileMemoryCard::IsPresent(uint slot)
 {
 	return m_file[slot] != nullptr;
@@ -448,7 +568,7 @@ void FileMemoryCard::GetSizeInfo(uint slot, McdSizeInfo& outways)
 	outways.Xor = 18;                     // 0x12, XOR 02 00 00 10
 
 	if (pxAssert(m_file[slot]))
-		outways.McdSizeInSectors = static_cast<u32>(FileSystem::FSize64(m_file[slot])) / (outways.SectorSize + outways.EraseBlockSizeInSectors);
+		outways.McdSizeInSectors = static_cast<u32>(m_image[slot].GetSize()) / (outways.SectorSize + outways.EraseBlockSizeInSectors);
 	else
 		outways.McdSizeInSectors = 0x4000;
 
@@ -463,124 +583,121 @@ bool FileMemoryCard::IsPSX(uint slot)
 
 s32 FileMemoryCard::Read(uint slot, u8* dest, u32 adr, int size)
 {
-	std::FILE* mcfp = m_file[slot];
-	if (!mcfp)
+	if (!m_file[slot])
 	{
 		DevCon.Error("(FileMcd) Ignoring attempted read from disabled slot.");
 		memset(dest, 0, size);
 		return 1;
 	}
-	if (!Seek(mcfp, adr))
+
+	// Only this thread modifies the mapping, so reading it needs no lock.
+	const u8* data = GetCardData(slot, adr, size);
+	if (!data)
 		return 0;
-	return std::fread(dest, size, 1, mcfp) == 1;
+
+	std::memcpy(dest, data, size);
+	return 1;
 }
 
 s32 FileMemoryCard::Save(uint slot, const u8* src, u32 adr, int size)
 {
-	std::FILE* mcfp = m_file[slot];
-
-	if (!mcfp)
+	if (!m_file[slot])
 	{
 		DevCon.Error("(FileMcd) Ignoring attempted save/write to disabled slot.");
 		return 1;
 	}
 
-	if (m_ispsx[slot])
-	{
-		m_currentdata.MakeRoomFor(size);
-		for (int i = 0; i < size; i++)
-			m_currentdata[i] = src[i];
-	}
-	else
-	{
-		if (!Seek(mcfp, adr))
-			return 0;
-		m_currentdata.MakeRoomFor(size);
-		std::fread(m_currentdata.GetPtr(), size, 1, mcfp);
+	u8* data = GetCardData(slot, adr, size);
+	if (!data)
+		return 0;
 
+	{
+		std::unique_lock lock(m_flush_mutex);
 
-		for (int i = 0; i < size; i++)
+		if (m_ispsx[slot])
 		{
-			if ((m_currentdata[i] & src[i]) != src[i])
-				Console.Warning("(FileMcd) Warning: writing to uncleared data. (%d) [%08X]", slot, adr);
-			m_currentdata[i] &= src[i];
+			std::memcpy(data, src, size);
 		}
-
-		// Checksumness
+		else
 		{
-			if (adr == m_chkaddr)
-				Console.Warning("(FileMcd) Warning: checksum sector overwritten. (%d)", slot);
+			for (int i = 0; i < size; i++)
+			{
+				if ((data[i] & src[i]) != src[i])
+					Console.Warning("(FileMcd) Warning: writing to uncleared data. (%d) [%08X]", slot, adr);
+				data[i] &= src[i];
+			}
 
-			u64* pdata = (u64*)&m_currentdata[0];
-			u32 loops = size / 8;
+			// Checksumness
+			{
+				if (adr == m_chkaddr)
+					Console.Warning("(FileMcd) Warning: checksum sector overwritten. (%d)", slot);
 
-			for (u32 i = 0; i < loops; i++)
-				m_chksum[slot] ^= pdata[i];
+				const u32 loops = size / 8;
+				for (u32 i = 0; i < loops; i++)
+				{
+					u64 value;
+					std::memcpy(&value, data + i * 8, sizeof(value));
+					m_chksum[slot] ^= value;
+				}
+			}
 		}
+
+		MarkDirty(slot, m_offset[slot] + adr, size);
 	}
 
-	if (!Seek(mcfp, adr))
-		return 0;
+	static auto last = std::chrono::time_point<std::chrono::system_clock>();
 
-	if (std::fwrite(m_currentdata.GetPtr(), size, 1, mcfp) == 1)
+	std::chrono::duration<float> elapsed = std::chrono::system_clock::now() - last;
+	if (elapsed > std::chrono::seconds(5))
 	{
-		static auto last = std::chrono::time_point<std::chrono::system_clock>();
-
-		std::chrono::duration<float> elapsed = std::chrono::system_clock::now() - last;
-		if (elapsed > std::chrono::seconds(5))
-		{
-			const std::string_view filename(Path::GetFileName(m_filenames[slot]));
-			Host::AddKeyedFormattedOSDMessage(StringUtil::StdStringFromFormat("MemoryCardSave%u", slot), 10.0f,
-				"Memory Card %.*s written.", static_cast<int>(filename.size()), static_cast<const char*>(filename.data()));
-			last = std::chrono::system_clock::now();
-		}
-		return 1;
+		const std::string_view filename(Path::GetFileName(m_filenames[slot]));
+		Host::AddKeyedFormattedOSDMessage(StringUtil::StdStringFromFormat("MemoryCardSave%u", slot), 10.0f,
+			"Memory Card %.*s written.", static_cast<int>(filename.size()), static_cast<const char*>(filename.data()));
+		last = std::chrono::system_clock::now();
 	}
 
-	return 0;
+	return 1;
 }
 
 s32 FileMemoryCard::EraseBlock(uint slot, u32 adr)
 {
-	std::FILE* mcfp = m_file[slot];
-	if (!mcfp)
+	if (!m_file[slot])
 	{
 		DevCon.Error("MemoryCard: Ignoring erase for disabled slot.");
 		return 1;
 	}
 
-	if (!Seek(mcfp, adr))
+	u8* data = GetCardData(slot, adr, sizeof(m_effeffs));
+	if (!data)
 		return 0;
-	return std::fwrite(m_effeffs, sizeof(m_effeffs), 1, mcfp) == 1;
+
+	std::unique_lock lock(m_flush_mutex);
+	std::memcpy(data, m_effeffs, sizeof(m_effeffs));
+	MarkDirty(slot, m_offset[slot] + adr, sizeof(m_effeffs));
+	return 1;
 }
 
 u64 FileMemoryCard::GetCRC(uint slot)
 {
-	std::FILE* mcfp = m_file[slot];
-	if (!mcfp)
+	if (!m_file[slot])
 		return 0;
 
 	u64 retval = 0;
 
 	if (m_ispsx[slot])
 	{
-		if (!Seek(mcfp, 0))
-			return 0;
+		// Process the card in 4k chunks, use 528 (sector size), ensures even divisibility.
+		u64 buffer[528 * 8];
 
-		const s64 mcfpsize = FileSystem::FSize64(mcfp);
-		if (mcfpsize < 0)
+		const size_t filesize = m_image[slot].GetSize();
+		const uint chunks = static_cast<uint>(filesize / sizeof(buffer));
+		if (m_offset[slot] + static_cast<size_t>(chunks) * sizeof(buffer) > filesize)
 			return 0;
 
-		// Process the file in 4k chunks.  Speeds things up significantly.
-
-		u64 buffer[528 * 8]; // use 528 (sector size), ensures even divisibility
-
-		const uint filesize = static_cast<uint>(mcfpsize) / sizeof(buffer);
-		for (uint i = filesize; i; --i)
+		const u8* data = m_image[slot].GetData() + m_offset[slot];
+		for (uint i = 0; i < chunks; i++, data += sizeof(buffer))
 		{
-			if (std::fread(buffer, sizeof(buffer), 1, mcfp) != 1)
-				return 0;
-
+			std::memcpy(buffer, data, sizeof(buffer));
 			for (uint t = 0; t < std::size(buffer); ++t)
 				retval ^= buffer[t];
 		}
@@ -593,6 +710,230 @@ u64 FileMemoryCard::GetCRC(uint slot)
 	return retval;
 }
 
+void FileMemoryCard::StartFlushThread()
+{
+	if (m_flush_thread.joinable())
+		return;
+
+	m_flush_pending = false;
+	m_flush_retry = false;
+	m_flush_thread_exit = false;
+	m_flush_thread = std::thread(&FileMemoryCard::FlushThreadEntryPoint, this);
+}
+
+void FileMemoryCard::StopFlushThread()
+{
+	if (!m_flush_thread.joinable())
+		return;
+
+	{
+		std::unique_lock lock(m_flush_mutex);
+		m_flush_thread_exit = true;
+		m_flush_cv.notify_one();
+	}
+
+	m_flush_thread.join();
+}
+
+void FileMemoryCard::FlushThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("Memory Card Flush");
+
+	std::vector<std::pair<u32, u32>> sectors[8];
+	std::vector<u8> data[8];
+
+	std::unique_lock lock(m_flush_mutex);
+	for (;;)
+	{
+		m_flush_cv.wait(lock, [this]() { return (m_flush_pending || m_flush_thread_exit); });
+		if (!m_flush_pending)
+			break;
+
+		if (!m_flush_thread_exit)
+			m_flush_cv.wait_for(lock, m_flush_retry ? FLUSH_RETRY_DELAY : FLUSH_DELAY, [this]() { return m_flush_thread_exit; });
+
+		// Copy the dirty sectors out, so the emulation thread can carry on writing while they're flushed.
+		for (uint slot = 0; slot < 8; slot++)
+		{
+			sectors[slot].clear();
+			data[slot].clear();
+
+			std::vector<u8>& dirty = m_dirty_sectors[slot];
+			const u8* image = m_image[slot].GetData();
+			const u32 image_size = static_cast<u32>(m_image[slot].GetSize());
+			for (u32 sector = 0; sector < static_cast<u32>(dirty.size()); sector++)
+			{
+				if (!dirty[sector])
+					continue;
+
+				dirty[sector] = 0;
+				const u32 offset = sector * FLUSH_SECTOR_SIZE;
+				const u32 size = std::min(FLUSH_SECTOR_SIZE, image_size - offset);
+				sectors[slot].emplace_back(offset, size);
+				data[slot].insert(data[slot].end(), image + offset, image + offset + size);
+			}
+		}
+		m_flush_pending = false;
+
+		lock.unlock();
+		bool failed[8] = {};
+		for (uint slot = 0; slot < 8; slot++)
+		{
+			if (!sectors[slot].empty())
+				failed[slot] = !WriteBack(slot, sectors[slot], data[slot]);
+		}
+		lock.lock();
+
+		// Failed sectors go back on the dirty list, and are retried along with anything written since.
+		// Their journal stays on disk until then, so it can still be replayed if we never get there.
+		m_flush_retry = false;
+		for (uint slot = 0; slot < 8; slot++)
+		{
+			if (!failed[slot])
+				continue;
+
+			if (m_flush_thread_exit)
+			{
+				Console.Error("(FileMcd) Giving up on writing back %zu sectors to memory card in slot %u.", sectors[slot].size(), slot);
+				continue;
+			}
+
+			for (const auto& [offset, size] : sectors[slot])
+				m_dirty_sectors[slot][offset / FLUSH_SECTOR_SIZE] = 1;
+
+			m_flush_pending = true;
+			m_flush_retry = true;
+		}
+	}
+}
+
+bool FileMemoryCard::WriteBack(uint slot, const std::vector<std::pair<u32, u32>>& sectors, const std::vector<u8>& data)
+{
+	Common::Timer timer;
+
+	// Without a journal a crash part way through can still tear the card, but that beats not saving at all.
+	const bool journaled = WriteJournal(slot, sectors, data);
+
+	std::FILE* fp = m_file[slot];
+	bool result = true;
+	const u8* src = data.data();
+	for (const auto& [offset, size] : sectors)
+	{
+		result = result && FileSystem::FSeek64(fp, offset, SEEK_SET) == 0 && std::fwrite(src, size, 1, fp) == 1;
+		src += size;
+	}
+	result = result && FileSystem::FSync(fp);
+
+	if (!result)
+	{
+		Console.Error("(FileMcd) Failed to write back %zu sectors to memory card in slot %u.", sectors.size(), slot);
+		const std::string_view filename(Path::GetFileName(m_filenames[slot]));
+		Host::AddKeyedFormattedOSDMessage(StringUtil::StdStringFromFormat("MemoryCardFlush%u", slot), 10.0f,
+			"Failed to write to memory card %.*s.", static_cast<int>(filename.size()), filename.data());
+		return false;
+	}
+
+	// The card holds everything the journal does now.
+	if (journaled)
+		FileSystem::DeleteFilePath(m_journal_filenames[slot].c_str());
+
+	const double time = timer.GetTimeMilliseconds();
+	FlushStats& stats = m_flush_stats[slot];
+	stats.sectors += sectors.size();
+	stats.flushes++;
+	stats.total_time += time;
+	stats.max_time = std::max(stats.max_time, time);
+	DevCon.WriteLn("(FileMcd) Slot %u: Wrote back %zu sectors in %.2f ms.", slot, sectors.size(), time);
+	return true;
+}
+
+// The journal is written next to the old one and then renamed over it, so the previous journal
+// (which may cover sectors that failed to write back) is only replaced by a complete one.
+bool FileMemoryCard::WriteJournal(uint slot, const std::vector<std::pair<u32, u32>>& sectors, const std::vector<u8>& data)
+{
+	const std::string temp_filename(m_journal_filenames[slot] + ".tmp");
+	auto fp = FileSystem::OpenManagedCFile(temp_filename.c_str(), "wb");
+	if (!fp)
+	{
+		Console.Error("(FileMcd) Failed to create journal '%s'.", temp_filename.c_str());
+		return false;
+	}
+
+	const FileMcdJournalHeader header = {FILEMCD_JOURNAL_MAGIC, FILEMCD_JOURNAL_VERSION, static_cast<u32>(sectors.size()), 0};
+	uLong crc = crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<const Bytef*>(&header), sizeof(header));
+	bool result = (std::fwrite(&header, sizeof(header), 1, fp.get()) == 1);
+
+	const u8* src = data.data();
+	for (const auto& [offset, size] : sectors)
+	{
+		const u32 record[2] = {offset, size};
+		crc = crc32(crc, reinterpret_cast<const Bytef*>(record), sizeof(record));
+		crc = crc32(crc, src, size);
+		result = result && std::fwrite(record, sizeof(record), 1, fp.get()) == 1 && std::fwrite(src, size, 1, fp.get()) == 1;
+		src += size;
+	}
+
+	const u32 crc_value = static_cast<u32>(crc);
+	result = result && std::fwrite(&crc_value, sizeof(crc_value), 1, fp.get()) == 1 && FileSystem::FSync(fp.get());
+	fp.reset();
+	result = result && FileSystem::RenamePath(temp_filename.c_str(), m_journal_filenames[slot].c_str());
+	if (!result)
+	{
+		Console.Error("(FileMcd) Failed to write journal '%s'.", m_journal_filenames[slot].c_str());
+		FileSystem::DeleteFilePath(temp_filename.c_str());
+	}
+
+	return result;
+}
+
+void FileMemoryCard::ReplayJournal(uint slot)
+{
+	const char* path = m_journal_filenames[slot].c_str();
+	if (!FileSystem::FileExists(path))
+		return;
+
+	// Anything short of a complete journal means the card itself was never touched.
+	std::optional<std::vector<u8>> journal = FileSystem::ReadBinaryFile(path);
+	bool valid = journal.has_value() && journal->size() >= (sizeof(FileMcdJournalHeader) + sizeof(u32));
+	if (valid)
+	{
+		const u8* const start = journal->data();
+		const u8* const crc_pos = start + journal->size() - sizeof(u32);
+		u32 crc_value;
+		std::memcpy(&crc_value, crc_pos, sizeof(crc_value));
+		valid = (static_cast<u32>(crc32(crc32(0L, Z_NULL, 0), start, static_cast<uInt>(crc_pos - start))) == crc_value);
+
+		FileMcdJournalHeader header;
+		std::memcpy(&header, start, sizeof(header));
+		valid = valid && header.magic == FILEMCD_JOURNAL_MAGIC && header.version == FILEMCD_JOURNAL_VERSION;
+
+		const u8* pos = start + sizeof(header);
+		for (u32 i = 0; valid && i < header.count; i++)
+		{
+			u32 record[2];
+			valid = (static_cast<size_t>(crc_pos - pos) >= sizeof(record));
+			if (!valid)
+				break;
+
+			std::memcpy(record, pos, sizeof(record));
+			pos += sizeof(record);
+			valid = (static_cast<size_t>(crc_pos - pos) >= record[1]) &&
+					FileSystem::FSeek64(m_file[slot], record[0], SEEK_SET) == 0 &&
+					std::fwrite(pos, record[1], 1, m_file[slot]) == 1;
+			pos += record[1];
+		}
+
+		valid = valid && FileSystem::FSync(m_file[slot]);
+		if (valid)
+			Console.Warning("(FileMcd) Recovered %u sectors from an interrupted write to memory card in slot %u.", header.count, slot);
+	}
+
+	if (!valid)
+		Console.Warning("(FileMcd) Discarding incomplete journal '%s'.", path);
+
+	FileSystem::DeleteFilePath(path);
+}
+
 // --------------------------------------------------------------------------------------
 //  MemoryCard Component API Bindings
 // --------------------------------------------------------------------------------------
@@ -1047,6 +1047,10 @@ Pcsx2Config::Pcsx2Config()
 	}
 
 	GzipIsoIndexTemplate = "$(f).pindex.tmp";
+
+	RewindFrequency = 10;
+	RewindBufferSize = 256;
+	RunAheadFrames = 0;
 }
 
 void Pcsx2Config::LoadSave(SettingsWrapper& wrap)
@@ -1073,6 +1077,10 @@ void Pcsx2Config::LoadSave(SettingsWrapper& wrap)
 
 	SettingsWrapBitBool(BackupSavestate);
 	SettingsWrapBitBool(SavestateZstdCompression);
+	SettingsWrapBitBool(EnableRewind);
+	SettingsWrapEntry(RewindFrequency);
+	SettingsWrapEntry(RewindBufferSize);
+	SettingsWrapEntry(RunAheadFrames);
 	SettingsWrapBitBool(McdEnableEjection);
 	SettingsWrapBitBool(McdFolderAutoManage);
 #ifndef PCSX2_CORE
@@ -1173,7 +1181,10 @@ bool Pcsx2Config::operator==(const Pcsx2Config& right) const
 		OpEqu(Framerate) &&
 		OpEqu(Trace) &&
 		OpEqu(BaseFilenames) &&
-		OpEqu(GzipIsoIndexTemplate);
+		OpEqu(GzipIsoIndexTemplate) &&
+		OpEqu(RewindFrequency) &&
+		OpEqu(RewindBufferSize) &&
+		OpEqu(RunAheadFrames);
 	for (u32 i = 0; i < sizeof(Mcd) / sizeof(Mcd[0]); i++)
 	{
 		equal &= OpEqu(Mcd[i].Enabled);
@@ -1205,6 +1216,9 @@ void Pcsx2Config::CopyConfig(const Pcsx2Config& cfg)
 	}
 
 	GzipIsoIndexTemplate = cfg.GzipIsoIndexTemplate;
+	RewindFrequency = cfg.RewindFrequency;
+	RewindBufferSize = cfg.RewindBufferSize;
+	RunAheadFrames = cfg.RunAheadFrames;
 
 	CdvdVerboseReads = cfg.CdvdVerboseReads;
 	CdvdDumpBlocks = cfg.CdvdDumpBlocks;
@@ -1220,6 +1234,7 @@ void Pcsx2Config::CopyConfig(const Pcsx2Config& cfg)
 	PatchRegion = cfg.PatchRegion;
 	BackupSavestate = cfg.BackupSavestate;
 	SavestateZstdCompression = cfg.SavestateZstdCompression;
+	EnableRewind = cfg.EnableRewind;
 	McdEnableEjection = cfg.McdEnableEjection;
 	McdFolderAutoManage = cfg.McdFolderAutoManage;
 	MultitapPort0_Enabled = cfg.MultitapPort0_Enabled;
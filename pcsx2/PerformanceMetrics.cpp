@@ -15,6 +15,7 @@
 
 #include "PrecompiledHeader.h"
 
+#include <atomic>
 #include <chrono>
 #include <vector>
 
@@ -79,6 +80,16 @@ static float s_accumulated_gpu_time = 0.0f;
 static float s_gpu_usage = 0.0f;
 static u32 s_presents_since_last_update = 0;
 
+// rewind statistics, written by the rewind worker thread
+static std::atomic<float> s_rewind_capture_time{0.0f};
+static std::atomic<float> s_rewind_compress_time{0.0f};
+static std::atomic<u32> s_rewind_state_count{0};
+static std::atomic<u64> s_rewind_memory_usage{0};
+
+// run-ahead statistics, written by the CPU thread
+static std::atomic<float> s_run_ahead_capture_time{0.0f};
+static std::atomic<float> s_run_ahead_restore_time{0.0f};
+
 void PerformanceMetrics::Clear()
 {
 	Reset();
@@ -339,3 +350,47 @@ float PerformanceMetrics::GetGPUAverageTime()
 {
 	return s_average_gpu_time;
 }
+
+void PerformanceMetrics::SetRewindStats(float capture_time, float compress_time, u32 state_count, u64 memory_usage)
+{
+	s_rewind_capture_time.store(capture_time, std::memory_order_relaxed);
+	s_rewind_compress_time.store(compress_time, std::memory_order_relaxed);
+	s_rewind_state_count.store(state_count, std::memory_order_relaxed);
+	s_rewind_memory_usage.store(memory_usage, std::memory_order_relaxed);
+}
+
+float PerformanceMetrics::GetRewindCaptureTime()
+{
+	return s_rewind_capture_time.load(std::memory_order_relaxed);
+}
+
+float PerformanceMetrics::GetRewindCompressTime()
+{
+	return s_rewind_compress_time.load(std::memory_order_relaxed);
+}
+
+u32 PerformanceMetrics::GetRewindStateCount()
+{
+	return s_rewind_state_count.load(std::memory_order_relaxed);
+}
+
+u64 PerformanceMetrics::GetRewindMemoryUsage()
+{
+	return s_rewind_memory_usage.load(std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::SetRunAheadStats(float capture_time, float restore_time)
+{
+	s_run_ahead_capture_time.store(capture_time, std::memory_order_relaxed);
+	s_run_ahead_restore_time.store(restore_time, std::memory_order_relaxed);
+}
+
+float PerformanceMetrics::GetRunAheadCaptureTime()
+{
+	return s_run_ahead_capture_time.load(std::memory_order_relaxed);
+}
+
+float PerformanceMetrics::GetRunAheadRestoreTime()
+{
+	return s_run_ahead_restore_time.load(std::memory_order_relaxed);
+}
@@ -64,4 +64,16 @@ namespace PerformanceMetrics
 
 	float GetGPUUsage();
 	float GetGPUAverageTime();
+
+	/// Updates the rewind statistics. Times are in milliseconds, memory in bytes.
+	void SetRewindStats(float capture_time, float compress_time, u32 state_count, u64 memory_usage);
+	float GetRewindCaptureTime();
+	float GetRewindCompressTime();
+	u32 GetRewindStateCount();
+	u64 GetRewindMemoryUsage();
+
+	/// Updates the run-ahead statistics, the per-frame state capture and restore times in milliseconds.
+	void SetRunAheadStats(float capture_time, float restore_time);
+	float GetRunAheadCaptureTime();
+	float GetRunAheadRestoreTime();
 } // namespace PerformanceMetrics
@@ -458,6 +458,10 @@ __fi void _cpuEventTest_Shared()
 	CpuVU0->ExecuteBlock();
 	CpuVU1->ExecuteBlock();
 
+	// ---- Memchecks -------------
+	// Memchecks guarded by page protection break from the fault handler, but are logged here.
+	mmap_ProcessMemcheckHits();
+
 	// ---- Schedule Next Event Test --------------
 
 	if( EEsCycle > 192 )
@@ -817,9 +821,25 @@ int isBreakpointNeeded(u32 addr)
 	return bpFlags;
 }
 
+// Memchecks guarded by page protection break from the page fault handler, which relies on the
+// recompiler flushing the guest state before every instruction that may touch memory (or
+// whose delay slot may).
+bool isMemcheckGuardNeeded(u32 pc)
+{
+	if (!mmap_HasMemcheckGuards())
+		return false;
+
+	u32 addr = pc;
+	if (isBranchOrJump(addr))
+		addr += 4;
+
+	const OPCODE& opcode = GetInstruction(memRead32(addr));
+	return (opcode.flags & IS_MEMORY) != 0;
+}
+
 int isMemcheckNeeded(u32 pc)
 {
-	if (CBreakPoints::GetNumMemchecks() == 0)
+	if (CBreakPoints::GetNumInlineMemchecks() == 0)
 		return 0;
 	
 	u32 addr = pc;
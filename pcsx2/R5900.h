@@ -446,6 +446,7 @@ extern void cpuTestTIMRInts();
 
 // breakpoint code shared between interpreter and recompiler
 int isMemcheckNeeded(u32 pc);
+bool isMemcheckGuardNeeded(u32 pc);
 int isBreakpointNeeded(u32 addr);
 
 ////////////////////////////////////////////////////////////////////
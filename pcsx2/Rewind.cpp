@@ -0,0 +1,445 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+
+#include "Rewind.h"
+#include "Config.h"
+#include "Host.h"
+#include "PerformanceMetrics.h"
+#include "SaveState.h"
+
+#include "common/Threading.h"
+#include "common/Timer.h"
+
+#include "fmt/core.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <zstd.h>
+
+namespace Rewind
+{
+	// An older state, stored as the XOR of it against the next newer state (zero-extended
+	// to the longer of the two), then compressed. Most pages don't change between captures,
+	// so the delta is mostly zeros and compresses very well.
+	struct DeltaState
+	{
+		std::vector<ArchiveEntry> entries;
+		u32 size;
+		std::vector<u8> compressed;
+	};
+
+	static u32 GetStateSize(const ArchiveEntryList& list);
+	static void XorStates(u8* dst, const u8* src, u32 src_size, const u8* other, u32 other_size);
+
+	static void StartWorkerThread();
+	static void StopWorkerThread();
+	static void WaitForWorkerThread(std::unique_lock<std::mutex>& lock);
+	static void WorkerThreadEntryPoint();
+	static void AddCapture(std::unique_ptr<ArchiveEntryList> capture);
+	static void UpdateStats();
+
+	static void Capture();
+	static bool RewindOneState();
+} // namespace Rewind
+
+// Compression level used for the deltas, favouring speed over ratio.
+static constexpr int REWIND_COMPRESSION_LEVEL = 1;
+
+static bool s_enabled = false;
+static u32 s_frequency = 0;
+static u64 s_memory_budget = 0;
+static u32 s_frames_until_capture = 0;
+static bool s_rewinding = false;
+
+// Newest captured state, uncompressed. Older states hang off it as a chain of deltas,
+// so rewinding applies the newest delta first and dropping the oldest one is always safe.
+static std::unique_ptr<ArchiveEntryList> s_head_state;
+static u32 s_head_size = 0;
+static std::deque<Rewind::DeltaState> s_delta_states;
+static u64 s_delta_memory = 0;
+
+static std::thread s_worker_thread;
+static std::mutex s_worker_mutex;
+static std::condition_variable s_worker_work_cv;
+static std::condition_variable s_worker_done_cv;
+static std::unique_ptr<ArchiveEntryList> s_pending_capture;
+static bool s_worker_busy = false;
+static bool s_worker_shutdown = false;
+
+// Only touched by whichever thread currently owns the ring.
+static std::vector<u8> s_delta_buffer;
+static std::vector<u8> s_compress_buffer;
+static ZSTD_CCtx* s_compress_context = nullptr;
+static ZSTD_DCtx* s_decompress_context = nullptr;
+
+// Written by the CPU thread (capture) and the worker (compress), read by either when
+// publishing the stats.
+static std::atomic<float> s_last_capture_time{0.0f};
+static std::atomic<float> s_last_compress_time{0.0f};
+
+u32 Rewind::GetStateSize(const ArchiveEntryList& list)
+{
+	u32 size = 0;
+	for (size_t i = 0; i < list.GetLength(); i++)
+		size = std::max(size, static_cast<u32>(list[i].GetDataIndex() + list[i].GetDataSize()));
+	return size;
+}
+
+void Rewind::XorStates(u8* dst, const u8* src, u32 src_size, const u8* other, u32 other_size)
+{
+	// dst may alias other, every byte is read before it is written.
+	const u32 common_size = std::min(src_size, other_size);
+	u32 pos = 0;
+	for (; (pos + sizeof(u64)) <= common_size; pos += sizeof(u64))
+	{
+		u64 a, b;
+		std::memcpy(&a, src + pos, sizeof(a));
+		std::memcpy(&b, other + pos, sizeof(b));
+		a ^= b;
+		std::memcpy(dst + pos, &a, sizeof(a));
+	}
+	for (; pos < common_size; pos++)
+		dst[pos] = src[pos] ^ other[pos];
+
+	// other is zero past its end
+	if (src_size > common_size)
+		std::memcpy(dst + common_size, src + common_size, src_size - common_size);
+}
+
+void Rewind::UpdateSettings()
+{
+	const bool enabled = EmuConfig.EnableRewind;
+	const u32 frequency = std::max(EmuConfig.RewindFrequency, 1u);
+	const u64 memory_budget = static_cast<u64>(EmuConfig.RewindBufferSize) * _1mb;
+	if (enabled == s_enabled && frequency == s_frequency && memory_budget == s_memory_budget)
+		return;
+
+	Clear();
+
+	s_frequency = frequency;
+	s_memory_budget = memory_budget;
+	s_frames_until_capture = frequency;
+	if (enabled != s_enabled)
+	{
+		s_enabled = enabled;
+		if (enabled)
+		{
+			Console.WriteLn("Rewind enabled, capturing every %u frames into %u MB.", frequency, EmuConfig.RewindBufferSize);
+			StartWorkerThread();
+		}
+		else
+		{
+			StopWorkerThread();
+		}
+	}
+}
+
+void Rewind::Clear()
+{
+	{
+		std::unique_lock lock(s_worker_mutex);
+		s_pending_capture.reset();
+		WaitForWorkerThread(lock);
+	}
+
+	s_head_state.reset();
+	s_head_size = 0;
+	s_delta_states.clear();
+	s_delta_memory = 0;
+	s_frames_until_capture = s_frequency;
+	s_rewinding = false;
+	s_last_capture_time.store(0.0f, std::memory_order_relaxed);
+	s_last_compress_time.store(0.0f, std::memory_order_relaxed);
+	UpdateStats();
+}
+
+void Rewind::Shutdown()
+{
+	Clear();
+	StopWorkerThread();
+	s_enabled = false;
+	s_frequency = 0;
+	s_memory_budget = 0;
+
+	std::vector<u8>().swap(s_delta_buffer);
+	std::vector<u8>().swap(s_compress_buffer);
+}
+
+void Rewind::SetRewinding(bool rewinding)
+{
+	s_rewinding = rewinding && s_enabled;
+}
+
+bool Rewind::IsRewinding()
+{
+	return s_rewinding;
+}
+
+void Rewind::OnVSync()
+{
+	if (!s_enabled)
+		return;
+
+	if (s_rewinding)
+	{
+		if (!RewindOneState())
+		{
+			Host::AddKeyedOSDMessage("Rewind", "No more rewind states available.", 2.0f);
+			s_rewinding = false;
+		}
+
+		// don't capture what we just rewound to straight away
+		s_frames_until_capture = s_frequency;
+		return;
+	}
+
+	if (--s_frames_until_capture > 0)
+		return;
+
+	s_frames_until_capture = s_frequency;
+	Capture();
+}
+
+void Rewind::Capture()
+{
+	// If the worker hasn't finished with the previous capture, skip this one rather than stalling emulation.
+	{
+		std::unique_lock lock(s_worker_mutex);
+		if (s_worker_busy)
+		{
+			DevCon.WriteLn("Rewind: Skipping capture, previous capture is still compressing.");
+			return;
+		}
+	}
+
+	// Only the pages written since the last capture are copied here, the worker rebuilds the full
+	// state from the head. The worker is idle, so the head can't change underneath us.
+	Common::Timer timer;
+	std::unique_ptr<ArchiveEntryList> capture;
+	try
+	{
+		capture = SaveState_DownloadIncrementalState(s_head_state.get());
+	}
+	catch (Exception::BaseException& e)
+	{
+		Console.Error("Rewind: Failed to capture state: %s", e.DiagMsg().c_str());
+		return;
+	}
+	s_last_capture_time.store(timer.GetTimeMilliseconds(), std::memory_order_relaxed);
+
+	std::unique_lock lock(s_worker_mutex);
+	s_pending_capture = std::move(capture);
+	s_worker_busy = true;
+	s_worker_work_cv.notify_one();
+}
+
+bool Rewind::RewindOneState()
+{
+	{
+		std::unique_lock lock(s_worker_mutex);
+		s_pending_capture.reset();
+		WaitForWorkerThread(lock);
+	}
+
+	if (!s_head_state)
+		return false;
+
+	try
+	{
+		SaveState_LoadFromMemory(s_head_state.get());
+	}
+	catch (Exception::BaseException& e)
+	{
+		Console.Error("Rewind: Failed to load state: %s", e.DiagMsg().c_str());
+		Clear();
+		return false;
+	}
+
+	// Step the head back to the next older state, so the following rewind continues from there.
+	if (s_delta_states.empty())
+	{
+		s_head_state.reset();
+		s_head_size = 0;
+		UpdateStats();
+		return true;
+	}
+
+	DeltaState& delta = s_delta_states.back();
+	s_delta_buffer.resize(delta.size);
+	const size_t decompressed_size = ZSTD_decompressDCtx(s_decompress_context, s_delta_buffer.data(), s_delta_buffer.size(),
+		delta.compressed.data(), delta.compressed.size());
+	if (ZSTD_isError(decompressed_size) || decompressed_size != delta.size)
+	{
+		Console.Error("Rewind: Failed to decompress state: %s",
+			ZSTD_isError(decompressed_size) ? ZSTD_getErrorName(decompressed_size) : "size mismatch");
+		Clear();
+		return true;
+	}
+
+	VmStateBuffer* head_buffer = s_head_state->GetBuffer();
+	head_buffer->MakeRoomFor(static_cast<int>(delta.size));
+	XorStates(head_buffer->GetPtr(), s_delta_buffer.data(), delta.size, head_buffer->GetPtr(), s_head_size);
+
+	s_head_state->ClearEntries();
+	for (const ArchiveEntry& entry : delta.entries)
+		s_head_state->Add(entry);
+	s_head_size = delta.size;
+
+	s_delta_memory -= delta.compressed.size();
+	s_delta_states.pop_back();
+	UpdateStats();
+	return true;
+}
+
+void Rewind::StartWorkerThread()
+{
+	s_compress_context = ZSTD_createCCtx();
+	s_decompress_context = ZSTD_createDCtx();
+	s_worker_shutdown = false;
+	s_worker_thread = std::thread(WorkerThreadEntryPoint);
+}
+
+void Rewind::StopWorkerThread()
+{
+	if (s_worker_thread.joinable())
+	{
+		{
+			std::unique_lock lock(s_worker_mutex);
+			s_pending_capture.reset();
+			s_worker_shutdown = true;
+			s_worker_work_cv.notify_one();
+		}
+
+		s_worker_thread.join();
+	}
+
+	if (s_compress_context)
+	{
+		ZSTD_freeCCtx(s_compress_context);
+		s_compress_context = nullptr;
+	}
+	if (s_decompress_context)
+	{
+		ZSTD_freeDCtx(s_decompress_context);
+		s_decompress_context = nullptr;
+	}
+}
+
+void Rewind::WaitForWorkerThread(std::unique_lock<std::mutex>& lock)
+{
+	s_worker_done_cv.wait(lock, []() { return !s_worker_busy; });
+}
+
+void Rewind::WorkerThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("Rewind Compression");
+
+	std::unique_lock lock(s_worker_mutex);
+	for (;;)
+	{
+		s_worker_work_cv.wait(lock, []() { return s_pending_capture || s_worker_shutdown; });
+		if (s_worker_shutdown)
+			break;
+
+		std::unique_ptr<ArchiveEntryList> capture(std::move(s_pending_capture));
+		lock.unlock();
+		AddCapture(std::move(capture));
+		lock.lock();
+
+		s_worker_busy = false;
+		s_worker_done_cv.notify_all();
+	}
+
+	s_worker_busy = false;
+	s_worker_done_cv.notify_all();
+}
+
+void Rewind::AddCapture(std::unique_ptr<ArchiveEntryList> capture)
+{
+	Common::Timer timer;
+	try
+	{
+		capture = SaveState_ApplyIncrementalState(s_head_state.get(), *capture);
+	}
+	catch (Exception::BaseException& e)
+	{
+		// The next capture is relative to this one, so start over from a full capture.
+		Console.Error("Rewind: Failed to rebuild state: %s", e.DiagMsg().c_str());
+		s_head_state.reset();
+		s_head_size = 0;
+		s_delta_states.clear();
+		s_delta_memory = 0;
+		UpdateStats();
+		return;
+	}
+
+	const u32 capture_size = GetStateSize(*capture);
+
+	if (s_head_state)
+	{
+		s_delta_buffer.resize(s_head_size);
+		XorStates(s_delta_buffer.data(), s_head_state->GetPtr(0), s_head_size, capture->GetPtr(0), capture_size);
+
+		s_compress_buffer.resize(ZSTD_compressBound(s_head_size));
+		const size_t compressed_size = ZSTD_compressCCtx(s_compress_context, s_compress_buffer.data(), s_compress_buffer.size(),
+			s_delta_buffer.data(), s_head_size, REWIND_COMPRESSION_LEVEL);
+		if (ZSTD_isError(compressed_size))
+		{
+			// Keep what we have, the chain just won't reach past this capture.
+			Console.Error("Rewind: Failed to compress state: %s", ZSTD_getErrorName(compressed_size));
+			s_delta_states.clear();
+			s_delta_memory = 0;
+		}
+		else
+		{
+			DeltaState& delta = s_delta_states.emplace_back();
+			delta.entries.reserve(s_head_state->GetLength());
+			for (size_t i = 0; i < s_head_state->GetLength(); i++)
+				delta.entries.push_back((*s_head_state)[i]);
+			delta.size = s_head_size;
+			delta.compressed.assign(s_compress_buffer.begin(), s_compress_buffer.begin() + compressed_size);
+			s_delta_memory += compressed_size;
+		}
+	}
+
+	s_head_state = std::move(capture);
+	s_head_size = capture_size;
+
+	// Drop the oldest states until we fit in the budget again.
+	const u64 head_memory = static_cast<u64>(s_head_state->GetBuffer()->GetSizeInBytes());
+	while (!s_delta_states.empty() && (head_memory + s_delta_memory) > s_memory_budget)
+	{
+		s_delta_memory -= s_delta_states.front().compressed.size();
+		s_delta_states.pop_front();
+	}
+
+	s_last_compress_time.store(timer.GetTimeMilliseconds(), std::memory_order_relaxed);
+	UpdateStats();
+}
+
+void Rewind::UpdateStats()
+{
+	const u64 head_memory = s_head_state ? static_cast<u64>(s_head_state->GetBuffer()->GetSizeInBytes()) : 0;
+	const u32 state_count = static_cast<u32>(s_delta_states.size()) + (s_head_state ? 1 : 0);
+	PerformanceMetrics::SetRewindStats(s_last_capture_time.load(std::memory_order_relaxed), s_last_compress_time.load(std::memory_order_relaxed), state_count, head_memory + s_delta_memory);
+}
@@ -0,0 +1,39 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "PCSX2Base.h"
+
+/// In-memory ring of recent states, captured every few frames while the VM runs.
+/// All functions must be called from the CPU thread.
+namespace Rewind
+{
+/// Applies the rewind settings from EmuConfig. Changing them throws away any captured states.
+void UpdateSettings();
+
+/// Discards all captured states, e.g. after a reset or loading a state from disk.
+void Clear();
+
+/// Stops the compression thread and releases all memory.
+void Shutdown();
+
+/// While rewinding, each vsync steps back by one captured state instead of capturing.
+void SetRewinding(bool rewinding);
+bool IsRewinding();
+
+/// Captures or rewinds, called at the end of each frame.
+void OnVSync();
+} // namespace Rewind
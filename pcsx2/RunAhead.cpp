@@ -0,0 +1,220 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+
+#include "RunAhead.h"
+#include "Config.h"
+#include "GS/GS.h"
+#include "Host.h"
+#include "PerformanceMetrics.h"
+#include "R5900.h"
+#include "SaveState.h"
+#include "SPU2/spu2.h"
+#include "VMManager.h"
+
+#include "common/Timer.h"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+
+namespace RunAhead
+{
+	static bool Capture();
+	static bool Restore();
+} // namespace RunAhead
+
+// Every frame ahead costs a whole frame of emulation, past this it's cheaper to lower the latency elsewhere.
+static constexpr u32 MAX_RUN_AHEAD_FRAMES = 4;
+
+// Games write their saves over many frames, run-ahead stays off until the card has been idle this long.
+static constexpr u32 MEMCARD_IDLE_FRAMES = 60;
+
+static u32 s_frames = 0;
+static u32 s_frames_left = 0;
+static bool s_present_suppressed = false;
+static u32 s_memcard_idle_frames_left = 0;
+
+// Reused every frame. The buffer grows on the first capture, after that only the pages which
+// changed are copied in and out of it.
+static std::unique_ptr<ArchiveEntryList> s_state;
+
+static float s_capture_time = 0.0f;
+static float s_restore_time = 0.0f;
+
+void RunAhead::UpdateSettings()
+{
+	const u32 frames = std::min(EmuConfig.RunAheadFrames, MAX_RUN_AHEAD_FRAMES);
+	if (frames == s_frames)
+		return;
+
+	Clear();
+
+	s_frames = frames;
+	if (frames > 0)
+	{
+		Console.WriteLn("Run-ahead enabled, emulating %u frames ahead.", frames);
+		if (!s_state)
+			s_state = std::make_unique<ArchiveEntryList>(new VmStateBuffer("Run-Ahead Savestate"));
+	}
+	else
+	{
+		s_state.reset();
+	}
+}
+
+void RunAhead::Clear()
+{
+	if (s_frames_left > 0)
+		SPU2SetOutputSuppressed(false);
+
+	s_frames_left = 0;
+	s_present_suppressed = false;
+	s_memcard_idle_frames_left = 0;
+	if (s_state)
+		s_state->ClearEntries();
+
+	s_capture_time = 0.0f;
+	s_restore_time = 0.0f;
+	PerformanceMetrics::SetRunAheadStats(0.0f, 0.0f);
+}
+
+void RunAhead::Shutdown()
+{
+	Clear();
+	s_state.reset();
+	s_frames = 0;
+}
+
+bool RunAhead::IsRunningAhead()
+{
+	return (s_frames_left > 0);
+}
+
+bool RunAhead::IsPresentSuppressed()
+{
+	return s_present_suppressed;
+}
+
+void RunAhead::OnMemoryCardWrite()
+{
+	if (s_frames > 0)
+		s_memcard_idle_frames_left = MEMCARD_IDLE_FRAMES;
+}
+
+void RunAhead::OnVSync()
+{
+	if (s_frames == 0)
+		return;
+
+	// Never leave the machine ahead when it's about to stop, since it could be saved or inspected.
+	// GS dumps can't follow the machine being rolled back either, and memory card writes have to
+	// come from real frames.
+	const bool interrupted = VMManager::Internal::IsExecutionInterrupted() || GSIsDumping() ||
+							 (s_memcard_idle_frames_left > 0);
+
+	if (s_frames_left == 0)
+	{
+		if (s_memcard_idle_frames_left > 0)
+			s_memcard_idle_frames_left--;
+
+		if (interrupted || !Capture())
+		{
+			s_present_suppressed = false;
+			return;
+		}
+
+		// Only the last frame ahead is shown, in place of the real frame it stands for.
+		s_frames_left = s_frames;
+		s_present_suppressed = (s_frames_left > 1);
+		SPU2SetOutputSuppressed(true);
+		return;
+	}
+
+	const bool shown = !s_present_suppressed;
+	if (--s_frames_left > 0 && !interrupted)
+	{
+		s_present_suppressed = (s_frames_left > 1);
+		return;
+	}
+
+	s_frames_left = 0;
+	const bool restored = Restore();
+	s_present_suppressed = (restored && shown);
+	SPU2SetOutputSuppressed(false);
+
+	// A failed restore can leave the machine half way between two frames, it can't keep running.
+	if (!restored)
+	{
+		Host::ReportErrorAsync("Run-Ahead Error",
+			"Failed to roll back the frames emulated ahead, the virtual machine has been stopped.");
+		VMManager::SetState(VMState::Stopping);
+		Cpu->ExitExecution();
+		return;
+	}
+
+	PerformanceMetrics::SetRunAheadStats(s_capture_time, s_restore_time);
+}
+
+bool RunAhead::Capture()
+{
+	Common::Timer timer;
+	try
+	{
+		SaveState_CaptureToMemory(s_state.get());
+	}
+	catch (Exception::BaseException& e)
+	{
+		Console.Error("Run-ahead: Failed to capture state: %s", e.DiagMsg().c_str());
+		s_state->ClearEntries();
+		return false;
+	}
+	catch (const std::exception& e)
+	{
+		Console.Error("Run-ahead: Failed to capture state: %s", e.what());
+		s_state->ClearEntries();
+		return false;
+	}
+
+	s_capture_time = timer.GetTimeMilliseconds();
+	return true;
+}
+
+bool RunAhead::Restore()
+{
+	Common::Timer timer;
+	try
+	{
+		SaveState_RestoreFromMemory(s_state.get());
+	}
+	catch (Exception::BaseException& e)
+	{
+		Console.Error("Run-ahead: Failed to restore state: %s", e.DiagMsg().c_str());
+		s_state->ClearEntries();
+		return false;
+	}
+	catch (const std::exception& e)
+	{
+		Console.Error("Run-ahead: Failed to restore state: %s", e.what());
+		s_state->ClearEntries();
+		return false;
+	}
+
+	s_restore_time = timer.GetTimeMilliseconds();
+	return true;
+}
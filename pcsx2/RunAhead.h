@@ -0,0 +1,47 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "PCSX2Base.h"
+
+/// Hides input latency by emulating a few frames ahead of the one shown. After each real frame the
+/// state is captured, the next frames are emulated with the same input and without sound, the last
+/// of them is shown, and then the state is restored to continue the real frame.
+/// All functions must be called from the CPU thread.
+namespace RunAhead
+{
+/// Applies the run-ahead settings from EmuConfig.
+void UpdateSettings();
+
+/// Forgets the captured state, e.g. after a reset or loading a state from disk.
+void Clear();
+
+/// Releases the state buffer.
+void Shutdown();
+
+/// True while emulating frames which will be rolled back.
+bool IsRunningAhead();
+
+/// True if the frame being queued to the GS must not be presented.
+bool IsPresentSuppressed();
+
+/// Called when the game writes to a memory card. Run-ahead pauses for a while, so the writes which
+/// reach the card come from real frames.
+void OnMemoryCardWrite();
+
+/// Captures or restores, called once each frame has been queued to the GS.
+void OnVSync();
+} // namespace RunAhead
@@ -0,0 +1,82 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+#include "common/emitter/x86_intrin.h"
+#include <algorithm>
+#include <cstring>
+
+// 16 byte ADPCM blocks: a 2 byte header followed by 28 4-bit samples.
+static const int XA_BlockSamples = 28;
+
+static const s32 tbl_XA_Factor[16][2] =
+	{
+		{0, 0},
+		{60, 0},
+		{115, -52},
+		{98, -55},
+		{122, -60}};
+
+// Decodes one block into 28 samples, carrying the filter history in prev1/prev2.
+static __forceinline void XA_decode_block(s16* buffer, const s16* block, s32& prev1, s32& prev2)
+{
+	const s32 header = *block;
+	const s32 shift = (header & 0xF) + 16;
+	const int id = header >> 4 & 0xF;
+	const s32 pred1 = tbl_XA_Factor[id][0];
+	const s32 pred2 = tbl_XA_Factor[id][1];
+
+	// Expand all 28 nibbles at once.  Each nibble goes to the top of a 16 bit lane and is
+	// arithmetic shifted down, which matches (nibble << 28) >> shift on 32 bits.
+	// The block is 16 bytes, so load it whole and drop the header instead of reading past it.
+	const __m128i raw = _mm_srli_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block)), 2);
+	const __m128i count = _mm_cvtsi32_si128(shift - 16);
+	const __m128i hi_mask = _mm_set1_epi16(0xF0);
+
+	const __m128i bytes_lo = _mm_unpacklo_epi8(raw, _mm_setzero_si128());
+	const __m128i bytes_hi = _mm_unpackhi_epi8(raw, _mm_setzero_si128());
+	const __m128i even_lo = _mm_slli_epi16(bytes_lo, 12);
+	const __m128i odd_lo = _mm_slli_epi16(_mm_and_si128(bytes_lo, hi_mask), 8);
+	const __m128i even_hi = _mm_slli_epi16(bytes_hi, 12);
+	const __m128i odd_hi = _mm_slli_epi16(_mm_and_si128(bytes_hi, hi_mask), 8);
+
+	alignas(16) s16 data[32];
+	_mm_store_si128(reinterpret_cast<__m128i*>(&data[0]), _mm_sra_epi16(_mm_unpacklo_epi16(even_lo, odd_lo), count));
+	_mm_store_si128(reinterpret_cast<__m128i*>(&data[8]), _mm_sra_epi16(_mm_unpackhi_epi16(even_lo, odd_lo), count));
+	_mm_store_si128(reinterpret_cast<__m128i*>(&data[16]), _mm_sra_epi16(_mm_unpacklo_epi16(even_hi, odd_hi), count));
+	_mm_store_si128(reinterpret_cast<__m128i*>(&data[24]), _mm_sra_epi16(_mm_unpackhi_epi16(even_hi, odd_hi), count));
+
+	if (pred1 == 0 && pred2 == 0)
+	{
+		// No prediction, the expanded nibbles are the samples and always in range.
+		std::memcpy(buffer, data, XA_BlockSamples * sizeof(s16));
+		prev2 = data[26];
+		prev1 = data[27];
+		return;
+	}
+
+	// The filter clamps and rounds every sample, so the recurrence has to stay serial
+	// to remain bit exact.
+	for (int i = 0; i < XA_BlockSamples; i++)
+	{
+		const s32 pcm = std::clamp<s32>(data[i] + (((pred1 * prev1) + (pred2 * prev2) + 32) >> 6), -0x8000, 0x7fff);
+		buffer[i] = pcm;
+
+		prev2 = prev1;
+		prev1 = pcm;
+	}
+}
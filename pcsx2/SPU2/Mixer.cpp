@@ -20,14 +20,9 @@
 void ADMAOutLogWrite(void* lpData, u32 ulSize);
 
 #include "interpolate_table.h"
+#include "ADPCM.h"
 
-static const s32 tbl_XA_Factor[16][2] =
-	{
-		{0, 0},
-		{60, 0},
-		{115, -52},
-		{98, -55},
-		{122, -60}};
+static_assert(XA_BlockSamples == pcm_DecodedSamplesPerBlock);
 
 
 // Performs a 64-bit multiplication between two values and returns the
@@ -74,38 +69,6 @@ __forceinline
 		GetClamped(sample.Right, -(0x7f00 << bitshift), 0x7f00 << bitshift));
 }
 
-static void __forceinline XA_decode_block(s16* buffer, const s16* block, s32& prev1, s32& prev2)
-{
-	const s32 header = *block;
-	const s32 shift = (header & 0xF) + 16;
-	const int id = header >> 4 & 0xF;
-	if (id > 4 && MsgToConsole())
-		ConLog("* SPU2: Unknown ADPCM coefficients table id %d\n", id);
-	const s32 pred1 = tbl_XA_Factor[id][0];
-	const s32 pred2 = tbl_XA_Factor[id][1];
-
-	const s8* blockbytes = (s8*)&block[1];
-	const s8* blockend = &blockbytes[13];
-
-	for (; blockbytes <= blockend; ++blockbytes)
-	{
-		s32 data = ((*blockbytes) << 28) & 0xF0000000;
-		s32 pcm = (data >> shift) + (((pred1 * prev1) + (pred2 * prev2) + 32) >> 6);
-
-		Clampify(pcm, -0x8000, 0x7fff);
-		*(buffer++) = pcm;
-
-		data = ((*blockbytes) << 24) & 0xF0000000;
-		s32 pcm2 = (data >> shift) + (((pred1 * pcm) + (pred2 * prev1) + 32) >> 6);
-
-		Clampify(pcm2, -0x8000, 0x7fff);
-		*(buffer++) = pcm2;
-
-		prev2 = pcm;
-		prev1 = pcm2;
-	}
-}
-
 static void __forceinline IncrementNextA(V_Core& thiscore, uint voiceidx)
 {
 	V_Voice& vc(thiscore.Voices[voiceidx]);
@@ -234,8 +197,8 @@ static __forceinline s32 GetNextDataBuffered(V_Core& thiscore, uint voiceidx)
 			if (vc.NextA >= SPU2_DYN_MEMLINE)
 			{
 				cacheLine.Validated = true;
-				cacheLine.Prev1 = vc.Prev1;
-				cacheLine.Prev2 = vc.Prev2;
+				cacheLine.Prev1 = static_cast<s16>(vc.Prev1);
+				cacheLine.Prev2 = static_cast<s16>(vc.Prev2);
 			}
 
 			if (IsDevBuild)
@@ -246,6 +209,10 @@ static __forceinline s32 GetNextDataBuffered(V_Core& thiscore, uint voiceidx)
 					g_counter_cache_misses++;
 			}
 
+			const int id = *memptr >> 4 & 0xF;
+			if (id > 4 && MsgToConsole())
+				ConLog("* SPU2: Unknown ADPCM coefficients table id %d\n", id);
+
 			XA_decode_block(vc.SBuffer, memptr, vc.Prev1, vc.Prev2);
 		}
 	}
@@ -99,6 +99,7 @@ alignas(4) volatile s32 SndBuffer::m_rpos;
 alignas(4) volatile s32 SndBuffer::m_wpos;
 
 bool SndBuffer::m_underrun_freeze;
+bool SndBuffer::m_output_suppressed = false;
 StereoOut32* SndBuffer::sndTempBuffer = nullptr;
 StereoOut16* SndBuffer::sndTempBuffer16 = nullptr;
 int SndBuffer::sndTempProgress = 0;
@@ -409,8 +410,18 @@ void SndBuffer::SetPaused(bool paused)
 	mods[OutputModule]->SetPaused(paused);
 }
 
+// Samples mixed while suppressed are thrown away before they reach the dumps or the output,
+// used for frames which are emulated only to be rolled back.
+void SndBuffer::SetOutputSuppressed(bool suppressed)
+{
+	m_output_suppressed = suppressed;
+}
+
 void SndBuffer::Write(const StereoOut32& Sample)
 {
+	if (m_output_suppressed)
+		return;
+
 	// Log final output to wavefile.
 	WaveDump::WriteCore(1, CoreSrc_External, Sample.DownSample());
 
@@ -563,6 +563,7 @@ class SndBuffer
 {
 private:
 	static bool m_underrun_freeze;
+	static bool m_output_suppressed;
 	static s32 m_predictData;
 	static float lastPct;
 
@@ -618,6 +619,7 @@ public:
 	static void Write(const StereoOut32& Sample);
 	static void ClearContents();
 	static void SetPaused(bool paused);
+	static void SetOutputSuppressed(bool suppressed);
 
 	// Note: When using with 32 bit output buffers, the user of this function is responsible
 	// for shifting the values to where they need to be manually.  The fixed point depth of
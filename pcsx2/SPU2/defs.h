@@ -573,6 +573,7 @@ namespace SPU2Savestate
 
 	extern s32 FreezeIt(DataBlock& spud);
 	extern s32 ThawIt(DataBlock& spud);
+	extern s32 ThawInPlace(const DataBlock& spud);
 	extern s32 SizeIt();
 } // namespace SPU2Savestate
 
@@ -594,12 +595,14 @@ static const int pcm_BlockCount = 0x100000 / pcm_WordsPerBlock;
 // 28 samples per decoded PCM block (as stored in our cache)
 static const int pcm_DecodedSamplesPerBlock = 28;
 
+// The filter history is always a clamped 16 bit sample, so it's stored as one to keep the
+// entries small (the table holds one for every block in SPU2 ram).
 struct PcmCacheEntry
 {
 	bool Validated;
 	s16 Sampledata[pcm_DecodedSamplesPerBlock];
-	s32 Prev1;
-	s32 Prev2;
+	s16 Prev1;
+	s16 Prev2;
 };
 
 extern PcmCacheEntry* pcm_cache_data;
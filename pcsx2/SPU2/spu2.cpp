@@ -219,7 +219,7 @@ s32 SPU2init()
 	// adpcm decoder cache:
 	//  the cache data size is determined by taking the number of adpcm blocks
 	//  (2MB / 16) and multiplying it by the decoded block size (28 samples).
-	//  Thus: pcm_cache_data = 7,340,032 bytes (ouch!)
+	//  Thus: pcm_cache_data = 131072 * 62 = 8,126,464 bytes (ouch!)
 	//  Expanded: 16 bytes expands to 56 bytes [3.5:1 ratio]
 	//    Resulting in 2MB * 3.5.
 
@@ -401,6 +401,11 @@ void SPU2SetOutputPaused(bool paused)
 	SndBuffer::SetPaused(paused);
 }
 
+void SPU2SetOutputSuppressed(bool suppressed)
+{
+	SndBuffer::SetOutputSuppressed(suppressed);
+}
+
 #ifdef DEBUG_KEYS
 static u32 lastTicks;
 static bool lState[6];
@@ -576,3 +581,11 @@ s32 SPU2freeze(FreezeAction mode, freezeData* data)
 	// technically unreachable, but kills a warning:
 	return 0;
 }
+
+bool SPU2RestoreInPlace(const u8* data, u32 size)
+{
+	if (size != static_cast<u32>(SPU2Savestate::SizeIt()))
+		return false;
+
+	return (SPU2Savestate::ThawInPlace(*reinterpret_cast<const SPU2Savestate::DataBlock*>(data)) == 0);
+}
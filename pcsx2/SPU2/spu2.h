@@ -33,6 +33,7 @@ s32 SPU2open();
 void SPU2close();
 void SPU2shutdown();
 void SPU2SetOutputPaused(bool paused);
+void SPU2SetOutputSuppressed(bool suppressed);
 void SPU2SetDeviceSampleRateMultiplier(double multiplier);
 void SPU2write(u32 mem, u16 value);
 u16 SPU2read(u32 mem);
@@ -45,6 +46,10 @@ void SPU2endRecording();
 void SPU2async(u32 cycles);
 s32 SPU2freeze(FreezeAction mode, freezeData* data);
 
+// Restores a state captured by SPU2freeze() earlier in this session, keeping the ADPCM cache
+// and the queued output. Returns false if the data doesn't match the current layout.
+bool SPU2RestoreInPlace(const u8* data, u32 size);
+
 #ifndef PCSX2_CORE
 void SPU2configure();
 #endif
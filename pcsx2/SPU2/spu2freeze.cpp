@@ -16,6 +16,7 @@
 #include "PrecompiledHeader.h"
 #include "Global.h"
 #include "spu2.h" // hopefully temporary, until I resolve lClocks depdendency
+#include "ADPCM.h"
 
 namespace SPU2Savestate
 {
@@ -26,10 +27,63 @@ namespace SPU2Savestate
 	// Increment this when changes to the savestate system are made.
 	static const u32 SAVE_VERSION = 0x000e;
 
+	// Blocks for voices whose decoded samples are no longer in the cache after a load.
+	static s16 thawed_blocks[2][24][pcm_DecodedSamplesPerBlock];
+
 	static void wipe_the_cache()
 	{
 		memset(pcm_cache_data, 0, pcm_BlockCount * sizeof(PcmCacheEntry));
 	}
+
+	// Copies the sample memory back, and only drops the cache entries of blocks which differ.
+	static void restore_mem_keep_cache(const u8* mem)
+	{
+		static constexpr u32 BlockBytes = pcm_WordsPerBlock * sizeof(s16);
+		static constexpr u32 ChunkBytes = 4096;
+
+		u8* const dst = reinterpret_cast<u8*>(_spu2mem);
+		for (u32 chunk = 0; chunk < 0x200000; chunk += ChunkBytes)
+		{
+			if (memcmp(dst + chunk, mem + chunk, ChunkBytes) == 0)
+				continue;
+
+			for (u32 offset = chunk; offset < chunk + ChunkBytes; offset += BlockBytes)
+			{
+				if (memcmp(dst + offset, mem + offset, BlockBytes) == 0)
+					continue;
+
+				memcpy(dst + offset, mem + offset, BlockBytes);
+				pcm_cache_data[offset / BlockBytes].Validated = false;
+			}
+		}
+	}
+
+	// Go through the V_Voice structs and point SBuffer back at the block NextA is in.  The
+	// decoded samples aren't saved, but Prev1/Prev2 are the block's last two samples, so a
+	// cache entry ending on them is the one the voice was playing.  Otherwise the block is
+	// decoded again from the voice's history, which is close enough for the rest of it.
+	static void relink_voices()
+	{
+		for (int c = 0; c < 2; c++)
+		{
+			for (int v = 0; v < 24; v++)
+			{
+				V_Voice& vc = Cores[c].Voices[v];
+				PcmCacheEntry& cacheLine = pcm_cache_data[vc.NextA / pcm_WordsPerBlock];
+
+				if (cacheLine.Validated && cacheLine.Sampledata[27] == vc.Prev1 && cacheLine.Sampledata[26] == vc.Prev2)
+				{
+					vc.SBuffer = cacheLine.Sampledata;
+					continue;
+				}
+
+				s32 prev1 = vc.Prev1;
+				s32 prev2 = vc.Prev2;
+				XA_decode_block(thawed_blocks[c][v], GetMemPtr(vc.NextA & 0xFFFF8), prev1, prev2);
+				vc.SBuffer = thawed_blocks[c][v];
+			}
+		}
+	}
 } // namespace SPU2Savestate
 
 struct SPU2Savestate::DataBlock
@@ -122,18 +176,7 @@ s32 SPU2Savestate::ThawIt(DataBlock& spud)
 		PlayMode = spud.PlayMode;
 
 		wipe_the_cache();
-
-		// Go through the V_Voice structs and recalculate SBuffer pointer from
-		// the NextA setting.
-
-		for (int c = 0; c < 2; c++)
-		{
-			for (int v = 0; v < 24; v++)
-			{
-				const int cacheIdx = Cores[c].Voices[v].NextA / pcm_WordsPerBlock;
-				Cores[c].Voices[v].SBuffer = pcm_cache_data[cacheIdx].Sampledata;
-			}
-		}
+		relink_voices();
 
 		// HACKFIX!! DMAPtr can be invalid after a savestate load, so force it to nullptr and
 		// ignore it on any pending ADMA writes.  (the DMAPtr concept used to work in old VM
@@ -145,6 +188,30 @@ s32 SPU2Savestate::ThawIt(DataBlock& spud)
 	return 0;
 }
 
+// Rolls back to a state captured earlier in this session (run-ahead), every frame.  Those frames
+// were never heard, so nothing is flushed, and the cache is kept since it only depends on the
+// sample memory.
+s32 SPU2Savestate::ThawInPlace(const DataBlock& spud)
+{
+	if (spud.spu2id != SAVE_ID || spud.version != SAVE_VERSION)
+		return -1;
+
+	memcpy(spu2regs, spud.unkregs, sizeof(spud.unkregs));
+	restore_mem_keep_cache(spud.mem);
+
+	memcpy(Cores, spud.Cores, sizeof(Cores));
+	memcpy(&Spdif, &spud.Spdif, sizeof(Spdif));
+
+	OutPos = spud.OutPos;
+	InputPos = spud.InputPos;
+	Cycles = spud.Cycles;
+	lClocks = spud.lClocks;
+	PlayMode = spud.PlayMode;
+
+	relink_voices();
+	return 0;
+}
+
 s32 SPU2Savestate::SizeIt()
 {
 	return sizeof(DataBlock);
@@ -22,6 +22,7 @@
 #include "common/SafeArray.inl"
 #include "common/ScopedGuard.h"
 #include "common/StringUtil.h"
+#include "common/Timer.h"
 #include "common/ZipHelpers.h"
 
 #include "ps2/BiosTools.h"
@@ -53,8 +54,12 @@
 
 #include "fmt/core.h"
 
+#include <atomic>
 #include <csetjmp>
 #include <png.h>
+#include <thread>
+#include <zlib.h>
+#include <zstd.h>
 
 using namespace R5900;
 
@@ -74,6 +79,7 @@ static void PostLoadPrep()
 {
 	resetCache();
 //	WriteCP0Status(cpuRegs.CP0.n.Status.val);
+	vtlb_ClearCacheable();
 	for(int i=0; i<48; i++) MapTLB(i);
 	if (EmuConfig.Gamefixes.GoemonTlbHack) GoemonPreloadTlb();
 	CBreakPoints::SetSkipFirst(BREAKPOINT_EE, 0);
@@ -149,6 +155,7 @@ void SaveStateBase::Init( SafeArray<u8>* memblock )
 	m_memory	= memblock;
 	m_version	= g_SaveVersion;
 	m_idx		= 0;
+	m_transient	= false;
 }
 
 void SaveStateBase::PrepBlock( int size )
@@ -216,7 +223,7 @@ SaveStateBase& SaveStateBase::FreezeBios()
 SaveStateBase& SaveStateBase::FreezeInternals()
 {
 	// Print this until the MTVU problem in gifPathFreeze is taken care of (rama)
-	if (THREAD_VU1) Console.Warning("MTVU speedhack is enabled, saved states may not be stable");
+	if (THREAD_VU1 && !IsTransient()) Console.Warning("MTVU speedhack is enabled, saved states may not be stable");
 	
 	// Second Block - Various CPU Registers and States
 	// -----------------------------------------------
@@ -422,6 +429,47 @@ static void SysState_ComponentFreezeIn(zip_file_t* zf, SysState_Component comp)
 		throw std::runtime_error(std::string(" * ") + comp.name + std::string(": Error loading state!\n"));
 }
 
+static void SysState_ComponentFreezeIn(const u8* data, u32 size, SysState_Component comp)
+{
+	freezeData fP = { 0, nullptr };
+	if (comp.freeze(FreezeAction::Size, &fP) != 0)
+		fP.size = 0;
+
+	Console.Indent().WriteLn("Loading %s", comp.name);
+
+	// Components only read from the buffer when loading.
+	fP.data = const_cast<u8*>(data);
+	if (size < static_cast<u32>(fP.size) || comp.freeze(FreezeAction::Load, &fP) != 0)
+		throw std::runtime_error(std::string(" * ") + comp.name + std::string(": Error loading state!\n"));
+}
+
+// Overwrites the component's data of an earlier capture, see SaveState_CaptureToMemory(). These run
+// every frame, so unlike the functions above they don't log. Returns false if the size changed.
+static bool SysState_ComponentFreezeOutInPlace(u8* dest, u32 size, SysState_Component comp)
+{
+	freezeData fP = { 0, dest };
+	if (comp.freeze(FreezeAction::Size, &fP) != 0 || static_cast<u32>(fP.size) != size)
+		return false;
+
+	if (size > 0 && comp.freeze(FreezeAction::Save, &fP) != 0)
+		throw std::runtime_error(std::string(" * ") + comp.name + std::string(": Error saving state!\n"));
+
+	return true;
+}
+
+static bool SysState_ComponentRestoreInPlace(const u8* data, u32 size, SysState_Component comp)
+{
+	freezeData fP = { 0, nullptr };
+	if (comp.freeze(FreezeAction::Size, &fP) != 0 || static_cast<u32>(fP.size) != size)
+		return false;
+
+	fP.data = const_cast<u8*>(data);
+	if (size > 0 && comp.freeze(FreezeAction::Load, &fP) != 0)
+		throw std::runtime_error(std::string(" * ") + comp.name + std::string(": Error loading state!\n"));
+
+	return true;
+}
+
 static void SysState_ComponentFreezeOut(SaveStateBase& writer, SysState_Component comp)
 {
 	freezeData fP = { 0, NULL };
@@ -448,10 +496,30 @@ public:
 
 	virtual const char* GetFilename() const = 0;
 	virtual void FreezeIn(zip_file_t* zf) const = 0;
+	virtual void FreezeIn(const u8* data, u32 size) const = 0;
 	virtual void FreezeOut(SaveStateBase& writer) const = 0;
 	virtual bool IsRequired() const = 0;
+
+	// Incremental entries are written relative to the same entry of a base state, see
+	// SaveState_DownloadIncrementalState(). Everything else is always written in full.
+	virtual bool IsIncremental() const { return false; }
+	virtual void FreezeOutIncremental(SaveStateBase& writer, const u8* base, u32 base_size) const { FreezeOut(writer); }
+
+	// In place entries overwrite, or are restored from, the same entry of an earlier capture, see
+	// SaveState_CaptureToMemory(). Both return false if the entry no longer has the same size.
+	virtual bool FreezeOutInPlace(u8* dest, u32 size) const = 0;
+	virtual bool RestoreInPlace(const u8* data, u32 size) const = 0;
 };
 
+// Memory entries of incremental states are split into pages, and stored as the total size,
+// a bitmap of the pages which differ from the base state, and then those pages.
+static constexpr u32 SAVESTATE_PAGE_SIZE = 0x1000;
+
+static u32 SaveState_GetPageCount(u32 size)
+{
+	return (size + SAVESTATE_PAGE_SIZE - 1) / SAVESTATE_PAGE_SIZE;
+}
+
 class MemorySavestateEntry : public BaseSavestateEntry
 {
 protected:
@@ -460,12 +528,21 @@ protected:
 
 public:
 	virtual void FreezeIn(zip_file_t* zf) const;
+	virtual void FreezeIn(const u8* data, u32 size) const;
 	virtual void FreezeOut(SaveStateBase& writer) const;
 	virtual bool IsRequired() const { return true; }
+	virtual bool IsIncremental() const { return true; }
+	virtual void FreezeOutIncremental(SaveStateBase& writer, const u8* base, u32 base_size) const;
+	virtual bool FreezeOutInPlace(u8* dest, u32 size) const;
+	virtual bool RestoreInPlace(const u8* data, u32 size) const;
 
 protected:
 	virtual u8* GetDataPtr() const = 0;
 	virtual u32 GetDataSize() const = 0;
+	virtual bool IsPageDirty(u32 page, const u8* base, u32 base_size) const;
+
+	// Called for each page written back by RestoreInPlace(), so anything compiled from it can be dropped.
+	virtual void OnPageRestored(u32 offset, u32 size) const {}
 };
 
 void MemorySavestateEntry::FreezeIn(zip_file_t* zf) const
@@ -479,11 +556,98 @@ void MemorySavestateEntry::FreezeIn(zip_file_t* zf) const
 	}
 }
 
+void MemorySavestateEntry::FreezeIn(const u8* data, u32 size) const
+{
+	const u32 expectedSize = GetDataSize();
+	if (size < expectedSize)
+	{
+		Console.WriteLn(Color_Yellow, " '%s' is incomplete (expected 0x%x bytes, loading only 0x%x bytes)",
+			GetFilename(), expectedSize, size);
+	}
+
+	std::memcpy(GetDataPtr(), data, std::min(size, expectedSize));
+}
+
 void MemorySavestateEntry::FreezeOut(SaveStateBase& writer) const
 {
 	writer.FreezeMem(GetDataPtr(), GetDataSize());
 }
 
+bool MemorySavestateEntry::IsPageDirty(u32 page, const u8* base, u32 base_size) const
+{
+	const u32 size = GetDataSize();
+	if (!base || base_size != size)
+		return true;
+
+	const u32 offset = page * SAVESTATE_PAGE_SIZE;
+	return (std::memcmp(GetDataPtr() + offset, base + offset, std::min(SAVESTATE_PAGE_SIZE, size - offset)) != 0);
+}
+
+void MemorySavestateEntry::FreezeOutIncremental(SaveStateBase& writer, const u8* base, u32 base_size) const
+{
+	u32 size = GetDataSize();
+	const u32 page_count = SaveState_GetPageCount(size);
+	std::vector<u8> bitmap((page_count + 7) / 8);
+	for (u32 page = 0; page < page_count; page++)
+	{
+		if (IsPageDirty(page, base, base_size))
+			bitmap[page / 8] |= static_cast<u8>(1u << (page % 8));
+	}
+
+	writer.Freeze(size);
+	writer.FreezeMem(bitmap.data(), static_cast<int>(bitmap.size()));
+
+	u8* data = GetDataPtr();
+	for (u32 page = 0; page < page_count; page++)
+	{
+		if (bitmap[page / 8] & (1u << (page % 8)))
+		{
+			const u32 offset = page * SAVESTATE_PAGE_SIZE;
+			writer.FreezeMem(data + offset, static_cast<int>(std::min(SAVESTATE_PAGE_SIZE, size - offset)));
+		}
+	}
+}
+
+bool MemorySavestateEntry::FreezeOutInPlace(u8* dest, u32 size) const
+{
+	if (size != GetDataSize())
+		return false;
+
+	const u8* data = GetDataPtr();
+	const u32 page_count = SaveState_GetPageCount(size);
+	for (u32 page = 0; page < page_count; page++)
+	{
+		if (!IsPageDirty(page, dest, size))
+			continue;
+
+		const u32 offset = page * SAVESTATE_PAGE_SIZE;
+		std::memcpy(dest + offset, data + offset, std::min(SAVESTATE_PAGE_SIZE, size - offset));
+	}
+
+	return true;
+}
+
+bool MemorySavestateEntry::RestoreInPlace(const u8* data, u32 size) const
+{
+	if (size != GetDataSize())
+		return false;
+
+	u8* dest = GetDataPtr();
+	const u32 page_count = SaveState_GetPageCount(size);
+	for (u32 page = 0; page < page_count; page++)
+	{
+		if (!IsPageDirty(page, data, size))
+			continue;
+
+		const u32 offset = page * SAVESTATE_PAGE_SIZE;
+		const u32 page_size = std::min(SAVESTATE_PAGE_SIZE, size - offset);
+		std::memcpy(dest + offset, data + offset, page_size);
+		OnPageRestored(offset, page_size);
+	}
+
+	return true;
+}
+
 // --------------------------------------------------------------------------------------
 //  SavestateEntry_* (EmotionMemory, IopMemory, etc)
 // --------------------------------------------------------------------------------------
@@ -505,8 +669,24 @@ public:
 	virtual void FreezeIn(zip_file_t* zf) const
 	{
 		SysClearExecutionCache();
+		mmap_StopDirtyTracking();
 		MemorySavestateEntry::FreezeIn(zf);
 	}
+
+	virtual void FreezeIn(const u8* data, u32 size) const
+	{
+		SysClearExecutionCache();
+		mmap_StopDirtyTracking();
+		MemorySavestateEntry::FreezeIn(data, size);
+	}
+
+protected:
+	// Main ram is too large to compare, so writes to it are tracked with page protection instead.
+	// Restoring a page holding recompiled code faults, and the fault handler clears its blocks.
+	virtual bool IsPageDirty(u32 page, const u8* base, u32 base_size) const
+	{
+		return (!base || base_size != GetDataSize() || mmap_IsRamPageDirty(page));
+	}
 };
 
 class SavestateEntry_IopMemory : public MemorySavestateEntry
@@ -517,6 +697,9 @@ public:
 	const char* GetFilename() const { return "iopMemory.bin"; }
 	u8* GetDataPtr() const { return iopMem->Main; }
 	uint GetDataSize() const { return sizeof(iopMem->Main); }
+
+protected:
+	void OnPageRestored(u32 offset, u32 size) const { psxCpu->Clear(offset, size / 4); }
 };
 
 class SavestateEntry_HwRegs : public MemorySavestateEntry
@@ -577,6 +760,9 @@ public:
 	const char* GetFilename() const { return "vu0MicroMem.bin"; }
 	u8* GetDataPtr() const { return vuRegs[0].Micro; }
 	uint GetDataSize() const { return VU0_PROGSIZE; }
+
+protected:
+	void OnPageRestored(u32 offset, u32 size) const { CpuVU0->Clear(offset, size); }
 };
 
 class SavestateEntry_VU1prog : public MemorySavestateEntry
@@ -587,6 +773,9 @@ public:
 	const char* GetFilename() const { return "vu1MicroMem.bin"; }
 	u8* GetDataPtr() const { return vuRegs[1].Micro; }
 	uint GetDataSize() const { return VU1_PROGSIZE; }
+
+protected:
+	void OnPageRestored(u32 offset, u32 size) const { CpuVU1->Clear(offset, size); }
 };
 
 class SavestateEntry_SPU2 : public BaseSavestateEntry
@@ -596,7 +785,10 @@ public:
 
 	const char* GetFilename() const { return "SPU2.bin"; }
 	void FreezeIn(zip_file_t* zf) const { return SysState_ComponentFreezeIn(zf, SPU2); }
+	void FreezeIn(const u8* data, u32 size) const { return SysState_ComponentFreezeIn(data, size, SPU2); }
 	void FreezeOut(SaveStateBase& writer) const { return SysState_ComponentFreezeOut(writer, SPU2); }
+	bool FreezeOutInPlace(u8* dest, u32 size) const { return SysState_ComponentFreezeOutInPlace(dest, size, SPU2); }
+	bool RestoreInPlace(const u8* data, u32 size) const { return SPU2RestoreInPlace(data, size); }
 	bool IsRequired() const { return true; }
 };
 
@@ -607,7 +799,10 @@ public:
 
 	const char* GetFilename() const { return "USB.bin"; }
 	void FreezeIn(zip_file_t* zf) const { return SysState_ComponentFreezeIn(zf, USB); }
+	void FreezeIn(const u8* data, u32 size) const { return SysState_ComponentFreezeIn(data, size, USB); }
 	void FreezeOut(SaveStateBase& writer) const { return SysState_ComponentFreezeOut(writer, USB); }
+	bool FreezeOutInPlace(u8* dest, u32 size) const { return SysState_ComponentFreezeOutInPlace(dest, size, USB); }
+	bool RestoreInPlace(const u8* data, u32 size) const { return SysState_ComponentRestoreInPlace(data, size, USB); }
 	bool IsRequired() const { return false; }
 };
 
@@ -618,7 +813,10 @@ public:
 
 	const char* GetFilename() const { return "PAD.bin"; }
 	void FreezeIn(zip_file_t* zf) const { return SysState_ComponentFreezeIn(zf, PAD_); }
+	void FreezeIn(const u8* data, u32 size) const { return SysState_ComponentFreezeIn(data, size, PAD_); }
 	void FreezeOut(SaveStateBase& writer) const { return SysState_ComponentFreezeOut(writer, PAD_); }
+	bool FreezeOutInPlace(u8* dest, u32 size) const { return SysState_ComponentFreezeOutInPlace(dest, size, PAD_); }
+	bool RestoreInPlace(const u8* data, u32 size) const { return SysState_ComponentRestoreInPlace(data, size, PAD_); }
 	bool IsRequired() const { return true; }
 };
 
@@ -629,7 +827,10 @@ public:
 
 	const char* GetFilename() const { return "GS.bin"; }
 	void FreezeIn(zip_file_t* zf) const { return SysState_ComponentFreezeIn(zf, GS); }
+	void FreezeIn(const u8* data, u32 size) const { return SysState_ComponentFreezeIn(data, size, GS); }
 	void FreezeOut(SaveStateBase& writer) const { return SysState_ComponentFreezeOut(writer, GS); }
+	bool FreezeOutInPlace(u8* dest, u32 size) const { return SysState_ComponentFreezeOutInPlace(dest, size, GS); }
+	bool RestoreInPlace(const u8* data, u32 size) const { return SysState_ComponentRestoreInPlace(data, size, GS); }
 	bool IsRequired() const { return true; }
 };
 
@@ -658,18 +859,15 @@ static const std::unique_ptr<BaseSavestateEntry> SavestateEntries[] = {
 	std::unique_ptr<BaseSavestateEntry>(new SavestateEntry_GS),
 };
 
-std::unique_ptr<ArchiveEntryList> SaveState_DownloadState()
+// Writes the internal structures and then every entry in order, from the start of the list's buffer.
+static void SaveState_FreezeOutEntries(ArchiveEntryList* destlist, bool transient)
 {
-#ifndef PCSX2_CORE
-	if (!GetCoreThread().HasActiveMachine())
-		throw Exception::RuntimeError()
-			.SetDiagMsg("SysExecEvent_DownloadState: Cannot freeze/download an invalid VM state!")
-			.SetUserMsg("There is no active virtual machine state to download or save.");
-#endif
-
-	std::unique_ptr<ArchiveEntryList> destlist = std::make_unique<ArchiveEntryList>(new VmStateBuffer("Zippable Savestate"));
+	destlist->ClearEntries();
 
 	memSavingState saveme(destlist->GetBuffer());
+	if (transient)
+		saveme.SetTransient();
+
 	ArchiveEntry internals(EntryFilename_InternalStructures);
 	internals.SetDataIndex(saveme.GetCurrentPos());
 
@@ -688,7 +886,25 @@ std::unique_ptr<ArchiveEntryList> SaveState_DownloadState()
 				.SetDataIndex(startpos)
 				.SetDataSize(saveme.GetCurrentPos() - startpos));
 	}
+}
+
+// Throws if there's no VM state to download.
+static void SaveState_CheckDownloadable()
+{
+#ifndef PCSX2_CORE
+	if (!GetCoreThread().HasActiveMachine())
+		throw Exception::RuntimeError()
+			.SetDiagMsg("SysExecEvent_DownloadState: Cannot freeze/download an invalid VM state!")
+			.SetUserMsg("There is no active virtual machine state to download or save.");
+#endif
+}
 
+std::unique_ptr<ArchiveEntryList> SaveState_DownloadState()
+{
+	SaveState_CheckDownloadable();
+
+	std::unique_ptr<ArchiveEntryList> destlist = std::make_unique<ArchiveEntryList>(new VmStateBuffer("Zippable Savestate"));
+	SaveState_FreezeOutEntries(destlist.get(), false);
 	return destlist;
 }
 
@@ -858,13 +1074,255 @@ static bool SaveState_ReadScreenshot(zip_t* zf, u32* out_width, u32* out_height,
 }
 
 // --------------------------------------------------------------------------------------
-//  CompressThread_VmState
+//  Parallel entry (de)compression
 // --------------------------------------------------------------------------------------
-static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, SaveStateScreenshotData* screenshot)
+// libzip compresses and decompresses entries one at a time. The state entries are independent
+// of each other, so we (de)compress them ourselves on several threads. When saving, libzip is
+// given the already compressed data, which it copies into the archive as-is.
+
+struct SavestateCompressedEntry
+{
+	const u8* data = nullptr;
+	u32 size = 0;
+	u32 crc = 0;
+	u16 method = ZIP_CM_STORE;
+	bool ok = false;
+	std::vector<u8> compressed;
+
+	// read position for the zip source
+	size_t read_pos = 0;
+	zip_error_t error = {};
+};
+
+// Runs func on each job, spread over up to one thread per core, largest jobs first.
+template <typename T>
+static u32 SaveState_RunParallel(std::vector<T>& jobs, void (*func)(T& job))
+{
+	std::vector<T*> order;
+	order.reserve(jobs.size());
+	for (T& job : jobs)
+		order.push_back(&job);
+	std::sort(order.begin(), order.end(), [](const T* lhs, const T* rhs) { return lhs->size > rhs->size; });
+
+	const u32 num_threads = std::min(std::max(std::thread::hardware_concurrency(), 1u), static_cast<u32>(order.size()));
+	std::atomic<size_t> next_job{0};
+	const auto worker = [&order, &next_job, func]() {
+		for (;;)
+		{
+			const size_t index = next_job.fetch_add(1, std::memory_order_relaxed);
+			if (index >= order.size())
+				break;
+
+			func(*order[index]);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(num_threads);
+	for (u32 i = 1; i < num_threads; i++)
+		threads.emplace_back(worker);
+
+	worker();
+
+	for (std::thread& thread : threads)
+		thread.join();
+
+	return std::max(num_threads, 1u);
+}
+
+static void SaveState_CompressEntry(SavestateCompressedEntry& entry)
+{
+	entry.crc = static_cast<u32>(crc32(crc32(0L, Z_NULL, 0), entry.data, entry.size));
+
+	if (entry.method == ZIP_CM_ZSTD)
+	{
+		entry.compressed.resize(ZSTD_compressBound(entry.size));
+		const size_t compressed_size = ZSTD_compress(entry.compressed.data(), entry.compressed.size(), entry.data, entry.size, ZSTD_CLEVEL_DEFAULT);
+		if (ZSTD_isError(compressed_size))
+			return;
+
+		entry.compressed.resize(compressed_size);
+		entry.ok = true;
+		return;
+	}
+
+	// zip stores raw deflate streams, without the zlib header. Same parameters libzip uses when
+	// no compression level is given, which is what we used to pass it.
+	z_stream zs = {};
+	if (deflateInit2(&zs, Z_BEST_COMPRESSION, Z_DEFLATED, -MAX_WBITS, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK)
+		return;
+
+	entry.compressed.resize(deflateBound(&zs, entry.size));
+	zs.next_in = const_cast<Bytef*>(entry.data);
+	zs.avail_in = entry.size;
+	zs.next_out = entry.compressed.data();
+	zs.avail_out = static_cast<uInt>(entry.compressed.size());
+	const int res = deflate(&zs, Z_FINISH);
+	entry.compressed.resize(zs.total_out);
+	deflateEnd(&zs);
+	entry.ok = (res == Z_STREAM_END);
+}
+
+// Feeds compressed data to libzip. Reporting the compression method and CRC in the stat makes
+// libzip copy the data into the archive without recompressing it.
+static zip_int64_t SaveState_CompressedSourceCallback(void* userdata, void* data, zip_uint64_t len, zip_source_cmd_t cmd)
+{
+	SavestateCompressedEntry* entry = static_cast<SavestateCompressedEntry*>(userdata);
+	switch (cmd)
+	{
+		case ZIP_SOURCE_OPEN:
+			entry->read_pos = 0;
+			return 0;
+
+		case ZIP_SOURCE_READ:
+		{
+			const size_t count = std::min(static_cast<size_t>(len), entry->compressed.size() - entry->read_pos);
+			std::memcpy(data, entry->compressed.data() + entry->read_pos, count);
+			entry->read_pos += count;
+			return static_cast<zip_int64_t>(count);
+		}
+
+		case ZIP_SOURCE_CLOSE:
+		case ZIP_SOURCE_FREE:
+			return 0;
+
+		case ZIP_SOURCE_STAT:
+		{
+			zip_stat_t* st = ZIP_SOURCE_GET_ARGS(zip_stat_t, data, len, &entry->error);
+			if (!st)
+				return -1;
+
+			zip_stat_init(st);
+			st->valid = ZIP_STAT_SIZE | ZIP_STAT_COMP_SIZE | ZIP_STAT_COMP_METHOD | ZIP_STAT_CRC;
+			st->size = entry->size;
+			st->comp_size = entry->compressed.size();
+			st->comp_method = entry->method;
+			st->crc = entry->crc;
+			return sizeof(*st);
+		}
+
+		case ZIP_SOURCE_ERROR:
+			return zip_error_to_data(&entry->error, data, len);
+
+		case ZIP_SOURCE_SUPPORTS:
+			return zip_source_make_command_bitmap(ZIP_SOURCE_OPEN, ZIP_SOURCE_READ, ZIP_SOURCE_CLOSE, ZIP_SOURCE_STAT,
+				ZIP_SOURCE_ERROR, ZIP_SOURCE_FREE, -1);
+
+		default:
+			zip_error_set(&entry->error, ZIP_ER_OPNOTSUPP, 0);
+			return -1;
+	}
+}
+
+struct SavestateDecompressedEntry
+{
+	s64 index = -1;
+	u32 size = 0;
+	u32 crc = 0;
+	u16 method = ZIP_CM_STORE;
+	bool raw = false;
+	bool ok = false;
+	std::vector<u8> compressed;
+	std::vector<u8> data;
+};
+
+// Reads the entry without decompressing it. Returns false if it has to go through libzip instead.
+static bool SaveState_ReadRawEntry(zip_t* zf, SavestateDecompressedEntry& entry)
+{
+	constexpr zip_uint64_t required = ZIP_STAT_SIZE | ZIP_STAT_COMP_SIZE | ZIP_STAT_COMP_METHOD | ZIP_STAT_CRC;
+
+	zip_stat_t zst;
+	if (zip_stat_index(zf, entry.index, 0, &zst) != 0 || (zst.valid & required) != required ||
+		zst.size > std::numeric_limits<int>::max() || zst.comp_size > std::numeric_limits<int>::max() ||
+		((zst.valid & ZIP_STAT_ENCRYPTION_METHOD) && zst.encryption_method != ZIP_EM_NONE) ||
+		(zst.comp_method != ZIP_CM_STORE && zst.comp_method != ZIP_CM_DEFLATE && zst.comp_method != ZIP_CM_ZSTD))
+	{
+		return false;
+	}
+
+	auto zff = zip_fopen_index_managed(zf, entry.index, ZIP_FL_COMPRESSED);
+	if (!zff)
+		return false;
+
+	entry.compressed.resize(zst.comp_size);
+	if (zip_fread(zff.get(), entry.compressed.data(), zst.comp_size) != static_cast<zip_int64_t>(zst.comp_size))
+		return false;
+
+	entry.size = static_cast<u32>(zst.size);
+	entry.crc = zst.crc;
+	entry.method = zst.comp_method;
+	entry.raw = true;
+	return true;
+}
+
+static void SaveState_DecompressEntry(SavestateDecompressedEntry& entry)
+{
+	if (!entry.raw)
+		return;
+
+	if (entry.method == ZIP_CM_STORE)
+	{
+		if (entry.compressed.size() != entry.size)
+			return;
+
+		entry.data = std::move(entry.compressed);
+	}
+	else if (entry.method == ZIP_CM_ZSTD)
+	{
+		entry.data.resize(entry.size);
+		const size_t size = ZSTD_decompress(entry.data.data(), entry.data.size(), entry.compressed.data(), entry.compressed.size());
+		if (ZSTD_isError(size) || size != entry.size)
+			return;
+	}
+	else
+	{
+		z_stream zs = {};
+		if (inflateInit2(&zs, -MAX_WBITS) != Z_OK)
+			return;
+
+		entry.data.resize(entry.size);
+		zs.next_in = entry.compressed.data();
+		zs.avail_in = static_cast<uInt>(entry.compressed.size());
+		zs.next_out = entry.data.data();
+		zs.avail_out = entry.size;
+		const int res = inflate(&zs, Z_FINISH);
+		const uLong size = zs.total_out;
+		inflateEnd(&zs);
+		if (res != Z_STREAM_END || size != entry.size)
+			return;
+	}
+
+	std::vector<u8>().swap(entry.compressed);
+	entry.ok = (static_cast<u32>(crc32(crc32(0L, Z_NULL, 0), entry.data.data(), entry.size)) == entry.crc);
+}
+
+static std::vector<SavestateCompressedEntry> SaveState_CompressEntries(ArchiveEntryList* srclist)
 {
 	// use zstd compression, it can be 10x+ faster for saving.
-	const u32 compression = EmuConfig.SavestateZstdCompression ? ZIP_CM_ZSTD : ZIP_CM_DEFLATE;
-	const u32 compression_level = 0;
+	const u16 method = EmuConfig.SavestateZstdCompression ? ZIP_CM_ZSTD : ZIP_CM_DEFLATE;
+
+	Common::Timer timer;
+	std::vector<SavestateCompressedEntry> entries(srclist->GetLength());
+	for (uint i = 0; i < srclist->GetLength(); i++)
+	{
+		const ArchiveEntry& entry = (*srclist)[i];
+		entries[i].size = entry.GetDataSize();
+		entries[i].data = entries[i].size ? srclist->GetPtr(entry.GetDataIndex()) : nullptr;
+		entries[i].method = method;
+	}
+
+	const u32 num_threads = SaveState_RunParallel(entries, SaveState_CompressEntry);
+	DevCon.WriteLn("(SaveState) Compressed %zu entries in %.2f ms using %u threads.", entries.size(),
+		timer.GetTimeMilliseconds(), num_threads);
+	return entries;
+}
+
+// --------------------------------------------------------------------------------------
+//  CompressThread_VmState
+// --------------------------------------------------------------------------------------
+static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, std::vector<SavestateCompressedEntry>& compressed,
+	SaveStateScreenshotData* screenshot)
+{
 
 	// version indicator
 	{
@@ -890,7 +1348,14 @@ static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, SaveStateSc
 		if (!entry.GetDataSize())
 			continue;
 
-		zip_source_t* const zs = zip_source_buffer(zf, srclist->GetPtr(entry.GetDataIndex()), entry.GetDataSize(), 0);
+		SavestateCompressedEntry& centry = compressed[i];
+		if (!centry.ok)
+		{
+			Console.Error("(SaveState) Failed to compress '%s'", entry.GetFilename().c_str());
+			return false;
+		}
+
+		zip_source_t* const zs = zip_source_function(zf, SaveState_CompressedSourceCallback, &centry);
 		if (!zs)
 			return false;
 
@@ -901,7 +1366,8 @@ static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, SaveStateSc
 			return false;
 		}
 
-		zip_set_file_compression(zf, fi, compression, compression_level);
+		// must match the source, otherwise libzip will recompress it
+		zip_set_file_compression(zf, fi, centry.method, 0);
 	}
 
 	if (screenshot)
@@ -915,6 +1381,11 @@ static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, SaveStateSc
 
 bool SaveState_ZipToDisk(std::unique_ptr<ArchiveEntryList> srclist, std::unique_ptr<SaveStateScreenshotData> screenshot, const char* filename)
 {
+	Common::Timer timer;
+
+	// has to outlive the zip, the data is only read when it's closed
+	std::vector<SavestateCompressedEntry> compressed(SaveState_CompressEntries(srclist.get()));
+
 	zip_error_t ze = {};
 	zip_source_t* zs = zip_source_file_create(filename, 0, 0, &ze);
 	zip_t* zf = nullptr;
@@ -928,15 +1399,16 @@ bool SaveState_ZipToDisk(std::unique_ptr<ArchiveEntryList> srclist, std::unique_
 	}
 
 	// discard zip file if we fail saving something
-	if (!SaveState_AddToZip(zf, srclist.get(), screenshot.get()))
+	if (!SaveState_AddToZip(zf, srclist.get(), compressed, screenshot.get()))
 	{
 		Console.Error("Failed to save state to zip file '%s'", filename);
 		zip_discard(zf);
 		return false;
 	}
 
-	// force the zip to close, this is the expensive part with libzip.
+	// force the zip to close, the entries are already compressed so this is mostly I/O.
 	zip_close(zf);
+	Console.WriteLn("(SaveState) Saved state to '%s' in %.2f ms.", filename, timer.GetTimeMilliseconds());
 	return true;
 }
 
@@ -1048,12 +1520,40 @@ void SaveState_UnzipFromDisk(const std::string& filename)
 
 	if (!throwIt)
 	{
+		Common::Timer timer;
+
+		// Pull the compressed entries out first, then decompress them all at once.
+		std::vector<SavestateDecompressedEntry> entries(std::size(SavestateEntries));
 		for (u32 i = 0; i < std::size(SavestateEntries); ++i)
 		{
-			if (entryIndices[i] < 0)
+			entries[i].index = entryIndices[i];
+			if (entries[i].index >= 0)
+				SaveState_ReadRawEntry(zf.get(), entries[i]);
+		}
+
+		const u32 num_threads = SaveState_RunParallel(entries, SaveState_DecompressEntry);
+		const double decompress_time = timer.GetTimeMilliseconds();
+
+		for (u32 i = 0; i < std::size(SavestateEntries); ++i)
+		{
+			const SavestateDecompressedEntry& entry = entries[i];
+			if (entry.index < 0)
 				continue;
 
-			auto zff = zip_fopen_index_managed(zf.get(), entryIndices[i], 0);
+			if (entry.raw)
+			{
+				if (!entry.ok)
+				{
+					Console.Error("(SaveState) Failed to decompress '%s'", SavestateEntries[i]->GetFilename());
+					throwIt = true;
+					break;
+				}
+
+				SavestateEntries[i]->FreezeIn(entry.data.data(), entry.size);
+				continue;
+			}
+
+			auto zff = zip_fopen_index_managed(zf.get(), entry.index, 0);
 			if (!zff)
 			{
 				throwIt = true;
@@ -1062,6 +1562,12 @@ void SaveState_UnzipFromDisk(const std::string& filename)
 
 			SavestateEntries[i]->FreezeIn(zff.get());
 		}
+
+		if (!throwIt)
+		{
+			Console.WriteLn("(SaveState) Loaded state from '%s' in %.2f ms (%.2f ms decompressing using %u threads).",
+				filename.c_str(), timer.GetTimeMilliseconds(), decompress_time, num_threads);
+		}
 	}
 
 	if (throwIt)
@@ -1073,3 +1579,253 @@ void SaveState_UnzipFromDisk(const std::string& filename)
 
 	PostLoadPrep();
 }
+
+// Memory states have to come from SaveState_DownloadState() or SaveState_DownloadIncrementalState(),
+// which write the internal structures first and then the entries in order.
+static bool SaveState_IsMemoryStateLayoutValid(const ArchiveEntryList& list)
+{
+	const uint listlen = list.GetLength();
+	if (listlen != (std::size(SavestateEntries) + 1) || list[0].GetFilename() != EntryFilename_InternalStructures)
+		return false;
+
+	for (uint i = 1; i < listlen; i++)
+	{
+		if (list[i].GetFilename() != SavestateEntries[i - 1]->GetFilename())
+			return false;
+	}
+
+	return true;
+}
+
+static void SaveState_ThrowInvalidMemoryState(const char* msg)
+{
+	throw Exception::SaveStateLoadError()
+		.SetDiagMsg(msg)
+		.SetUserMsg("This savestate cannot be loaded due to missing critical components.  See the log file for details.");
+}
+
+std::unique_ptr<ArchiveEntryList> SaveState_DownloadIncrementalState(const ArchiveEntryList* base)
+{
+	SaveState_CheckDownloadable();
+
+	if (base && !SaveState_IsMemoryStateLayoutValid(*base))
+		base = nullptr;
+
+	std::unique_ptr<ArchiveEntryList> destlist = std::make_unique<ArchiveEntryList>(new VmStateBuffer("Incremental Savestate"));
+
+	memSavingState saveme(destlist->GetBuffer());
+	ArchiveEntry internals(EntryFilename_InternalStructures);
+	internals.SetDataIndex(saveme.GetCurrentPos());
+
+	saveme.FreezeBios();
+	saveme.FreezeInternals();
+
+	internals.SetDataSize(saveme.GetCurrentPos() - internals.GetDataIndex());
+	destlist->Add(internals);
+
+	for (uint i = 0; i < std::size(SavestateEntries); i++)
+	{
+		const uint startpos = saveme.GetCurrentPos();
+		if (base && (*base)[i + 1].GetDataSize() > 0)
+		{
+			const ArchiveEntry& base_entry = (*base)[i + 1];
+			SavestateEntries[i]->FreezeOutIncremental(saveme, base->GetPtr(base_entry.GetDataIndex()), base_entry.GetDataSize());
+		}
+		else
+		{
+			SavestateEntries[i]->FreezeOutIncremental(saveme, nullptr, 0);
+		}
+
+		destlist->Add(
+			ArchiveEntry(SavestateEntries[i]->GetFilename())
+				.SetDataIndex(startpos)
+				.SetDataSize(saveme.GetCurrentPos() - startpos));
+	}
+
+	// The next capture only needs the main ram pages written from here on.
+	mmap_StartDirtyTracking();
+
+	return destlist;
+}
+
+std::unique_ptr<ArchiveEntryList> SaveState_ApplyIncrementalState(const ArchiveEntryList* base, const ArchiveEntryList& incremental)
+{
+	if (!SaveState_IsMemoryStateLayoutValid(incremental) || (base && !SaveState_IsMemoryStateLayoutValid(*base)))
+		SaveState_ThrowInvalidMemoryState("Incremental savestate does not match the current layout.");
+
+	// Work out the final size up front, so the buffer is only allocated once.
+	u32 total_size = 0;
+	for (uint i = 0; i < incremental.GetLength(); i++)
+	{
+		const ArchiveEntry& entry = incremental[i];
+		u32 entry_size = entry.GetDataSize();
+		if (i > 0 && SavestateEntries[i - 1]->IsIncremental())
+		{
+			if (entry_size < sizeof(u32))
+				SaveState_ThrowInvalidMemoryState("Incremental savestate entry is truncated.");
+			std::memcpy(&entry_size, incremental.GetPtr(entry.GetDataIndex()), sizeof(entry_size));
+		}
+		total_size += entry_size;
+	}
+
+	std::unique_ptr<ArchiveEntryList> destlist = std::make_unique<ArchiveEntryList>(new VmStateBuffer(total_size, "Zippable Savestate"));
+	u32 pos = 0;
+	for (uint i = 0; i < incremental.GetLength(); i++)
+	{
+		const ArchiveEntry& entry = incremental[i];
+		const u8* src = entry.GetDataSize() ? incremental.GetPtr(entry.GetDataIndex()) : nullptr;
+		const u32 src_size = entry.GetDataSize();
+
+		if (i == 0 || !SavestateEntries[i - 1]->IsIncremental())
+		{
+			if (src_size > 0)
+				std::memcpy(destlist->GetPtr(pos), src, src_size);
+			destlist->Add(ArchiveEntry(entry.GetFilename()).SetDataIndex(pos).SetDataSize(src_size));
+			pos += src_size;
+			continue;
+		}
+
+		u32 size;
+		std::memcpy(&size, src, sizeof(size));
+		const u32 page_count = SaveState_GetPageCount(size);
+		const u32 bitmap_size = (page_count + 7) / 8;
+		if (src_size < (sizeof(size) + bitmap_size))
+			SaveState_ThrowInvalidMemoryState("Incremental savestate entry is truncated.");
+
+		const u8* bitmap = src + sizeof(size);
+		const u8* page_src = bitmap + bitmap_size;
+		const u8* page_end = src + src_size;
+
+		const u8* base_data = nullptr;
+		if (base && (*base)[i].GetDataSize() == size && size > 0)
+			base_data = base->GetPtr((*base)[i].GetDataIndex());
+
+		u8* dst = size ? destlist->GetPtr(pos) : nullptr;
+		for (u32 page = 0; page < page_count; page++)
+		{
+			const u32 offset = page * SAVESTATE_PAGE_SIZE;
+			const u32 page_size = std::min(SAVESTATE_PAGE_SIZE, size - offset);
+			if (bitmap[page / 8] & (1u << (page % 8)))
+			{
+				if (static_cast<u32>(page_end - page_src) < page_size)
+					SaveState_ThrowInvalidMemoryState("Incremental savestate entry is truncated.");
+
+				std::memcpy(dst + offset, page_src, page_size);
+				page_src += page_size;
+			}
+			else if (base_data)
+			{
+				std::memcpy(dst + offset, base_data + offset, page_size);
+			}
+			else
+			{
+				SaveState_ThrowInvalidMemoryState("Incremental savestate refers to a page missing from its base.");
+			}
+		}
+
+		destlist->Add(ArchiveEntry(entry.GetFilename()).SetDataIndex(pos).SetDataSize(size));
+		pos += size;
+	}
+
+	return destlist;
+}
+
+void SaveState_LoadFromMemory(ArchiveEntryList* srclist)
+{
+	if (!SaveState_IsMemoryStateLayoutValid(*srclist))
+		SaveState_ThrowInvalidMemoryState("Memory savestate does not match the current layout.");
+
+	const uint listlen = srclist->GetLength();
+	PreLoadPrep();
+
+	memLoadingState(srclist->GetBuffer()).FreezeBios().FreezeInternals();
+
+	for (uint i = 1; i < listlen; i++)
+	{
+		const ArchiveEntry& entry = (*srclist)[i];
+		if (entry.GetDataSize() == 0)
+			continue;
+
+		SavestateEntries[i - 1]->FreezeIn(srclist->GetPtr(entry.GetDataIndex()), entry.GetDataSize());
+	}
+
+	PostLoadPrep();
+}
+
+void SaveState_CaptureToMemory(ArchiveEntryList* list)
+{
+	if (THREAD_VU1)
+		vu1Thread.WaitVU();
+
+	// The internal structures come first, so if their size is unchanged everything else stays put.
+	memSavingState saveme(list->GetBuffer());
+	saveme.SetTransient();
+	saveme.FreezeBios();
+	saveme.FreezeInternals();
+
+	bool in_place = (SaveState_IsMemoryStateLayoutValid(*list) && (*list)[0].GetDataSize() == saveme.GetCurrentPos());
+	for (uint i = 1; in_place && i < list->GetLength(); i++)
+	{
+		const ArchiveEntry& entry = (*list)[i];
+		in_place = SavestateEntries[i - 1]->FreezeOutInPlace(entry.GetDataSize() ? list->GetPtr(entry.GetDataIndex()) : nullptr,
+			entry.GetDataSize());
+	}
+
+	if (!in_place)
+		SaveState_FreezeOutEntries(list, true);
+
+	// The next capture or restore only needs the main ram pages written from here on.
+	mmap_StartDirtyTracking();
+}
+
+void SaveState_RestoreFromMemory(const ArchiveEntryList* list)
+{
+	if (!SaveState_IsMemoryStateLayoutValid(*list))
+		SaveState_ThrowInvalidMemoryState("Memory savestate does not match the current layout.");
+
+	// Unlike PreLoadPrep(), the recompilers are kept, only the pages which changed are cleared.
+	if (THREAD_VU1)
+		vu1Thread.WaitVU();
+	GetMTGS().WaitGS(false);
+
+	tlbs old_tlb[std::size(tlb)];
+	std::memcpy(old_tlb, tlb, sizeof(tlb));
+
+	memLoadingState(list->GetBuffer()).SetTransient().FreezeBios().FreezeInternals();
+
+	for (uint i = 1; i < list->GetLength(); i++)
+	{
+		const ArchiveEntry& entry = (*list)[i];
+		if (!SavestateEntries[i - 1]->RestoreInPlace(entry.GetDataSize() ? list->GetPtr(entry.GetDataIndex()) : nullptr,
+				entry.GetDataSize()))
+		{
+			SaveState_ThrowInvalidMemoryState("Memory savestate entry does not match the current size.");
+		}
+	}
+
+	// Only the TLB entries which changed need remapping. The old mappings are removed first, since
+	// mapping a new entry doesn't clear pages it no longer covers.
+	bool tlb_changed = false;
+	for (int i = 0; i < static_cast<int>(std::size(tlb)); i++)
+	{
+		if (std::memcmp(&old_tlb[i], &tlb[i], sizeof(tlbs)) == 0)
+			continue;
+
+		const tlbs restored = tlb[i];
+		tlb[i] = old_tlb[i];
+		UnmapTLB(i);
+		tlb[i] = restored;
+		tlb_changed = true;
+	}
+	if (tlb_changed)
+	{
+		for (int i = 0; i < static_cast<int>(std::size(tlb)); i++)
+			MapTLB(i);
+	}
+
+	resetCache();
+	if (EmuConfig.Gamefixes.GoemonTlbHack)
+		GoemonPreloadTlb();
+
+	mmap_StartDirtyTracking();
+}
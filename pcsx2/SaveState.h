@@ -65,6 +65,27 @@ extern bool SaveState_ZipToDisk(std::unique_ptr<ArchiveEntryList> srclist, std::
 extern bool SaveState_ReadScreenshot(const std::string& filename, u32* out_width, u32* out_height, std::vector<u32>* out_pixels);
 extern void SaveState_UnzipFromDisk(const std::string& filename);
 
+// Loads a state produced by SaveState_DownloadState() straight from memory, without going through a zip.
+extern void SaveState_LoadFromMemory(ArchiveEntryList* srclist);
+
+// Captures a state which only holds the memory pages that differ from base. base has to be the
+// full state of the previous incremental capture (or null), as main ram is tracked by page
+// protection since that capture rather than compared. Only one caller may use this at a time.
+extern std::unique_ptr<ArchiveEntryList> SaveState_DownloadIncrementalState(const ArchiveEntryList* base);
+
+// Rebuilds the full state described by an incremental state and the base it was captured against.
+extern std::unique_ptr<ArchiveEntryList> SaveState_ApplyIncrementalState(const ArchiveEntryList* base, const ArchiveEntryList& incremental);
+
+// Captures the current state into list, reusing its buffer. If list already holds a capture with the
+// same layout, only the memory pages which changed since then are copied, main ram being tracked by page
+// protection since the last capture or restore. Only one caller may use this at a time, and it shares
+// the tracking with SaveState_DownloadIncrementalState().
+extern void SaveState_CaptureToMemory(ArchiveEntryList* list);
+
+// Restores a state made by SaveState_CaptureToMemory() in place. Only the pages which changed are
+// written back and only the code compiled from them is dropped, so this is cheap enough to do per frame.
+extern void SaveState_RestoreFromMemory(const ArchiveEntryList* list);
+
 // --------------------------------------------------------------------------------------
 //  SaveStateBase class
 // --------------------------------------------------------------------------------------
@@ -81,6 +102,8 @@ protected:
 
 	int m_idx;			// current read/write index of the allocation
 
+	bool m_transient;	// state only lives in memory for a few frames, see SetTransient()
+
 public:
 	SaveStateBase( VmStateBuffer& memblock );
 	SaveStateBase( VmStateBuffer* memblock );
@@ -97,6 +120,16 @@ public:
 		return (m_version & 0xffff);
 	}
 
+	// Transient states are captured and restored every frame (run-ahead), and never leave the
+	// session, so they skip the memory card checksums and the stability warnings.
+	SaveStateBase& SetTransient()
+	{
+		m_transient = true;
+		return *this;
+	}
+
+	bool IsTransient() const { return m_transient; }
+
 	virtual SaveStateBase& FreezeBios();
 	virtual SaveStateBase& FreezeInternals();
 
@@ -295,6 +328,11 @@ public:
 		return *this;
 	}
 
+	void ClearEntries()
+	{
+		m_list.clear();
+	}
+
 	size_t GetLength() const
 	{
 		return m_list.size();
@@ -1021,16 +1021,18 @@ void SaveStateBase::sioFreeze()
 	FreezeTag( "sio" );
 	Freeze( sio );
 
+	// Checksumming reads every card in full, which transient states can't afford, and they are
+	// only ever restored into the same session anyway.
 	if( IsSaving() )
 	{
 		for( uint port=0; port<2; ++port )
 			for( uint slot=0; slot<4; ++slot )
-				m_mcdCRCs[port][slot] = mcds[port][slot].GetChecksum();
+				m_mcdCRCs[port][slot] = IsTransient() ? 0 : mcds[port][slot].GetChecksum();
 	}
 
 	Freeze( m_mcdCRCs );
 
-	if( IsLoading() && EmuConfig.McdEnableEjection )
+	if( IsLoading() && EmuConfig.McdEnableEjection && !IsTransient() )
 	{
 		// Notes on the ForceEjectionTimeout:
 		//  * TOTA works with values as low as 20 here.
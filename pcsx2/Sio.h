@@ -17,6 +17,10 @@
 
 #include "MemoryCardFile.h"
 
+#ifdef PCSX2_CORE
+#include "RunAhead.h"
+#endif
+
 struct _mcd
 {
 	u8 term; // terminator value;
@@ -46,6 +50,9 @@ struct _mcd
 
 	void EraseBlock()
 	{
+		if (IsWriteRolledBack())
+			return;
+
 		FileMcd_EraseBlock(port, slot, transferAddr);
 	}
 
@@ -58,9 +65,23 @@ struct _mcd
 	// Write to memorycard from src
 	void Write(u8 *src, int size) 
 	{
+		if (IsWriteRolledBack())
+			return;
+
 		FileMcd_Save(port, slot, src,transferAddr, size);
 	}
 
+	// Frames emulated ahead are rolled back, so their writes must not reach the card.
+	static bool IsWriteRolledBack()
+	{
+#ifdef PCSX2_CORE
+		RunAhead::OnMemoryCardWrite();
+		return RunAhead::IsRunningAhead();
+#else
+		return false;
+#endif
+	}
+
 	bool IsPresent()
 	{
 		return FileMcd_IsPresent(port, slot);
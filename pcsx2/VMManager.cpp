@@ -45,6 +45,8 @@
 #include "Patch.h"
 #include "PerformanceMetrics.h"
 #include "R5900.h"
+#include "Rewind.h"
+#include "RunAhead.h"
 #include "SPU2/spu2.h"
 #include "DEV9/DEV9.h"
 #include "USB/USB.h"
@@ -957,6 +959,8 @@ bool VMManager::Initialize(const VMBootParameters& boot_params)
 	SetEmuThreadAffinities();
 
 	PerformanceMetrics::Clear();
+	Rewind::UpdateSettings();
+	RunAhead::UpdateSettings();
 
 	// do we want to load state?
 	if (!GSDumpReplayer::IsReplayingDump() && !state_to_load.empty())
@@ -995,6 +999,10 @@ void VMManager::Shutdown(bool save_resume_state)
 		GSDumpReplayer::Shutdown();
 	}
 
+	Rewind::Shutdown();
+	RunAhead::Shutdown();
+	frameLimitLogStatistics();
+
 	{
 		std::unique_lock lock(s_info_mutex);
 		s_disc_path.clear();
@@ -1049,6 +1057,8 @@ void VMManager::Reset()
 	s_active_widescreen_patches = 0;
 	s_active_no_interlacing_patches = 0;
 	s_limiter_mode_prior_to_hold_interaction.reset();
+	Rewind::Clear();
+	RunAhead::Clear();
 
 	SysClearExecutionCache();
 	memBindConditionalHandlers();
@@ -1122,6 +1132,8 @@ bool VMManager::DoLoadState(const char* filename)
 	try
 	{
 		Host::OnSaveStateLoading(filename);
+		Rewind::Clear();
+		RunAhead::Clear();
 		SaveState_UnzipFromDisk(filename);
 
 		// HACK: LastELF isn't in the save state...
@@ -1414,6 +1426,10 @@ void VMManager::Internal::VSyncOnCPUThread()
 	ApplyLoadedPatches(PPT_CONTINUOUSLY);
 	ApplyLoadedPatches(PPT_COMBINED_0_1);
 
+	// Frames emulated ahead reuse the input of the real frame, and are never paused on.
+	if (RunAhead::IsRunningAhead())
+		return;
+
 	// Frame advance must be done *before* pumping messages, because otherwise
 	// we'll immediately reduce the counter we just set.
 	if (s_frame_advance_count > 0)
@@ -1428,6 +1444,10 @@ void VMManager::Internal::VSyncOnCPUThread()
 
 	Host::PumpMessagesOnCPUThread();
 	InputManager::PollSources();
+
+	// Both track main ram writes, so rewind captures stop while running ahead.
+	if (EmuConfig.RunAheadFrames == 0)
+		Rewind::OnVSync();
 }
 
 void VMManager::CheckForCPUConfigChanges(const Pcsx2Config& old_config)
@@ -1618,6 +1638,20 @@ void VMManager::CheckForConfigChanges(const Pcsx2Config& old_config)
 	{
 		VMManager::ReloadPatches(true, true);
 	}
+
+	if (EmuConfig.EnableRewind != old_config.EnableRewind ||
+		EmuConfig.RewindFrequency != old_config.RewindFrequency ||
+		EmuConfig.RewindBufferSize != old_config.RewindBufferSize)
+	{
+		Rewind::UpdateSettings();
+	}
+
+	if (EmuConfig.RunAheadFrames != old_config.RunAheadFrames)
+	{
+		// The rewind head no longer matches the pages tracked since it was captured.
+		Rewind::Clear();
+		RunAhead::UpdateSettings();
+	}
 }
 
 void VMManager::ApplySettings()
@@ -1768,6 +1802,10 @@ DEFINE_HOTKEY("HoldTurbo", "System", "Turbo (Hold)", [](s32 pressed) {
 		s_limiter_mode_prior_to_hold_interaction.reset();
 	}
 })
+DEFINE_HOTKEY("Rewind", "System", "Rewind (Hold)", [](s32 pressed) {
+	if (pressed >= 0 && VMManager::HasValidVM())
+		Rewind::SetRewinding(pressed > 0);
+})
 DEFINE_HOTKEY("IncreaseSpeed", "System", "Increase Target Speed", [](s32 pressed) {
 	if (!pressed)
 		HotkeyAdjustTargetSpeed(0.1);
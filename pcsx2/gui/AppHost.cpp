@@ -84,6 +84,19 @@ std::optional<std::string> Host::ReadResourceFileToString(const char* filename)
 	return ret;
 }
 
+std::optional<std::time_t> Host::GetResourceFileTimestamp(const char* filename)
+{
+	const std::string full_filename(Path::Combine(EmuFolders::Resources, filename));
+	FILESYSTEM_STAT_DATA sd;
+	if (!FileSystem::StatFile(full_filename.c_str(), &sd))
+	{
+		Console.Error("Failed to stat resource file '%s'", filename);
+		return std::nullopt;
+	}
+
+	return sd.ModificationTime;
+}
+
 bool Host::GetBoolSettingValue(const char* section, const char* key, bool default_value /* = false */)
 {
 	return default_value;
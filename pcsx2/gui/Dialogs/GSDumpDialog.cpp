@@ -780,7 +780,7 @@ void Dialogs::GSDumpDialog::ProcessDumpEvent(const GSDumpFile::GSData& event, u8
 		}
 		case GSType::VSync:
 		{
-			GSvsync((*((int*)(regs + 4096)) & 0x2000) > 0 ? (u8)0 : (u8)1, false);
+			GSvsync((*((int*)(regs + 4096)) & 0x2000) > 0 ? (u8)0 : (u8)1, false, false, false);
 			g_FrameCount++;
 			break;
 		}
@@ -881,7 +881,7 @@ void Dialogs::GSDumpDialog::GSThread::ExecuteTaskInThread()
 		return;
 	}
 
-	GSvsync(1, false);
+	GSvsync(1, false, false, false);
 	GSreset(false);
 	GSfreeze(FreezeAction::Load, &fd);
 
@@ -189,7 +189,6 @@ namespace Panels
 
 	protected:
 		void OnRestoreDefaults(wxCommandEvent& evt);
-		void EECache_Event(wxCommandEvent& evt);
 	};
 
 	class CpuPanelVU : public BaseApplicableConfigPanel_SpecificConfig
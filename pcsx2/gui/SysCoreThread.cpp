@@ -370,6 +370,7 @@ void SysCoreThread::OnCleanupInThread()
 	m_hasActiveMachine = false;
 	m_resetVirtualMachine = true;
 
+	frameLimitLogStatistics();
 	R3000A::ioman::reset();
 	vu1Thread.Close();
 	USBclose();
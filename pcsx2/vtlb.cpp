@@ -80,34 +80,14 @@ vtlb_private::VTLBVirtual::VTLBVirtual(VTLBPhysical phys, u32 paddr, u32 vaddr)
 
 __inline int CheckCache(u32 addr)
 {
-	u32 mask;
-
 	if(((cpuRegs.CP0.n.Config >> 16) & 0x1) == 0) 
 	{
 		//DevCon.Warning("Data Cache Disabled! %x", cpuRegs.CP0.n.Config);
 		return false;//
 	}
 
-	for(int i = 1; i < 48; i++)
-	{
-		if (((tlb[i].EntryLo1 & 0x38) >> 3) == 0x3) {
-			mask  = tlb[i].PageMask;
-			
-			if ((addr >= tlb[i].PFN1) && (addr <= tlb[i].PFN1 + mask)) {
-				//DevCon.Warning("Yay! Cache check cache addr=%x, mask=%x, addr+mask=%x, VPN2=%x PFN0=%x", addr, mask, (addr & mask), tlb[i].VPN2, tlb[i].PFN0); 
-				return true;
-			}
-		}
-		if (((tlb[i].EntryLo0 & 0x38) >> 3) == 0x3) {
-			mask  = tlb[i].PageMask;
-			
-			if ((addr >= tlb[i].PFN0) && (addr <= tlb[i].PFN0 + mask)) {
-				//DevCon.Warning("Yay! Cache check cache addr=%x, mask=%x, addr+mask=%x, VPN2=%x PFN0=%x", addr, mask, (addr & mask), tlb[i].VPN2, tlb[i].PFN0); 
-				return true;
-			}
-		}
-	}
-	return false;
+	// Set by MapTLB for pages mapped through a TLB entry with the cacheable (C=3) attribute.
+	return vtlbdata.cmap[addr >> VTLB_PAGE_BITS];
 }
 // --------------------------------------------------------------------------------------
 // Interpreter Implementations of VTLB Memory Operations.
@@ -122,24 +102,21 @@ DataType vtlb_memRead(u32 addr)
 
 	if (!vmv.isHandler(addr))
 	{
-		if (!CHECK_EEREC) 
+		if(!CHECK_EEREC && CHECK_CACHE && CheckCache(addr)) 
 		{
-			if(CHECK_CACHE && CheckCache(addr)) 
+			switch( DataSize )
 			{
-				switch( DataSize )
-				{
-					case 8: 
-						return readCache8(addr);
-						break;
-					case 16: 
-						return readCache16(addr);
-						break;
-					case 32: 
-						return readCache32(addr);
-						break;
-
-					jNO_DEFAULT;
-				}
+				case 8: 
+					return readCache8(addr);
+					break;
+				case 16: 
+					return readCache16(addr);
+					break;
+				case 32: 
+					return readCache32(addr);
+					break;
+
+				jNO_DEFAULT;
 			}
 		}
 
@@ -172,11 +149,9 @@ RETURNS_R64 vtlb_memRead64(u32 mem)
 
 	if (!vmv.isHandler(mem))
 	{
-		if (!CHECK_EEREC) {
-			if(CHECK_CACHE && CheckCache(mem)) 
-			{
-				return readCache64(mem);
-			}
+		if(!CHECK_EEREC && CHECK_CACHE && CheckCache(mem)) 
+		{
+			return readCache64(mem);
 		}
 
 		return r64_load(reinterpret_cast<const void*>(vmv.assumePtr(mem)));
@@ -196,12 +171,9 @@ RETURNS_R128 vtlb_memRead128(u32 mem)
 
 	if (!vmv.isHandler(mem))
 	{
-		if (!CHECK_EEREC) 
+		if(!CHECK_EEREC && CHECK_CACHE && CheckCache(mem)) 
 		{
-			if(CHECK_CACHE && CheckCache(mem)) 
-			{
-				return readCache128(mem);
-			}
+			return readCache128(mem);
 		}
 
 		return r128_load(reinterpret_cast<const void*>(vmv.assumePtr(mem)));
@@ -224,22 +196,19 @@ void vtlb_memWrite(u32 addr, DataType data)
 
 	if (!vmv.isHandler(addr))
 	{		
-		if (!CHECK_EEREC) 
+		if(!CHECK_EEREC && CHECK_CACHE && CheckCache(addr)) 
 		{
-			if(CHECK_CACHE && CheckCache(addr)) 
+			switch( DataSize )
 			{
-				switch( DataSize )
-				{
-				case 8: 
-					writeCache8(addr, data);
-					return;
-				case 16:
-					writeCache16(addr, data);
-					return;
-				case 32:
-					writeCache32(addr, data);
-					return;
-				}
+			case 8: 
+				writeCache8(addr, data);
+				return;
+			case 16:
+				writeCache16(addr, data);
+				return;
+			case 32:
+				writeCache32(addr, data);
+				return;
 			}
 		}
 
@@ -260,13 +229,10 @@ void vtlb_memWrite64(u32 mem, const mem64_t* value)
 
 	if (!vmv.isHandler(mem))
 	{		
-		if (!CHECK_EEREC) 
+		if(!CHECK_EEREC && CHECK_CACHE && CheckCache(mem)) 
 		{
-			if(CHECK_CACHE && CheckCache(mem)) 
-			{
-				writeCache64(mem, *value);
-				return;
-			}
+			writeCache64(mem, *value);
+			return;
 		}
 
 		*(mem64_t*)vmv.assumePtr(mem) = *value;
@@ -287,13 +253,10 @@ void vtlb_memWrite128(u32 mem, const mem128_t *value)
 
 	if (!vmv.isHandler(mem))
 	{
-		if (!CHECK_EEREC) 
+		if(!CHECK_EEREC && CHECK_CACHE && CheckCache(mem)) 
 		{
-			if(CHECK_CACHE && CheckCache(mem)) 
-			{
-				writeCache128(mem, value);
-				return;
-			}
+			writeCache128(mem, value);
+			return;
 		}
 
 		CopyQWC((void*)vmv.assumePtr(mem), value);
@@ -315,6 +278,92 @@ template void vtlb_memWrite<mem8_t>(u32 mem, mem8_t data);
 template void vtlb_memWrite<mem16_t>(u32 mem, mem16_t data);
 template void vtlb_memWrite<mem32_t>(u32 mem, mem32_t data);
 
+// --------------------------------------------------------------------------------------
+// Guest data accesses made by recompiled code to pages mapped cacheable (see
+// GetCachedAccessor in recVTLB.cpp).  The generic accessors above skip the cache emulation
+// when the recompiler is enabled, because the recompiler also uses them for its own
+// accesses (opcode fetches and analysis while compiling), which must not disturb the
+// emulated cache state.
+
+template< typename DataType >
+DataType vtlb_memReadCached(u32 addr)
+{
+	if (CheckCache(addr))
+	{
+		switch (sizeof(DataType))
+		{
+			case 1: return readCache8(addr);
+			case 2: return readCache16(addr);
+			case 4: return readCache32(addr);
+			jNO_DEFAULT;
+		}
+	}
+
+	return vtlb_memRead<DataType>(addr);
+}
+
+RETURNS_R64 vtlb_memRead64Cached(u32 mem)
+{
+	if (CheckCache(mem))
+		return readCache64(mem);
+
+	return vtlb_memRead64(mem);
+}
+
+RETURNS_R128 vtlb_memRead128Cached(u32 mem)
+{
+	if (CheckCache(mem))
+		return readCache128(mem);
+
+	return vtlb_memRead128(mem);
+}
+
+template< typename DataType >
+void vtlb_memWriteCached(u32 addr, DataType data)
+{
+	if (CheckCache(addr))
+	{
+		switch (sizeof(DataType))
+		{
+			case 1: writeCache8(addr, data); return;
+			case 2: writeCache16(addr, data); return;
+			case 4: writeCache32(addr, data); return;
+			jNO_DEFAULT;
+		}
+	}
+
+	vtlb_memWrite<DataType>(addr, data);
+}
+
+void vtlb_memWrite64Cached(u32 mem, const mem64_t* value)
+{
+	if (CheckCache(mem))
+	{
+		writeCache64(mem, *value);
+		return;
+	}
+
+	vtlb_memWrite64(mem, value);
+}
+
+void vtlb_memWrite128Cached(u32 mem, const mem128_t* value)
+{
+	if (CheckCache(mem))
+	{
+		writeCache128(mem, value);
+		return;
+	}
+
+	vtlb_memWrite128(mem, value);
+}
+
+template mem8_t vtlb_memReadCached<mem8_t>(u32 mem);
+template mem16_t vtlb_memReadCached<mem16_t>(u32 mem);
+template mem32_t vtlb_memReadCached<mem32_t>(u32 mem);
+template void vtlb_memWriteCached<mem8_t>(u32 mem, mem8_t data);
+template void vtlb_memWriteCached<mem16_t>(u32 mem, mem16_t data);
+template void vtlb_memWriteCached<mem32_t>(u32 mem, mem32_t data);
+
 template <typename DataType>
 bool vtlb_ramRead(u32 addr, DataType* value)
 {
@@ -719,6 +768,7 @@ void vtlb_VMap(u32 vaddr,u32 paddr,u32 size)
 		}
 
 		vtlbdata.vmap[vaddr>>VTLB_PAGE_BITS] = vmv;
+		vtlbdata.cmap[vaddr>>VTLB_PAGE_BITS] = 0;
 		if (vtlbdata.ppmap)
 			if (!(vaddr & 0x80000000)) // those address are already physical don't change them
 				vtlbdata.ppmap[vaddr>>VTLB_PAGE_BITS] = paddr & ~VTLB_PAGE_MASK;
@@ -738,6 +788,7 @@ void vtlb_VMapBuffer(u32 vaddr,void* buffer,u32 size)
 	while (size > 0)
 	{
 		vtlbdata.vmap[vaddr>>VTLB_PAGE_BITS] = VTLBVirtual::fromPointer(bu8, vaddr);
+		vtlbdata.cmap[vaddr>>VTLB_PAGE_BITS] = 0;
 		vaddr += VTLB_PAGE_SIZE;
 		bu8 += VTLB_PAGE_SIZE;
 		size -= VTLB_PAGE_SIZE;
@@ -760,11 +811,33 @@ void vtlb_VMapUnmap(u32 vaddr,u32 size)
 		}
 
 		vtlbdata.vmap[vaddr>>VTLB_PAGE_BITS] = handl;
+		vtlbdata.cmap[vaddr>>VTLB_PAGE_BITS] = 0;
+		vaddr += VTLB_PAGE_SIZE;
+		size -= VTLB_PAGE_SIZE;
+	}
+}
+
+// Flags the virtual pages as cacheable, so EE accesses to them go through the data cache
+// emulation when it is enabled (see CheckCache and the cached dispatchers in recVTLB.cpp).
+void vtlb_VMapCacheable(u32 vaddr,u32 size,bool cacheable)
+{
+	verify(0==(vaddr&VTLB_PAGE_MASK));
+	verify(0==(size&VTLB_PAGE_MASK) && size>0);
+
+	while (size > 0)
+	{
+		vtlbdata.cmap[vaddr>>VTLB_PAGE_BITS] = cacheable;
 		vaddr += VTLB_PAGE_SIZE;
 		size -= VTLB_PAGE_SIZE;
 	}
 }
 
+// Flags every virtual page as uncached.  Used before the TLB is rebuilt from a savestate.
+void vtlb_ClearCacheable()
+{
+	std::memset(vtlbdata.cmap, 0, sizeof(*vtlbdata.cmap) * VTLB_VMAP_ITEMS);
+}
+
 // vtlb_Init -- Clears vtlb handlers and memory mappings.
 void vtlb_Init()
 {
@@ -822,6 +895,7 @@ void vtlb_Term()
 }
 
 static constexpr size_t VMAP_SIZE = sizeof(VTLBVirtual) * VTLB_VMAP_ITEMS;
+static constexpr size_t CMAP_SIZE = sizeof(*vtlbdata.cmap) * VTLB_VMAP_ITEMS;
 
 // Reserves the vtlb core allocation used by various emulation components!
 // [TODO] basemem - request allocating memory at the specified virtual location, which can allow
@@ -844,6 +918,21 @@ void vtlb_Core_Alloc()
 			);
 		}
 	}
+
+	static u8* cmap = nullptr;
+	if (!cmap)
+		cmap = (u8*)GetVmMemory().BumpAllocator().Alloc(CMAP_SIZE);
+	if (!vtlbdata.cmap)
+	{
+		bool okay = HostSys::MmapCommitPtr(cmap, CMAP_SIZE, PageProtectionMode().Read().Write());
+		if (okay) {
+			vtlbdata.cmap = cmap;
+		} else {
+			throw Exception::OutOfMemory( "VTLB Cacheable Page LUT" )
+				.SetDiagMsg(fmt::format("({} megs)", CMAP_SIZE / _1mb)
+			);
+		}
+	}
 }
 
 static constexpr size_t PPMAP_SIZE = sizeof(*vtlbdata.ppmap) * VTLB_VMAP_ITEMS;
@@ -884,6 +973,11 @@ void vtlb_Core_Free()
 		HostSys::MmapResetPtr(vtlbdata.ppmap, PPMAP_SIZE);
 		vtlbdata.ppmap = nullptr;
 	}
+	if (vtlbdata.cmap)
+	{
+		HostSys::MmapResetPtr(vtlbdata.cmap, CMAP_SIZE);
+		vtlbdata.cmap = nullptr;
+	}
 }
 
 static std::string GetHostVmErrorMsg()
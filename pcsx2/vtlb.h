@@ -83,6 +83,8 @@ extern void vtlb_DynV2P();
 extern void vtlb_VMap(u32 vaddr,u32 paddr,u32 sz);
 extern void vtlb_VMapBuffer(u32 vaddr,void* buffer,u32 sz);
 extern void vtlb_VMapUnmap(u32 vaddr,u32 sz);
+extern void vtlb_VMapCacheable(u32 vaddr,u32 sz,bool cacheable);
+extern void vtlb_ClearCacheable();
 
 //Memory functions
 
@@ -96,6 +98,17 @@ extern void vtlb_memWrite(u32 mem, DataType value);
 extern void vtlb_memWrite64(u32 mem, const mem64_t* value);
 extern void vtlb_memWrite128(u32 mem, const mem128_t* value);
 
+// Guest accesses from recompiled code to cacheable pages, always go through the EE cache.
+template< typename DataType >
+extern DataType vtlb_memReadCached(u32 mem);
+extern RETURNS_R64 vtlb_memRead64Cached(u32 mem);
+extern RETURNS_R128 vtlb_memRead128Cached(u32 mem);
+
+template< typename DataType >
+extern void vtlb_memWriteCached(u32 mem, DataType value);
+extern void vtlb_memWrite64Cached(u32 mem, const mem64_t* value);
+extern void vtlb_memWrite128Cached(u32 mem, const mem128_t* value);
+
 // "Safe" variants of vtlb, designed for external tools.
 // These routines only access the various RAM, and will not call handlers
 // which has the potential to change hardware state.
@@ -261,10 +274,13 @@ namespace vtlb_private
 
 		u32* ppmap;               //4MB (allocated by vtlb_init) // PS2 virtual to PS2 physical
 
+		u8* cmap;                 //1MB (allocated by vtlb_init) // PS2 virtual page is mapped cacheable
+
 		MapData()
 		{
 			vmap = NULL;
 			ppmap = NULL;
+			cmap = NULL;
 		}
 	};
 
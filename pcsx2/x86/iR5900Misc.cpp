@@ -201,13 +201,16 @@ void recCOP1_Unknown()
 **********************************************************/
 
 // Suikoden 3 uses it a lot
-void recCACHE() //Interpreter only!
+// Only does anything with EE cache emulation, the interpreter keeps the cache state in Cache.cpp.
+void recCACHE()
 {
-	//xMOV(ptr32[&cpuRegs.code], (u32)cpuRegs.code );
-	//xMOV(ptr32[&cpuRegs.pc], (u32)pc );
-	//iFlushCall(FLUSH_EVERYTHING);
-	//xFastCall((void*)(uptr)R5900::Interpreter::OpcodeImpl::CACHE );
-	//branch = 2;
+	if (!CHECK_CACHE)
+		return;
+
+	xMOV(ptr32[&cpuRegs.code], (u32)cpuRegs.code);
+	xMOV(ptr32[&cpuRegs.pc], (u32)pc);
+	iFlushCall(FLUSH_EVERYTHING);
+	xFastCall((void*)(uptr)R5900::Interpreter::OpcodeImpl::CACHE);
 }
 
 void recTGE()
@@ -1349,6 +1349,8 @@ void recMemcheck(u32 op, u32 bits, bool store)
 			continue;
 		if (checks[i].result == 0)
 			continue;
+		if (CBreakPoints::IsPageGuarded(checks[i]))
+			continue;
 		if ((checks[i].cond & MEMCHECK_WRITE) == 0 && store)
 			continue;
 		if ((checks[i].cond & MEMCHECK_READ) == 0 && !store)
@@ -1391,6 +1393,9 @@ void encodeBreakpoint()
 
 void encodeMemcheck()
 {
+	if (isMemcheckGuardNeeded(pc))
+		iFlushCall(FLUSH_EVERYTHING | FLUSH_PC);
+
 	int needed = isMemcheckNeeded(pc);
 	if (needed == 0)
 		return;
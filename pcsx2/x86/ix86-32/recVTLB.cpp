@@ -146,21 +146,31 @@ static void iMOV64_Smart(const xIndirectVoid& destRm, const xIndirectVoid& srcRm
 
 */
 
+static void DynGen_CachedDispatch(int mode, int bits, bool sign);
+
 namespace vtlb_private
 {
 	// ------------------------------------------------------------------------
 	// Prepares eax, ecx, and, ebx for Direct or Indirect operations.
 	// Returns the writeback pointer for ebx (return address from indirect handling)
 	//
-	static u32* DynGen_PrepRegs()
+	// When EE cache emulation is enabled, accesses to pages mapped cacheable are sent to the
+	// cached dispatcher instead, with the virtual address still in arg1reg.
+	//
+	static u32* DynGen_PrepRegs(int mode, int bits, bool sign = false)
 	{
 		// Warning dirty ebx (in case someone got the very bad idea to move this code)
 		EE::Profiler.EmitMem();
 
 		xMOV(eax, arg1regd);
 		xSHR(eax, VTLB_PAGE_BITS);
+		if (CHECK_CACHE)
+			xCMP(ptr8[xComplexAddress(rbx, vtlbdata.cmap, rax)], 0);
+		// Neither MOV nor LEA modify the flags from the cacheable page test
 		xMOV(rax, ptrNative[xComplexAddress(rbx, vtlbdata.vmap, rax * wordsize)]);
 		u32* writeback = xLEA_Writeback(rbx);
+		if (CHECK_CACHE)
+			DynGen_CachedDispatch(mode, bits, sign);
 		xADD(arg1reg, rax);
 
 		return writeback;
@@ -171,6 +181,7 @@ namespace vtlb_private
 	{
 		pxAssert(bits == 8 || bits == 16 || bits == 32);
 
+		const u8* start = xGetPtr();
 		switch (bits)
 		{
 			case 8:
@@ -193,12 +204,14 @@ namespace vtlb_private
 
 			jNO_DEFAULT
 		}
+		mmap_MarkRecAccess(start, xGetPtr(), bits / 8, pc - 4, g_recompilingDelaySlot);
 	}
 
 	static void DynGen_DirectRead64(u32 bits)
 	{
 		pxAssert(bits == 64 || bits == 128);
 
+		const u8* start = xGetPtr();
 		switch (bits) {
 			case 64:
 				xMOVQZX(xmm0, ptr64[arg1reg]);
@@ -210,11 +223,14 @@ namespace vtlb_private
 
 			jNO_DEFAULT
 		}
+		mmap_MarkRecAccess(start, xGetPtr(), bits / 8, pc - 4, g_recompilingDelaySlot);
 	}
 
 	// ------------------------------------------------------------------------
 	static void DynGen_DirectWrite(u32 bits)
 	{
+		const u8* start = xGetPtr();
+
 		// TODO: x86Emitter can't use dil
 		switch (bits)
 		{
@@ -240,6 +256,7 @@ namespace vtlb_private
 				iMOV128_SSE(ptr[arg1reg], ptr[arg2reg]);
 				break;
 		}
+		mmap_MarkRecAccess(start, xGetPtr(), bits / 8, pc - 4, g_recompilingDelaySlot);
 	}
 } // namespace vtlb_private
 
@@ -272,22 +289,63 @@ static u8* GetIndirectDispatcherPtr(int mode, int operandsize, int sign = 0)
 }
 
 // ------------------------------------------------------------------------
-// Generates a JS instruction that targets the appropriate templated instance of
-// the vtlb Indirect Dispatcher.
+// The cached dispatchers follow the indirect ones in the same page, with the same layout.
 //
-static void DynGen_IndirectDispatch(int mode, int bits, bool sign = false)
+static u8* GetCachedDispatcherPtr(int mode, int operandsize, int sign = 0)
+{
+	return GetIndirectDispatcherPtr(mode + 2, operandsize, sign);
+}
+
+static int GetOperandSizeIndex(int bits)
 {
-	int szidx = 0;
 	switch (bits)
 	{
-		case   8: szidx = 0; break;
-		case  16: szidx = 1; break;
-		case  32: szidx = 2; break;
-		case  64: szidx = 3; break;
-		case 128: szidx = 4; break;
+		case   8: return 0;
+		case  16: return 1;
+		case  32: return 2;
+		case  64: return 3;
+		case 128: return 4;
 		jNO_DEFAULT;
 	}
-	xJS(GetIndirectDispatcherPtr(mode, szidx, sign));
+	return 0;
+}
+
+// ------------------------------------------------------------------------
+// Accessors used for pages mapped cacheable, these go through the EE data cache emulation
+// in Cache.cpp (and fall back to plain memory accesses if the cache is disabled in COP0).
+//
+static void* GetCachedAccessor(int mode, int operandsize)
+{
+	static void* const accessors[2][5] = {
+		{
+			(void*)vtlb_memReadCached<mem8_t>, (void*)vtlb_memReadCached<mem16_t>, (void*)vtlb_memReadCached<mem32_t>,
+			(void*)vtlb_memRead64Cached, (void*)vtlb_memRead128Cached,
+		},
+		{
+			(void*)vtlb_memWriteCached<mem8_t>, (void*)vtlb_memWriteCached<mem16_t>, (void*)vtlb_memWriteCached<mem32_t>,
+			(void*)vtlb_memWrite64Cached, (void*)vtlb_memWrite128Cached,
+		},
+	};
+
+	return accessors[mode][operandsize];
+}
+
+// ------------------------------------------------------------------------
+// Generates a JNE instruction that targets the cached dispatcher, taken when the cacheable
+// page test in DynGen_PrepRegs is set.
+//
+static void DynGen_CachedDispatch(int mode, int bits, bool sign)
+{
+	xJNE(GetCachedDispatcherPtr(mode, GetOperandSizeIndex(bits), sign));
+}
+
+// ------------------------------------------------------------------------
+// Generates a JS instruction that targets the appropriate templated instance of
+// the vtlb Indirect Dispatcher.
+//
+static void DynGen_IndirectDispatch(int mode, int bits, bool sign = false)
+{
+	xJS(GetIndirectDispatcherPtr(mode, GetOperandSizeIndex(bits), sign));
 }
 
 // ------------------------------------------------------------------------
@@ -335,6 +393,35 @@ static void DynGen_IndirectTlbDispatcher(int mode, int bits, bool sign)
 	xJMP(rbx);
 }
 
+// ------------------------------------------------------------------------
+// Generates the various instances of the cached dispatchers
+// In: arg1reg: virtual address, arg2reg: data (ptr if mode >= 64), rbx: function return ptr
+// Out: eax: result (if mode < 64)
+static void DynGen_CachedDispatcher(int mode, int bits, bool sign)
+{
+	xFastCall(GetCachedAccessor(mode, bits), arg1reg, arg2reg);
+
+	if (!mode)
+	{
+		if (bits == 0)
+		{
+			if (sign)
+				xMOVSX(eax, al);
+			else
+				xMOVZX(eax, al);
+		}
+		else if (bits == 1)
+		{
+			if (sign)
+				xMOVSX(eax, ax);
+			else
+				xMOVZX(eax, ax);
+		}
+	}
+
+	xJMP(rbx);
+}
+
 // One-time initialization procedure.  Multiple subsequent calls during the lifespan of the
 // process will be ignored.
 //
@@ -360,6 +447,10 @@ void vtlb_dynarec_init()
 				xSetPtr(GetIndirectDispatcherPtr(mode, bits, !!sign));
 
 				DynGen_IndirectTlbDispatcher(mode, bits, !!sign);
+
+				xSetPtr(GetCachedDispatcherPtr(mode, bits, !!sign));
+
+				DynGen_CachedDispatcher(mode, bits, !!sign);
 			}
 		}
 	}
@@ -387,7 +478,7 @@ int vtlb_DynGenRead64(u32 bits, int gpr)
 {
 	pxAssume(bits == 64 || bits == 128);
 
-	u32* writeback = DynGen_PrepRegs();
+	u32* writeback = DynGen_PrepRegs(0, bits);
 
 	int reg = gpr == -1 ? _allocTempXMMreg(XMMT_INT, 0) : _allocGPRtoXMMreg(0, gpr, MODE_WRITE); // Handler returns in xmm0
 	DynGen_IndirectDispatch(0, bits);
@@ -405,7 +496,7 @@ void vtlb_DynGenRead32(u32 bits, bool sign)
 {
 	pxAssume(bits <= 32);
 
-	u32* writeback = DynGen_PrepRegs();
+	u32* writeback = DynGen_PrepRegs(0, bits, sign && bits < 32);
 
 	DynGen_IndirectDispatch(0, bits, sign && bits < 32);
 	DynGen_DirectRead(bits, sign);
@@ -422,10 +513,17 @@ int vtlb_DynGenRead64_Const(u32 bits, u32 addr_const, int gpr)
 
 	int reg;
 	auto vmv = vtlbdata.vmap[addr_const >> VTLB_PAGE_BITS];
-	if (!vmv.isHandler(addr_const))
+	if (CHECK_CACHE && vtlbdata.cmap[addr_const >> VTLB_PAGE_BITS])
+	{
+		iFlushCall(FLUSH_FULLVTLB);
+		reg = gpr == -1 ? _allocTempXMMreg(XMMT_INT, 0) : _allocGPRtoXMMreg(0, gpr, MODE_WRITE); // Accessor returns in xmm0
+		xFastCall(GetCachedAccessor(0, GetOperandSizeIndex(bits)), addr_const);
+	}
+	else if (!vmv.isHandler(addr_const))
 	{
 		void* ppf = reinterpret_cast<void*>(vmv.assumePtr(addr_const));
 		reg = gpr == -1 ? _allocTempXMMreg(XMMT_INT, -1) : _allocGPRtoXMMreg(-1, gpr, MODE_WRITE);
+		const u8* start = xGetPtr();
 		switch (bits)
 		{
 			case 64:
@@ -438,22 +536,16 @@ int vtlb_DynGenRead64_Const(u32 bits, u32 addr_const, int gpr)
 
 			jNO_DEFAULT
 		}
+		mmap_MarkRecAccess(start, xGetPtr(), bits / 8, pc - 4, g_recompilingDelaySlot);
 	}
 	else
 	{
 		// has to: translate, find function, call function
 		u32 paddr = vmv.assumeHandlerGetPAddr(addr_const);
 
-		int szidx = 0;
-		switch (bits)
-		{
-			case  64: szidx = 3; break;
-			case 128: szidx = 4; break;
-		}
-
 		iFlushCall(FLUSH_FULLVTLB);
 		reg = gpr == -1 ? _allocTempXMMreg(XMMT_INT, 0) : _allocGPRtoXMMreg(0, gpr, MODE_WRITE); // Handler returns in xmm0
-		xFastCall(vmv.assumeHandlerGetRaw(szidx, 0), paddr, arg2reg);
+		xFastCall(vmv.assumeHandlerGetRaw(GetOperandSizeIndex(bits), 0), paddr, arg2reg);
 	}
 	return reg;
 }
@@ -471,9 +563,30 @@ void vtlb_DynGenRead32_Const(u32 bits, bool sign, u32 addr_const)
 	EE::Profiler.EmitConstMem(addr_const);
 
 	auto vmv = vtlbdata.vmap[addr_const >> VTLB_PAGE_BITS];
-	if (!vmv.isHandler(addr_const))
+	if (CHECK_CACHE && vtlbdata.cmap[addr_const >> VTLB_PAGE_BITS])
+	{
+		iFlushCall(FLUSH_FULLVTLB);
+		xFastCall(GetCachedAccessor(0, GetOperandSizeIndex(bits)), addr_const);
+
+		if (bits == 8)
+		{
+			if (sign)
+				xMOVSX(eax, al);
+			else
+				xMOVZX(eax, al);
+		}
+		else if (bits == 16)
+		{
+			if (sign)
+				xMOVSX(eax, ax);
+			else
+				xMOVZX(eax, ax);
+		}
+	}
+	else if (!vmv.isHandler(addr_const))
 	{
 		auto ppf = vmv.assumePtr(addr_const);
+		const u8* start = xGetPtr();
 		switch (bits)
 		{
 			case 8:
@@ -494,6 +607,7 @@ void vtlb_DynGenRead32_Const(u32 bits, bool sign, u32 addr_const)
 				xMOV(eax, ptr32[(u32*)ppf]);
 				break;
 		}
+		mmap_MarkRecAccess(start, xGetPtr(), bits / 8, pc - 4, g_recompilingDelaySlot);
 	}
 	else
 	{
@@ -543,7 +657,7 @@ void vtlb_DynGenRead32_Const(u32 bits, bool sign, u32 addr_const)
 
 void vtlb_DynGenWrite(u32 sz)
 {
-	u32* writeback = DynGen_PrepRegs();
+	u32* writeback = DynGen_PrepRegs(1, sz);
 
 	DynGen_IndirectDispatch(1, sz);
 	DynGen_DirectWrite(sz);
@@ -561,10 +675,16 @@ void vtlb_DynGenWrite_Const(u32 bits, u32 addr_const)
 	EE::Profiler.EmitConstMem(addr_const);
 
 	auto vmv = vtlbdata.vmap[addr_const >> VTLB_PAGE_BITS];
-	if (!vmv.isHandler(addr_const))
+	if (CHECK_CACHE && vtlbdata.cmap[addr_const >> VTLB_PAGE_BITS])
+	{
+		iFlushCall(FLUSH_FULLVTLB);
+		xFastCall(GetCachedAccessor(1, GetOperandSizeIndex(bits)), addr_const, arg2reg);
+	}
+	else if (!vmv.isHandler(addr_const))
 	{
 		// TODO: x86Emitter can't use dil
 		auto ppf = vmv.assumePtr(addr_const);
+		const u8* start = xGetPtr();
 		switch (bits)
 		{
 			//8 , 16, 32 : data on arg2
@@ -589,6 +709,7 @@ void vtlb_DynGenWrite_Const(u32 bits, u32 addr_const)
 				iMOV128_SSE(ptr[(void*)ppf], ptr[arg2reg]);
 				break;
 		}
+		mmap_MarkRecAccess(start, xGetPtr(), bits / 8, pc - 4, g_recompilingDelaySlot);
 	}
 	else
 	{
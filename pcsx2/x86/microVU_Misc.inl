@@ -44,6 +44,11 @@ void mVUloadReg(const xmm& reg, xAddressVoid ptr, int xyzw)
 
 void mVUloadIreg(const xmm& reg, int xyzw, VURegs* vuRegs)
 {
+	if (!_XYZWss(xyzw) && x86caps.hasAVX)
+	{
+		xVBROADCASTSS(reg, ptr32[&vuRegs->VI[REG_I].UL]);
+		return;
+	}
 	xMOVSSZX(reg, ptr32[&vuRegs->VI[REG_I].UL]);
 	if (!_XYZWss(xyzw))
 		xSHUF.PS(reg, reg, 0);
@@ -325,6 +330,22 @@ void MIN_MAX_PS(microVU& mVU, const xmm& to, const xmm& from, const xmm& t1in, c
 
 		xSHUF.PS(to, t1, 0x88);
 	}
+	else if (x86caps.hasAVX) // use integer comparison, three operand forms
+	{
+		const xmm& c1 = min ? t2 : t1;
+		const xmm& c2 = min ? t1 : t2;
+
+		xVPSRAD  (t1, to, 31);
+		xVPSRLD  (t1, t1, 1);
+		xVPXOR   (t1, t1, to);
+
+		xVPSRAD  (t2, from, 31);
+		xVPSRLD  (t2, t2, 1);
+		xVPXOR   (t2, t2, from);
+
+		xPCMP.GTD(c1, c2);
+		xVBLENDVPS(to, from, to, c1);
+	}
 	else // use integer comparison
 	{
 		const xmm& c1 = min ? t2 : t1;
@@ -453,6 +474,19 @@ void ADD_SS_TriAceHack(microVU& mVU, const xmm& to, const xmm& from)
 	xADD.SS(to, from);
 }
 
+// to = from1 <op> from2, without the extra register copy when AVX is available.
+// Note: 'to' must not be the same register as 'from2'.
+#define mVU3op(sseOp, avxOp, to, from1, from2) \
+	do { \
+		if (x86caps.hasAVX) \
+			avxOp(to, from1, from2); \
+		else \
+		{ \
+			xMOVAPS(to, from1); \
+			sseOp(to, from2); \
+		} \
+	} while (0)
+
 #define clampOp(opX, isPS) \
 	do { \
 		mVUclamp3(mVU, to, t1, (isPS) ? 0xf : 0x8); \
@@ -92,8 +92,7 @@ static void mVUupdateFlags(mV, const xmm& reg, const xmm& regT1in = xEmptyReg, c
 	if (sFLAG.doFlag && CHECK_VUOVERFLOWHACK)
 	{
 		//Calculate overflow
-		xMOVAPS(regT1, regT2);
-		xAND.PS(regT1, ptr128[&sse4_compvals[1][0]]); // Remove sign flags (we don't care)
+		mVU3op(xAND.PS, xVAND.PS, regT1, regT2, ptr128[&sse4_compvals[1][0]]); // Remove sign flags (we don't care)
 		xCMPNLT.PS(regT1, ptr128[&sse4_compvals[0][0]]); // Compare if T1 == FLT_MAX
 		xMOVMSKPS(gprT2, regT1); // Grab sign bits  for equal results
 		xAND(gprT2, AND_XYZW); // Grab "Is FLT_MAX" bits from the previous calculation
@@ -499,14 +498,12 @@ static void mVU_FTOIx(mP, const float* addr, microOpcode opEnum)
 		const xmm& t2 = mVU.regAlloc->allocReg();
 
 		// Note: For help understanding this algorithm see recVUMI_FTOI_Saturate()
-		xMOVAPS(t1, Fs);
+		mVU3op(xPXOR, xVPXOR, t1, Fs, ptr128[mVUglob.signbit]);
 		if (addr)
 			xMUL.PS(Fs, ptr128[addr]);
 		xCVTTPS2DQ(Fs, Fs);
-		xPXOR(t1, ptr128[mVUglob.signbit]);
 		xPSRA.D(t1, 31);
-		xMOVAPS(t2, Fs);
-		xPCMP.EQD(t2, ptr128[mVUglob.signbit]);
+		mVU3op(xPCMP.EQD, xVPCMPEQD, t2, Fs, ptr128[mVUglob.signbit]);
 		xAND.PS(t1, t2);
 		xPADD.D(Fs, t1);
 
@@ -562,15 +559,22 @@ mVUop(mVU_CLIP)
 		xSHL(gprT1, 6);
 
 		xAND.PS(Ft, ptr128[mVUglob.absclip]);
-		xMOVAPS(t1, Ft);
-		xPOR(t1, ptr128[mVUglob.signbit]);
+		mVU3op(xPOR, xVPOR, t1, Ft, ptr128[mVUglob.signbit]);
 
 		xCMPNLE.PS(t1, Fs); // -w, -z, -y, -x
 		xCMPLT.PS(Ft, Fs);  // +w, +z, +y, +x
 
-		xMOVAPS(Fs, Ft);    // Fs = +w, +z, +y, +x
-		xUNPCK.LPS(Ft, t1); // Ft = -y,+y,-x,+x
-		xUNPCK.HPS(Fs, t1); // Fs = -w,+w,-z,+z
+		if (x86caps.hasAVX)
+		{
+			xVUNPCKHPS(Fs, Ft, t1); // Fs = -w,+w,-z,+z
+			xUNPCK.LPS(Ft, t1);     // Ft = -y,+y,-x,+x
+		}
+		else
+		{
+			xMOVAPS(Fs, Ft);    // Fs = +w, +z, +y, +x
+			xUNPCK.LPS(Ft, t1); // Ft = -y,+y,-x,+x
+			xUNPCK.HPS(Fs, t1); // Fs = -w,+w,-z,+z
+		}
 
 		xMOVMSKPS(gprT2, Fs); // -w,+w,-z,+z
 		xAND(gprT2, 0x3);
@@ -255,6 +255,33 @@ void VifUnpackSSE_Dynarec::ModUnpack(int upknum, bool PostOp)
 	}
 }
 
+// Unpacks two consecutive vectors with a single ymm load/store.  Only valid for
+// unmasked V4-32/V4-16/V4-8 unpacks, where each output vector has its own input.
+void VifUnpackSSE_Dynarec::xUnpackPair(int upknum) const
+{
+	const xRegisterYMM ymmDest(destReg.Id);
+
+	switch (upknum)
+	{
+		case 12:
+			xVMOVUPS(ymmDest, ptr[srcIndirect]);
+			break;
+		case 13:
+			if (usn) xVPMOVZX.WD(ymmDest, ptr[srcIndirect]);
+			else     xVPMOVSX.WD(ymmDest, ptr[srcIndirect]);
+			break;
+		case 14:
+			if (usn) xVPMOVZX.BD(ymmDest, ptr[srcIndirect]);
+			else     xVPMOVSX.BD(ymmDest, ptr[srcIndirect]);
+			break;
+		default:
+			pxFailRel("Vpu/Vif - Invalid paired unpack!");
+			break;
+	}
+
+	xVMOVUPS(ptr[dstIndirect], ymmDest);
+}
+
 void VifUnpackSSE_Dynarec::CompileRoutine()
 {
 	const int wl        = vB.wl ? vB.wl : 256; // 0 is taken as 256 (KH2)
@@ -267,6 +294,10 @@ void VifUnpackSSE_Dynarec::CompileRoutine()
 	uint vNum = vB.num ? vB.num : 256;
 	doMode    = (upkNum == 0xf) ? 0 : doMode; // V4_5 has no mode feature.
 	UnpkNoOfIterations = 0;
+
+	// Unmasked V4 unpacks can write two vectors per step with AVX2
+	const bool canPair = x86caps.hasAVX2 && IsUnmaskedOp() && (upkNum >= 12 && upkNum <= 14);
+	bool usedYmm = false;
 	MSKPATH3_LOG("Compiling new block, unpack number %x, mode %x, masking %x, vNum %x", upkNum, doMode, doMask, vNum);
 
 	pxAssume(vCL == 0);
@@ -284,7 +315,20 @@ void VifUnpackSSE_Dynarec::CompileRoutine()
 			ShiftDisplacementWindow(srcIndirect, arg2reg); //Don't need to do this otherwise as we arent reading the source.
 
 
-		if (vCL < cycleSize)
+		if (canPair && vNum >= 2 && (vCL + 1) < cycleSize)
+		{
+			xUnpackPair(upkNum);
+			usedYmm = true;
+
+			dstIndirect += 32;
+			srcIndirect += vift * 2;
+
+			vNum -= 2;
+			vCL += 2;
+			if (vCL == blockSize)
+				vCL = 0;
+		}
+		else if (vCL < cycleSize)
 		{
 			ModUnpack(upkNum, false);
 			xUnpack(upkNum);
@@ -321,6 +365,8 @@ void VifUnpackSSE_Dynarec::CompileRoutine()
 
 	if (doMode >= 2)
 		writeBackRow();
+	if (usedYmm)
+		xVZEROUPPER();
 	xRET();
 }
 
@@ -129,6 +129,7 @@ public:
 	virtual bool IsUnmaskedOp() const { return !doMode && !doMask; }
 
 	void ModUnpack(int upknum, bool PostOp);
+	void xUnpackPair(int upknum) const;
 	void CompileRoutine();
 
 
@@ -0,0 +1,233 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/Pcsx2Defs.h"
+#include "DEV9/PacketReader/EthernetFrame.h"
+#include "DEV9/PacketReader/IP/IP_Packet.h"
+#include "DEV9/PacketReader/IP/UDP/UDP_Packet.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace PacketReader;
+using namespace PacketReader::IP;
+using namespace PacketReader::IP::UDP;
+
+static const u8 s_ps2MAC[6] = {0x00, 0x04, 0x1F, 0x82, 0x30, 0x31};
+static const u8 s_internalMAC[6] = {0x76, 0x6D, 0xF4, 0x63, 0x30, 0x31};
+
+// What a UDP session and SocketAdapter::recv() do for each datagram received from the host:
+// copy it into a payload, wrap it in UDP/IP/Ethernet and write the frame out.
+static UDP_Packet* RecvDatagram(const u8* data, int len, u16 port)
+{
+	PayloadData* recived = new PayloadData(len);
+	std::memcpy(recived->data.get(), data, len);
+
+	UDP_Packet* udp = new UDP_Packet(recived);
+	udp->sourcePort = 53;
+	udp->destinationPort = port;
+	return udp;
+}
+
+static void WriteFrame(UDP_Packet* udp, NetPacket* pkt)
+{
+	IP_Packet* ipPkt = new IP_Packet(udp);
+	ipPkt->sourceIP = {{{192, 168, 1, 1}}};
+	ipPkt->destinationIP = {{{192, 168, 1, 100}}};
+
+	EthernetFrame frame(ipPkt);
+	std::memcpy(frame.sourceMAC, s_internalMAC, 6);
+	std::memcpy(frame.destinationMAC, s_ps2MAC, 6);
+	frame.protocol = (u16)EtherType::IPv4;
+	frame.WritePacket(pkt);
+}
+
+// And what the EE side does with the frame it is handed.
+static bool ReadFrame(NetPacket* pkt, const u8* expected, int len, u16 port)
+{
+	EthernetFrame frame(pkt);
+	if (frame.protocol != (u16)EtherType::IPv4)
+		return false;
+
+	PayloadPtr* payload = static_cast<PayloadPtr*>(frame.GetPayload());
+	IP_Packet ippkt(payload->data, payload->GetLength());
+	if (ippkt.protocol != (u8)IP_Type::UDP)
+		return false;
+
+	IP_PayloadPtr* ipPayload = static_cast<IP_PayloadPtr*>(ippkt.GetPayload());
+	UDP_Packet udppkt(ipPayload->data, ipPayload->GetLength());
+	PayloadPtr* udpPayload = static_cast<PayloadPtr*>(udppkt.GetPayload());
+	return udppkt.destinationPort == port && udpPayload->GetLength() == len &&
+		   std::memcmp(udpPayload->data, expected, len) == 0;
+}
+
+TEST(PacketPool, FramesComeFromThePool)
+{
+	u8 datagram[512];
+	for (int i = 0; i < (int)sizeof(datagram); i++)
+		datagram[i] = (u8)(i * 7);
+
+	NetPacket pkt;
+	for (u16 i = 0; i < 4096; i++)
+	{
+		UDP_Packet* udp = RecvDatagram(datagram, sizeof(datagram), 1024 + (i & 0xFF));
+		// The pool is sized for a few hundred frames in flight, one at a time never reaches the heap.
+		ASSERT_TRUE(GetPacketObjectPool().Owns(udp));
+		ASSERT_TRUE(GetPacketBufferPool().Owns(static_cast<PayloadData*>(udp->GetPayload())->data.get()));
+
+		WriteFrame(udp, &pkt);
+		ASSERT_TRUE(ReadFrame(&pkt, datagram, sizeof(datagram), 1024 + (i & 0xFF)));
+	}
+}
+
+TEST(PacketPool, FallsBackToTheHeap)
+{
+	// Bigger than a pool block, as a large UDP datagram read from the host can be.
+	PayloadData big(4096);
+	EXPECT_FALSE(GetPacketBufferPool().Owns(big.data.get()));
+	EXPECT_EQ(big.data[4095], 0);
+
+	// Exhaust the object pool, the rest must still be usable.
+	constexpr int count = 2048;
+	PayloadData* payloads[count];
+	for (int i = 0; i < count; i++)
+	{
+		payloads[i] = new PayloadData(16);
+		payloads[i]->data[15] = (u8)i;
+	}
+	EXPECT_FALSE(GetPacketObjectPool().Owns(payloads[count - 1]));
+	for (int i = 0; i < count; i++)
+	{
+		EXPECT_EQ(payloads[i]->data[15], (u8)i);
+		delete payloads[i];
+	}
+
+	PayloadData* reused = new PayloadData(16);
+	EXPECT_TRUE(GetPacketObjectPool().Owns(reused));
+	delete reused;
+}
+
+// Packets are created by the socket threads and freed on the EE thread.
+TEST(PacketPool, CrossThread)
+{
+	constexpr u32 count = 100000;
+	SimpleQueue<UDP_Packet*> queue;
+
+	std::thread producer([&queue]() {
+		u8 datagram[64] = {};
+		for (u32 i = 0; i < count; i++)
+		{
+			std::memcpy(datagram, &i, sizeof(i));
+			queue.Enqueue(RecvDatagram(datagram, sizeof(datagram), 1024));
+		}
+	});
+
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+
+	NetPacket pkt;
+	u32 received = 0;
+	bool intact = true;
+	while (received < count)
+	{
+		UDP_Packet* udp;
+		if (!queue.Dequeue(&udp))
+		{
+			if (std::chrono::steady_clock::now() > deadline)
+				break;
+			continue;
+		}
+
+		u8 expected[64] = {};
+		std::memcpy(expected, &received, sizeof(received));
+		WriteFrame(udp, &pkt);
+		intact &= ReadFrame(&pkt, expected, sizeof(expected), 1024);
+		received++;
+	}
+
+	producer.join();
+
+	EXPECT_EQ(received, count);
+	EXPECT_TRUE(intact);
+}
+
+// The checksum used to fold the carry after every word.
+static u16 ReferenceChecksum(const u8* buffer, int length)
+{
+	int i = 0;
+	u32 sum = 0;
+	while (length > 1)
+	{
+		sum += ((u32)(buffer[i]) << 8) | ((u32)(buffer[i + 1]) & 0xFF);
+		if ((sum & 0xFFFF0000) > 0)
+		{
+			sum &= 0xFFFF;
+			sum += 1;
+		}
+		i += 2;
+		length -= 2;
+	}
+	if (length > 0)
+	{
+		sum += (u32)(buffer[i] << 8);
+		if ((sum & 0xFFFF0000) > 0)
+		{
+			sum = sum & 0xFFFF;
+			sum += 1;
+		}
+	}
+	return (u16)~sum;
+}
+
+TEST(PacketPool, InternetChecksum)
+{
+	std::vector<u8> buffer(65536);
+	u32 seed = 1;
+	for (u8& b : buffer)
+	{
+		seed = seed * 1664525 + 1013904223;
+		b = (u8)(seed >> 24);
+	}
+
+	for (int len : {0, 1, 2, 3, 20, 21, 1472, 1473, 65535, 65536})
+		EXPECT_EQ(IP_Packet::InternetChecksum(buffer.data(), len), ReferenceChecksum(buffer.data(), len)) << len;
+
+	// Sums that are multiples of 0xFFFF
+	std::vector<u8> ones(4000, 0xFF);
+	EXPECT_EQ(IP_Packet::InternetChecksum(ones.data(), 4000), ReferenceChecksum(ones.data(), 4000));
+	std::vector<u8> zeros(64, 0);
+	EXPECT_EQ(IP_Packet::InternetChecksum(zeros.data(), 64), ReferenceChecksum(zeros.data(), 64));
+}
+
+// Frame rate of the receive path, run with --gtest_also_run_disabled_tests.
+TEST(PacketPool, DISABLED_PacketRate)
+{
+	constexpr u32 count = 2000000;
+
+	u8 datagram[1472] = {};
+	NetPacket pkt;
+
+	const auto start = std::chrono::steady_clock::now();
+	for (u32 i = 0; i < count; i++)
+	{
+		WriteFrame(RecvDatagram(datagram, sizeof(datagram), 1024), &pkt);
+		ASSERT_EQ(pkt.size, 14 + 20 + 8 + (int)sizeof(datagram));
+	}
+
+	const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	std::printf("%u frames in %.2f ms (%.2f Mframes/s)\n", count, ms, count / ms / 1000.0);
+}
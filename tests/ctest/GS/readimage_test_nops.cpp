@@ -0,0 +1,78 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2021 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+// This file defines functions that are linked to by files used in the ReadImage tests but not actually used in them, in order to make linkers happy
+
+#include "PrecompiledHeader.h"
+#include "GS.h"
+#include "GSBlock.h"
+#include "GSClut.h"
+#include "GSLocalMemory.h"
+#include "GSPng.h"
+#include "Renderers/Common/GSDevice.h"
+#include "common/AlignedMalloc.h"
+
+// GSLocalMemory allocates its memory with vmalloc, so that one has to work
+
+void* vmalloc(size_t size, bool code)
+{
+	return _aligned_malloc(size, 4096);
+}
+
+void vmfree(void* ptr, size_t size)
+{
+	_aligned_free(ptr);
+}
+
+void* fifo_alloc(size_t size, size_t repeat)
+{
+	abort();
+}
+
+void fifo_free(void* ptr, size_t size, size_t repeat)
+{
+	abort();
+}
+
+GSApp theApp;
+std::unique_ptr<GSDevice> g_gs_device;
+Pcsx2Config::GSOptions GSConfig;
+
+GSApp::GSApp()
+{
+}
+
+int GSApp::GetConfigI(const char* entry)
+{
+	return 0;
+}
+
+bool GSApp::GetConfigB(const char* entry)
+{
+	return false;
+}
+
+Pcsx2Config::GSOptions::GSOptions()
+{
+}
+
+bool Pcsx2Config::GSOptions::UseHardwareRenderer() const
+{
+	return true;
+}
+
+bool GSPng::Save(GSPng::Format fmt, const std::string& file, u8* image, int w, int h, int pitch, int compression, bool rb_swapped)
+{
+	abort();
+}
@@ -117,6 +117,24 @@ static void expandHP(u8* dst, const u32* src, int shift, int mask)
 	}
 }
 
+static void pack24(u8* dst, const u32* src)
+{
+	for (int i = 0; i < 64; i++)
+	{
+		dst[i * 3 + 0] = src[i];
+		dst[i * 3 + 1] = src[i] >> 8;
+		dst[i * 3 + 2] = src[i] >> 16;
+	}
+}
+
+static void packH4(u8* dst, const u32* src, int shift)
+{
+	for (int i = 0; i < 64; i += 2)
+	{
+		dst[i >> 1] = ((src[i] >> shift) & 0xF) | (((src[i + 1] >> shift) & 0xF) << 4);
+	}
+}
+
 static std::string image2hex(const u8* bin, int rows, int columns, int bpp)
 {
 	std::string out;
@@ -256,6 +274,18 @@ static TestData expandHP(TestData data, int shift, int mask)
 	return data;
 }
 
+static TestData pack24(TestData data)
+{
+	pack24(data.output, reinterpret_cast<const u32*>(data.block));
+	return data;
+}
+
+static TestData packH4(TestData data, int shift)
+{
+	packH4(data.output, reinterpret_cast<const u32*>(data.block), shift);
+	return data;
+}
+
 static void runTest(void (*fn)(TestData))
 {
 	fn(TestData::Linear());
@@ -332,6 +362,17 @@ TEST(ReadAndExpandTest, Read16AEM)
 	});
 }
 
+TEST(ReadAndPackTest, Read24)
+{
+	runTest([](TestData data)
+	{
+		TestData expected = swizzle(&columnTable32[0][0], data, 32, true);
+		expected = pack24(expected.prepareExpand());
+		GSBlock::ReadAndPackBlock24(data.block, data.output, 24);
+		assertEqual(expected, data, "ReadAndPack24", 8, 8, 24);
+	});
+}
+
 TEST(WriteTest, Write16)
 {
 	runTest([](TestData data)
@@ -395,6 +436,17 @@ TEST(ReadAndExpandTest, Read8H)
 	});
 }
 
+TEST(ReadAndPackTest, Read8H)
+{
+	runTest([](TestData data)
+	{
+		TestData expected = swizzle(&columnTable32[0][0], data, 32, true);
+		expected = expandHP(expected.prepareExpand(), 24, 0xFF);
+		GSBlock::ReadAndPackBlock8H(data.block, data.output, 8);
+		assertEqual(expected, data, "ReadAndPack8H", 8, 8, 8);
+	});
+}
+
 TEST(WriteTest, Write8H)
 {
 	runTest([](TestData data)
@@ -469,6 +521,17 @@ TEST(ReadAndExpandTest, Read4HH)
 	});
 }
 
+TEST(ReadAndPackTest, Read4HH)
+{
+	runTest([](TestData data)
+	{
+		TestData expected = swizzle(&columnTable32[0][0], data, 32, true);
+		expected = packH4(expected.prepareExpand(), 28);
+		GSBlock::ReadAndPackBlock4HH(data.block, data.output, 4);
+		assertEqual(expected, data, "ReadAndPack4HH", 8, 8, 4);
+	});
+}
+
 TEST(WriteTest, Write4HH)
 {
 	runTest([](TestData data)
@@ -501,6 +564,17 @@ TEST(ReadAndExpandTest, Read4HL)
 	});
 }
 
+TEST(ReadAndPackTest, Read4HL)
+{
+	runTest([](TestData data)
+	{
+		TestData expected = swizzle(&columnTable32[0][0], data, 32, true);
+		expected = packH4(expected.prepareExpand(), 24);
+		GSBlock::ReadAndPackBlock4HL(data.block, data.output, 4);
+		assertEqual(expected, data, "ReadAndPack4HL", 8, 8, 4);
+	});
+}
+
 TEST(WriteTest, Write4HL)
 {
 	runTest([](TestData data)
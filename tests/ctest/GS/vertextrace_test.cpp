@@ -0,0 +1,279 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "Renderers/Common/GSVertexTrace.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// Compares GSVertexTrace::FindRawMinMax, which handles a vertex pair per 256-bit operation on AVX2 builds,
+// against the loop it replaced, which handles one vertex per 128-bit operation.
+
+using RawMinMax = GSVertexTrace::RawMinMax;
+
+namespace
+{
+	template <GS_PRIM_CLASS primclass, u32 iip, u32 tme, u32 fst, u32 color, bool flat_swapped>
+	RawMinMax ReferenceMinMax(const void* vertex, const u32* index, int count)
+	{
+		const int n = primclass == GS_POINT_CLASS ? 1 : primclass == GS_TRIANGLE_CLASS ? 3 : 2;
+
+		GSVector4 tmin = GSVector4(FLT_MAX);
+		GSVector4 tmax = GSVector4(-FLT_MAX);
+		GSVector4i cmin = GSVector4i::xffffffff();
+		GSVector4i cmax = GSVector4i::zero();
+
+		GSVector4i pmin = GSVector4i::xffffffff();
+		GSVector4i pmax = GSVector4i::zero();
+
+		const GSVertex* RESTRICT v = (GSVertex*)vertex;
+
+		auto processVertices = [&](const GSVertex& v0, const GSVertex& v1, bool finalVertex)
+		{
+			if (color)
+			{
+				GSVector4i c0 = GSVector4i::load(v0.RGBAQ.U32[0]);
+				GSVector4i c1 = GSVector4i::load(v1.RGBAQ.U32[0]);
+				if (iip || finalVertex)
+				{
+					cmin = cmin.min_u8(c0.min_u8(c1));
+					cmax = cmax.max_u8(c0.max_u8(c1));
+				}
+				else if (n == 2)
+				{
+					cmin = cmin.min_u8(c1);
+					cmax = cmax.max_u8(c1);
+				}
+			}
+
+			if (tme)
+			{
+				if (!fst)
+				{
+					GSVector4 stq0 = GSVector4::cast(GSVector4i(v0.m[0]));
+					GSVector4 stq1 = GSVector4::cast(GSVector4i(v1.m[0]));
+
+					GSVector4 q;
+					if (primclass == GS_SPRITE_CLASS)
+						q = stq1.wwww();
+					else
+						q = stq0.wwww(stq1);
+
+					GSVector4 st = stq0.xyxy(stq1) / q;
+
+					stq0 = st.xyww(primclass == GS_SPRITE_CLASS ? stq1 : stq0);
+					stq1 = st.zwww(stq1);
+
+					tmin = tmin.min(stq0.min(stq1));
+					tmax = tmax.max(stq0.max(stq1));
+				}
+				else
+				{
+					GSVector4i uv0(v0.m[1]);
+					GSVector4i uv1(v1.m[1]);
+
+					GSVector4 st0 = GSVector4(uv0.uph16()).xyxy();
+					GSVector4 st1 = GSVector4(uv1.uph16()).xyxy();
+
+					tmin = tmin.min(st0.min(st1));
+					tmax = tmax.max(st0.max(st1));
+				}
+			}
+
+			GSVector4i xyzf0(v0.m[1]);
+			GSVector4i xyzf1(v1.m[1]);
+
+			GSVector4i xy0 = xyzf0.upl16();
+			GSVector4i z0 = xyzf0.yyyy();
+			GSVector4i xy1 = xyzf1.upl16();
+			GSVector4i z1 = xyzf1.yyyy();
+
+			GSVector4i p0 = xy0.blend16<0xf0>(z0.uph32(primclass == GS_SPRITE_CLASS ? xyzf1 : xyzf0));
+			GSVector4i p1 = xy1.blend16<0xf0>(z1.uph32(xyzf1));
+
+			pmin = pmin.min_u32(p0.min_u32(p1));
+			pmax = pmax.max_u32(p0.max_u32(p1));
+		};
+
+		if (n == 2)
+		{
+			for (int i = 0; i < count; i += 2)
+			{
+				processVertices(v[index[i + 0]], v[index[i + 1]], false);
+			}
+		}
+		else if (iip || n == 1)
+		{
+			int i = 0;
+			for (; i < (count - 1); i += 2)
+			{
+				processVertices(v[index[i + 0]], v[index[i + 1]], true);
+			}
+			if (count & 1)
+			{
+				processVertices(v[index[i]], v[index[i]], true);
+			}
+		}
+		else
+		{
+			int i = 0;
+			for (; i < (count - 3); i += 6)
+			{
+				processVertices(v[index[i + 0]], v[index[i + 3]], flat_swapped);
+				processVertices(v[index[i + 1]], v[index[i + 4]], false);
+				processVertices(v[index[i + 2]], v[index[i + 5]], !flat_swapped);
+			}
+			if (count & 1)
+			{
+				processVertices(v[index[i + 0]], v[index[i + 1]], flat_swapped);
+				processVertices(v[index[i + 2]], v[index[i + 2]], !flat_swapped);
+			}
+		}
+
+		return {tmin, tmax, cmin, cmax, pmin, pmax};
+	}
+
+	struct DrawData
+	{
+		std::vector<GSVertex> vertex;
+		std::vector<u32> index;
+	};
+
+	DrawData MakeDraw(GS_PRIM_CLASS primclass, int count, u32 seed)
+	{
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<float> st(-4.0f, 4.0f);
+		std::uniform_real_distribution<float> q(0.125f, 8.0f);
+
+		DrawData draw;
+		draw.vertex.resize(count);
+		for (GSVertex& v : draw.vertex)
+		{
+			std::memset(&v, 0, sizeof(v));
+			v.ST.S = st(rng);
+			v.ST.T = st(rng);
+			v.RGBAQ.U32[0] = rng();
+			v.RGBAQ.Q = q(rng);
+			v.XYZ.X = rng();
+			v.XYZ.Y = rng();
+			v.XYZ.Z = rng();
+			v.UV = rng() & 0x3fff3fff;
+			v.FOG = rng();
+		}
+
+		// Sprites are always drawn with indices == vertices.
+		draw.index.resize(count);
+		for (int i = 0; i < count; i++)
+			draw.index[i] = primclass == GS_SPRITE_CLASS ? i : rng() % count;
+
+		return draw;
+	}
+
+	void ExpectEqual(const RawMinMax& a, const RawMinMax& b, int count)
+	{
+		EXPECT_EQ(std::memcmp(&a.tmin, &b.tmin, sizeof(a.tmin)), 0) << "tmin, count " << count;
+		EXPECT_EQ(std::memcmp(&a.tmax, &b.tmax, sizeof(a.tmax)), 0) << "tmax, count " << count;
+		EXPECT_EQ(std::memcmp(&a.cmin, &b.cmin, sizeof(a.cmin)), 0) << "cmin, count " << count;
+		EXPECT_EQ(std::memcmp(&a.cmax, &b.cmax, sizeof(a.cmax)), 0) << "cmax, count " << count;
+		EXPECT_EQ(std::memcmp(&a.pmin, &b.pmin, sizeof(a.pmin)), 0) << "pmin, count " << count;
+		EXPECT_EQ(std::memcmp(&a.pmax, &b.pmax, sizeof(a.pmax)), 0) << "pmax, count " << count;
+	}
+
+	template <GS_PRIM_CLASS primclass, u32 iip, u32 tme, u32 fst, u32 color, bool flat_swapped>
+	void CheckMinMax()
+	{
+		const int n = primclass == GS_POINT_CLASS ? 1 : primclass == GS_TRIANGLE_CLASS ? 3 : 2;
+
+		// Enough primitives to cover every unrolled loop and tail.
+		for (int prims = 1; prims <= 9; prims++)
+		{
+			const int count = prims * n;
+			const DrawData draw = MakeDraw(primclass, count, count);
+
+			const RawMinMax expected = ReferenceMinMax<primclass, iip, tme, fst, color, flat_swapped>(draw.vertex.data(), draw.index.data(), count);
+			const RawMinMax actual = GSVertexTrace::FindRawMinMax<primclass, iip, tme, fst, color, flat_swapped>(draw.vertex.data(), draw.index.data(), count);
+			ExpectEqual(expected, actual, count);
+		}
+	}
+
+	template <GS_PRIM_CLASS primclass, u32 iip, u32 tme, u32 fst, u32 color, bool flat_swapped>
+	double MeasureMinMax(bool reference)
+	{
+		constexpr int count = 3 * 4096;
+		constexpr int runs = 2000;
+		const DrawData draw = MakeDraw(primclass, count, 1);
+
+		// Keep the result alive so the loop is not optimized out.
+		GSVector4i sink = GSVector4i::zero();
+
+		const auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < runs; i++)
+		{
+			const RawMinMax mm = reference ?
+				ReferenceMinMax<primclass, iip, tme, fst, color, flat_swapped>(draw.vertex.data(), draw.index.data(), count) :
+				GSVertexTrace::FindRawMinMax<primclass, iip, tme, fst, color, flat_swapped>(draw.vertex.data(), draw.index.data(), count);
+			sink = sink ^ mm.pmin ^ GSVector4i::cast(mm.tmax);
+		}
+		const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+		EXPECT_NE(sink.extract32<0>() ^ sink.extract32<3>(), 0x12345678u);
+		return ns / (static_cast<double>(runs) * count);
+	}
+
+	template <GS_PRIM_CLASS primclass, u32 iip, u32 tme, u32 fst, u32 color, bool flat_swapped>
+	void ReportMinMaxRate(const char* name)
+	{
+		const double reference = MeasureMinMax<primclass, iip, tme, fst, color, flat_swapped>(true);
+		const double current = MeasureMinMax<primclass, iip, tme, fst, color, flat_swapped>(false);
+		std::printf("%-24s per vertex loop %.3f ns/vertex, FindRawMinMax %.3f ns/vertex\n", name, reference, current);
+	}
+} // namespace
+
+#define CheckMinMax3(P, IIP, TME, FST, COLOR) \
+	CheckMinMax<P, IIP, TME, FST, COLOR, false>(); \
+	CheckMinMax<P, IIP, TME, FST, COLOR, true>();
+
+#define CheckMinMax2(P, IIP, TME) \
+	CheckMinMax3(P, IIP, TME, 0, 0) \
+	CheckMinMax3(P, IIP, TME, 0, 1) \
+	CheckMinMax3(P, IIP, TME, 1, 0) \
+	CheckMinMax3(P, IIP, TME, 1, 1)
+
+#define CheckMinMaxAll(P) \
+	CheckMinMax2(P, 0, 0) \
+	CheckMinMax2(P, 0, 1) \
+	CheckMinMax2(P, 1, 0) \
+	CheckMinMax2(P, 1, 1)
+
+TEST(VertexTraceTest, Points) { CheckMinMaxAll(GS_POINT_CLASS); }
+TEST(VertexTraceTest, Lines) { CheckMinMaxAll(GS_LINE_CLASS); }
+TEST(VertexTraceTest, Triangles) { CheckMinMaxAll(GS_TRIANGLE_CLASS); }
+TEST(VertexTraceTest, Sprites) { CheckMinMaxAll(GS_SPRITE_CLASS); }
+
+// Vertex rate of both loops, run with --gtest_also_run_disabled_tests.
+TEST(VertexTraceTest, DISABLED_FindMinMaxRate)
+{
+	ReportMinMaxRate<GS_TRIANGLE_CLASS, 1, 1, 0, 1, false>("triangles, gouraud, stq");
+	ReportMinMaxRate<GS_TRIANGLE_CLASS, 0, 1, 1, 1, false>("triangles, flat, uv");
+	ReportMinMaxRate<GS_TRIANGLE_CLASS, 1, 0, 0, 1, false>("triangles, untextured");
+	ReportMinMaxRate<GS_SPRITE_CLASS, 0, 1, 0, 1, false>("sprites, stq");
+	ReportMinMaxRate<GS_SPRITE_CLASS, 0, 1, 1, 1, false>("sprites, uv");
+	ReportMinMaxRate<GS_LINE_CLASS, 1, 0, 0, 1, false>("lines, untextured");
+	ReportMinMaxRate<GS_POINT_CLASS, 0, 0, 0, 1, false>("points, untextured");
+}
@@ -0,0 +1,152 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// This file defines functions that are linked to by files used in the VIF unpack tests but not actually used in them, in order to make linkers happy
+
+#include "PrecompiledHeader.h"
+#include "Common.h"
+#include "Vif_Dma.h"
+#include "MTVU.h"
+#include "x86/newVif.h"
+
+alignas(__pagesize) u8 eeHw[Ps2MemSize::Hardware];
+alignas(16) vifStruct vif0, vif1;
+alignas(16) VURegs vuRegs[2];
+
+// Zero initialised, which keeps THREAD_VU1 off so MTVU_VifX is always vif0/vif1.
+Pcsx2Config EmuConfig;
+VU_Thread vu1Thread;
+
+// Same as microVU_Misc.inl, which can't be built without the rest of microVU.
+void mVUmergeRegs(const xRegisterSSE& dest, const xRegisterSSE& src, int xyzw, bool modXYZW)
+{
+	xyzw &= 0xf;
+	if ((dest != src) && (xyzw != 0))
+	{
+		if (xyzw == 0x8)
+			xMOVSS(dest, src);
+		else if (xyzw == 0xf)
+			xMOVAPS(dest, src);
+		else
+		{
+			if (modXYZW)
+			{
+				if      (xyzw == 1) { xINSERTPS(dest, src, _MM_MK_INSERTPS_NDX(0, 3, 0)); return; }
+				else if (xyzw == 2) { xINSERTPS(dest, src, _MM_MK_INSERTPS_NDX(0, 2, 0)); return; }
+				else if (xyzw == 4) { xINSERTPS(dest, src, _MM_MK_INSERTPS_NDX(0, 1, 0)); return; }
+			}
+			xyzw = ((xyzw & 1) << 3) | ((xyzw & 2) << 1) | ((xyzw & 4) >> 1) | ((xyzw & 8) >> 3);
+			xBLEND.PS(dest, src, xyzw);
+		}
+	}
+}
+
+void vifExecQueue(int idx)
+{
+	abort();
+}
+
+SysMainMemory& GetVmMemory()
+{
+	abort();
+}
+
+RecompiledCodeReserve::RecompiledCodeReserve(std::string name, uint defCommit)
+	: VirtualMemoryReserve(std::move(name), defCommit)
+{
+	abort();
+}
+
+RecompiledCodeReserve::~RecompiledCodeReserve()
+{
+}
+
+void* RecompiledCodeReserve::Assign(VirtualMemoryManagerPtr allocator, void* baseptr, size_t size)
+{
+	abort();
+}
+
+void RecompiledCodeReserve::Reset()
+{
+	abort();
+}
+
+bool RecompiledCodeReserve::Commit()
+{
+	abort();
+}
+
+RecompiledCodeReserve& RecompiledCodeReserve::SetProfilerName(std::string shortname)
+{
+	abort();
+}
+
+void RecompiledCodeReserve::ThrowIfNotOk() const
+{
+	abort();
+}
+
+VU_Thread::VU_Thread()
+{
+}
+
+VU_Thread::~VU_Thread()
+{
+}
+
+void VU_Thread::VifUnpack(vifStruct& _vif, VIFregisters& _vifRegs, u8* data, u32 size)
+{
+	abort();
+}
+
+Pcsx2Config::Pcsx2Config()
+{
+}
+
+Pcsx2Config::RecompilerOptions::RecompilerOptions()
+{
+}
+
+Pcsx2Config::CpuOptions::CpuOptions()
+{
+}
+
+Pcsx2Config::GSOptions::GSOptions()
+{
+}
+
+Pcsx2Config::SpeedhackOptions::SpeedhackOptions()
+{
+}
+
+Pcsx2Config::GamefixOptions::GamefixOptions()
+{
+}
+
+Pcsx2Config::DebugOptions::DebugOptions()
+{
+}
+
+Pcsx2Config::FilenameOptions::FilenameOptions()
+{
+}
+
+Pcsx2Config::SPU2Options::SPU2Options()
+{
+}
+
+Pcsx2Config::DEV9Options::DEV9Options()
+{
+}
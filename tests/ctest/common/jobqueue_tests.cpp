@@ -0,0 +1,74 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GS/GSThread_CXX11.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <thread>
+#include <vector>
+
+// A tiny ring with a worker much slower than the producer's spin budget, so Push() has to park
+// on nearly every item and rely on the worker to wake it.
+static GSJobQueue<u32, 4>::Stats RunSlowConsumer(u32 spin_ns)
+{
+	static constexpr u32 ITEMS = 64;
+
+	std::vector<u32> consumed;
+	consumed.reserve(ITEMS);
+
+	auto queue = std::make_unique<GSJobQueue<u32, 4>>(nullptr, [&consumed](u32& item) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		consumed.push_back(item);
+	}, nullptr, spin_ns);
+
+	auto producer = std::async(std::launch::async, [&queue]() {
+		for (u32 i = 0; i < ITEMS; i++)
+			queue->Push(i);
+		queue->Wait();
+	});
+
+	// A lost wakeup leaves the producer parked forever, don't hang the whole run on it.
+	if (producer.wait_for(std::chrono::seconds(30)) != std::future_status::ready)
+	{
+		ADD_FAILURE() << "Producer never finished, " << consumed.size() << " of " << ITEMS << " items consumed";
+		std::abort();
+	}
+
+	const auto stats = queue->GetStats();
+	queue.reset();
+
+	EXPECT_EQ(consumed.size(), ITEMS);
+	for (u32 i = 0; i < consumed.size(); i++)
+		EXPECT_EQ(consumed[i], i);
+
+	return stats;
+}
+
+TEST(GSJobQueue, SlowConsumerParksProducer)
+{
+	const auto stats = RunSlowConsumer(SPIN_TIME_NS);
+	EXPECT_GT(stats.push_spins, 0u);
+	EXPECT_GT(stats.push_parks, 0u);
+}
+
+// With no spin budget both sides park as soon as they have to wait.
+TEST(GSJobQueue, ZeroSpinBudget)
+{
+	const auto stats = RunSlowConsumer(0);
+	EXPECT_GT(stats.push_parks, 0u);
+	EXPECT_GT(stats.worker_parks, 0u);
+}
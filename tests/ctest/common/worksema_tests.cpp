@@ -0,0 +1,116 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/Pcsx2Defs.h"
+#include "common/Threading.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct ContentionResult
+	{
+		u64 processed;
+		u64 parks;
+		double ms;
+	};
+
+	struct Worker
+	{
+		Threading::WorkSema sema;
+		std::atomic<u32> pending{0};
+		std::atomic<bool> exit{false};
+		u64 processed = 0;
+		u64 parks = 0;
+		std::thread thread;
+	};
+
+	// Runs more producer/worker pairs than there are cores, so spinning threads compete with
+	// the ones that have work to do.
+	ContentionResult RunContention(u32 spin_ns, u32 items_per_worker)
+	{
+		const u32 pairs = std::max(2u, std::thread::hardware_concurrency()) * 2;
+		std::vector<std::unique_ptr<Worker>> workers;
+		std::vector<std::thread> producers;
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for (u32 i = 0; i < pairs; i++)
+		{
+			workers.push_back(std::make_unique<Worker>());
+			Worker& w = *workers.back();
+			w.thread = std::thread([&w, spin_ns]() {
+				while (true)
+				{
+					if (w.sema.WaitForWorkWithSpin(spin_ns))
+						w.parks++;
+					if (w.exit.load(std::memory_order_acquire))
+						break;
+					while (w.pending.load(std::memory_order_acquire) > 0)
+					{
+						w.pending.fetch_sub(1, std::memory_order_acq_rel);
+						w.processed++;
+					}
+				}
+			});
+			producers.emplace_back([&w, spin_ns, items_per_worker]() {
+				for (u32 j = 0; j < items_per_worker; j++)
+				{
+					w.pending.fetch_add(1, std::memory_order_release);
+					w.sema.NotifyOfWork();
+					if ((j & 63) == 63)
+						w.sema.WaitForEmptyWithSpin(spin_ns);
+				}
+				w.sema.WaitForEmptyWithSpin(spin_ns);
+			});
+		}
+
+		for (std::thread& p : producers)
+			p.join();
+
+		ContentionResult result = {};
+		for (std::unique_ptr<Worker>& w : workers)
+		{
+			w->exit.store(true, std::memory_order_release);
+			w->sema.NotifyOfWork();
+			w->thread.join();
+			result.processed += w->processed;
+			result.parks += w->parks;
+		}
+
+		result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		std::printf("spin budget %6u ns: %llu items, %llu parks, %.2f ms\n", spin_ns,
+			static_cast<unsigned long long>(result.processed), static_cast<unsigned long long>(result.parks), result.ms);
+		return result;
+	}
+} // namespace
+
+TEST(WorkSema, ContentionNoSpin)
+{
+	const ContentionResult res = RunContention(0, 4096);
+	EXPECT_EQ(res.processed, static_cast<u64>(std::max(2u, std::thread::hardware_concurrency()) * 2 * 4096));
+	EXPECT_GT(res.parks, 0u);
+}
+
+TEST(WorkSema, ContentionDefaultSpin)
+{
+	const ContentionResult res = RunContention(SPIN_TIME_NS, 4096);
+	EXPECT_EQ(res.processed, static_cast<u64>(std::max(2u, std::thread::hardware_concurrency()) * 2 * 4096));
+}
@@ -0,0 +1,260 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2022  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Writes a small GS dump for the gsrunner smoke test: a 640x448 NTSC display with a cleared
+// framebuffer, a moving sprite and a gouraud triangle per frame, all sent over PATH3.
+
+#include "GS/GSRegs.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static constexpr u32 FRAME_COUNT = 16;
+static constexpr u32 WIDTH = 640;
+static constexpr u32 HEIGHT = 448;
+
+// Mirrors GSState::Freeze(), version 8.
+static constexpr u32 STATE_VERSION = 8;
+static constexpr u32 STATE_ENV_REGS = 15 + 12 * 2 + 6;
+static constexpr u32 STATE_VM_SIZE = 4 * 1024 * 1024;
+static constexpr u32 STATE_PATH_COUNT = 4;
+
+namespace
+{
+	enum : u8
+	{
+		DUMP_TRANSFER = 0,
+		DUMP_VSYNC = 1,
+		DUMP_REGISTERS = 3,
+	};
+
+	// Transfer index as GSState::Transfer() numbers them.
+	static constexpr u8 DUMP_PATH3 = 2;
+
+	enum : u8
+	{
+		ADDR_PRIM = 0x00,
+		ADDR_RGBAQ = 0x01,
+		ADDR_XYZ2 = 0x05,
+		ADDR_XYOFFSET_1 = 0x18,
+		ADDR_SCISSOR_1 = 0x40,
+		ADDR_TEST_1 = 0x47,
+		ADDR_FRAME_1 = 0x4c,
+		ADDR_ZBUF_1 = 0x4e,
+	};
+
+	class DumpWriter
+	{
+	public:
+		explicit DumpWriter(std::FILE* fp)
+			: m_fp(fp)
+		{
+		}
+
+		void Write(const void* data, size_t size) { m_ok &= (std::fwrite(data, 1, size, m_fp) == size); }
+		void Write(u8 value) { Write(&value, sizeof(value)); }
+		void Write(u32 value) { Write(&value, sizeof(value)); }
+		bool IsOk() const { return m_ok; }
+
+	private:
+		std::FILE* m_fp;
+		bool m_ok = true;
+	};
+
+	class GIFPacket
+	{
+	public:
+		void AD(u8 addr, u64 data)
+		{
+			m_qwords.push_back(data);
+			m_qwords.push_back(addr);
+		}
+
+		void RGBA(u8 r, u8 g, u8 b)
+		{
+			GIFRegRGBAQ rgbaq = {};
+			rgbaq.R = r;
+			rgbaq.G = g;
+			rgbaq.B = b;
+			rgbaq.A = 0x80;
+			rgbaq.Q = 1.0f;
+			AD(ADDR_RGBAQ, rgbaq.U64);
+		}
+
+		void XYZ(u32 x, u32 y)
+		{
+			GIFRegXYZ xyz = {};
+			xyz.X = (2048 + x) << 4;
+			xyz.Y = (2048 + y) << 4;
+			AD(ADDR_XYZ2, xyz.U64);
+		}
+
+		/// Returns the packet with a PACKED A+D tag in front of it.
+		std::vector<u64> Finish() const
+		{
+			GIFTag tag = {};
+			tag.NLOOP = static_cast<u32>(m_qwords.size() / 2);
+			tag.EOP = 1;
+			tag.FLG = GIF_FLG_PACKED;
+			tag.NREG = 1;
+			tag.REGS = GIF_REG_A_D;
+
+			std::vector<u64> ret(2);
+			std::memcpy(ret.data(), &tag, sizeof(tag));
+			ret.insert(ret.end(), m_qwords.begin(), m_qwords.end());
+			return ret;
+		}
+
+	private:
+		std::vector<u64> m_qwords;
+	};
+} // namespace
+
+static void WriteState(DumpWriter& dw)
+{
+	std::vector<u8> state;
+	state.resize(sizeof(u32) + STATE_ENV_REGS * sizeof(GIFReg) + sizeof(s32) * 2 + STATE_VM_SIZE +
+				 (sizeof(GIFTag) + sizeof(u32)) * STATE_PATH_COUNT + sizeof(float));
+	std::memcpy(state.data(), &STATE_VERSION, sizeof(STATE_VERSION));
+
+	// Old style header, no serial.
+	dw.Write(static_cast<u32>(0));
+	dw.Write(static_cast<u32>(state.size()));
+	dw.Write(state.data(), state.size());
+}
+
+static GSPrivRegSet GetPrivRegs()
+{
+	GSPrivRegSet regs;
+	std::memset(&regs, 0, sizeof(regs));
+
+	regs.PMODE.EN1 = 1;
+	regs.PMODE.MMOD = 1;
+	regs.PMODE.ALP = 0xff;
+	regs.SMODE1.U64 = 0x0000001742834504ull; // NTSC
+	regs.SMODE2.INT = 1;
+	regs.DISP[0].DISPFB.FBW = WIDTH / 64;
+	regs.DISP[0].DISPFB.PSM = PSM_PSMCT32;
+	regs.DISP[0].DISPLAY.DX = 652;
+	regs.DISP[0].DISPLAY.DY = 50;
+	regs.DISP[0].DISPLAY.MAGH = 3;
+	regs.DISP[0].DISPLAY.DW = WIDTH * 4 - 1;
+	regs.DISP[0].DISPLAY.DH = HEIGHT - 1;
+	return regs;
+}
+
+static std::vector<u64> GetFramePacket(u32 frame)
+{
+	GIFPacket pkt;
+
+	GIFRegFRAME fr = {};
+	fr.FBW = WIDTH / 64;
+	fr.PSM = PSM_PSMCT32;
+	pkt.AD(ADDR_FRAME_1, fr.U64);
+
+	GIFRegZBUF zb = {};
+	zb.ZBP = 0x100;
+	zb.ZMSK = 1;
+	pkt.AD(ADDR_ZBUF_1, zb.U64);
+
+	GIFRegTEST test = {};
+	test.ZTE = 1;
+	test.ZTST = ZTST_ALWAYS;
+	pkt.AD(ADDR_TEST_1, test.U64);
+
+	GIFRegXYOFFSET ofs = {};
+	ofs.OFX = 2048 << 4;
+	ofs.OFY = 2048 << 4;
+	pkt.AD(ADDR_XYOFFSET_1, ofs.U64);
+
+	GIFRegSCISSOR scissor = {};
+	scissor.SCAX1 = WIDTH - 1;
+	scissor.SCAY1 = HEIGHT - 1;
+	pkt.AD(ADDR_SCISSOR_1, scissor.U64);
+
+	GIFRegPRIM prim = {};
+	prim.PRIM = GS_SPRITE;
+	pkt.AD(ADDR_PRIM, prim.U64);
+	pkt.RGBA(0, 0, 0);
+	pkt.XYZ(0, 0);
+	pkt.XYZ(WIDTH, HEIGHT);
+
+	const u32 x = frame * 24;
+	const u32 y = frame * 16;
+	pkt.AD(ADDR_PRIM, prim.U64);
+	pkt.RGBA(0xff, 0x80, 0x20);
+	pkt.XYZ(x, y);
+	pkt.XYZ(x + 96, y + 64);
+
+	prim.PRIM = GS_TRIANGLELIST;
+	prim.IIP = 1;
+	pkt.AD(ADDR_PRIM, prim.U64);
+	pkt.RGBA(0xff, 0, 0);
+	pkt.XYZ(WIDTH / 2, 32 + frame);
+	pkt.RGBA(0, 0xff, 0);
+	pkt.XYZ(96, HEIGHT - 32);
+	pkt.RGBA(0, 0, 0xff);
+	pkt.XYZ(WIDTH - 96 - frame * 4, HEIGHT - 48);
+
+	return pkt.Finish();
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc != 2)
+	{
+		std::fprintf(stderr, "Usage: %s <output.gs>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::FILE* fp = std::fopen(argv[1], "wb");
+	if (!fp)
+	{
+		std::fprintf(stderr, "Failed to open '%s' for writing.\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	DumpWriter dw(fp);
+	WriteState(dw);
+
+	const GSPrivRegSet regs = GetPrivRegs();
+	dw.Write(&regs, sizeof(regs));
+
+	for (u32 frame = 0; frame < FRAME_COUNT; frame++)
+	{
+		const std::vector<u64> pkt = GetFramePacket(frame);
+		dw.Write(DUMP_TRANSFER);
+		dw.Write(DUMP_PATH3);
+		dw.Write(static_cast<u32>(pkt.size() * sizeof(u64)));
+		dw.Write(pkt.data(), pkt.size() * sizeof(u64));
+
+		dw.Write(DUMP_REGISTERS);
+		dw.Write(&regs, sizeof(regs));
+
+		dw.Write(DUMP_VSYNC);
+		dw.Write(static_cast<u8>(frame & 1));
+	}
+
+	const bool ok = dw.IsOk();
+	if (std::fclose(fp) != 0 || !ok)
+	{
+		std::fprintf(stderr, "Failed to write '%s'.\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -167,3 +167,26 @@ TEST(CodegenTests, SSETest)
 	CODEGEN_TEST_64(xBLEND.PD(xmm8, xmm9, 0xaa), "66 45 0f 3a 0d c1 aa");
 	CODEGEN_TEST_64(xEXTRACTPS(ptr32[base], xmm1, 2), "66 0f 3a 17 0d f6 ff ff ff 02");
 }
+
+TEST(CodegenTests, AVXTest)
+{
+	CODEGEN_TEST_BOTH(xVADD.PS(xmm0, xmm1, xmm2), "c5 f0 58 c2");
+	CODEGEN_TEST_64(xVADD.PS(xmm8, xmm9, xmm10), "c4 41 30 58 c2");
+	CODEGEN_TEST_BOTH(xVMUL.SS(xmm0, xmm1, ptr32[rax]), "c5 f2 59 00");
+	CODEGEN_TEST_64(xVSUB.PS(xmm1, xmm2, ptr128[r8+r9]), "c4 81 68 5c 0c 08");
+	CODEGEN_TEST_64(xVAND.PS(xmm3, xmm4, xmm11), "c4 c1 58 54 db");
+	CODEGEN_TEST_BOTH(xVPXOR(xmm0, xmm1, xmm2), "c5 f1 ef c2");
+	CODEGEN_TEST_BOTH(xVPSRAD(xmm0, xmm1, 31), "c5 f9 72 e1 1f");
+	CODEGEN_TEST_64(xVPSRLD(xmm9, xmm8, 1), "c4 c1 31 72 d0 01");
+	CODEGEN_TEST_BOTH(xVBLENDPS(xmm0, xmm1, xmm2, 0x55), "c4 e3 71 0c c2 55");
+	CODEGEN_TEST_BOTH(xVBLENDVPS(xmm0, xmm1, xmm2, xmm3), "c4 e3 71 4a c2 30");
+	CODEGEN_TEST_64(xVBROADCASTSS(xmm8, ptr32[rax]), "c4 62 79 18 00");
+	CODEGEN_TEST_BOTH(xVUNPCKHPS(xmm0, xmm1, xmm2), "c5 f0 15 c2");
+	CODEGEN_TEST_BOTH(xVMOVUPS(ymm0, ptr[rsi]), "c5 fc 10 06");
+	CODEGEN_TEST_BOTH(xVMOVUPS(ptr[rdi+0x10], ymm0), "c5 fc 11 47 10");
+	CODEGEN_TEST_64(xVMOVAPS(xmm8, xmm1), "c5 78 28 c1");
+	CODEGEN_TEST_64(xVMOVUPS(ptr[r8], ymm9), "c4 41 7c 11 08");
+	CODEGEN_TEST_BOTH(xVPMOVSX.WD(ymm0, ptr[rsi]), "c4 e2 7d 23 06");
+	CODEGEN_TEST_BOTH(xVPMOVZX.BD(ymm1, ptr[rsi+4]), "c4 e2 7d 31 4e 04");
+	CODEGEN_TEST_BOTH(xVZEROUPPER(), "c5 f8 77");
+}